@@ -145,6 +145,7 @@ Time firstTwtSpStart = (82.5 * beaconInterval);    // // TWT is set up after app
 Time firstTwtSpOffsetFromBeacon = MilliSeconds (2);    // Offset from beacon for first TWT SP
 bool twtTriggerBased = false; // Set it to false for contention-based TWT
 uint64_t maxMuSta = 1;      // Maximum number of STAs the TWT scheduler will assign for a DATA MU exchange. For BSRP, max possible is used
+std::string macQueueScheduler = "ns3::FcfsWifiQueueScheduler";   // MAC queue scheduler of the AP; ns3::TwtAirtimeWifiQueueScheduler serves STAs by earliest TWT SP end and airtime fairness
 double twtWakeIntervalMultiplier, twtNominalWakeDurationDivider;
 double nextStaTwtSpOffsetDivider = 1;
 uint32_t staCountModulusForTwt = 1;    // Offset for next STA TWT start is added only after each staCountModulusForTwt STAs
@@ -385,6 +386,7 @@ int main (int argc, char *argv[])
   // cmd.AddValue ("mcs", "A specific MCS (0-11)", mcs);
   
   cmd.AddValue ("maxMuSta", "Max number of STAs the AP can trigger in one MU_UL with Basic TF", maxMuSta);
+  cmd.AddValue ("macQueueScheduler", "TypeId of the MAC queue scheduler of the AP (e.g., ns3::FcfsWifiQueueScheduler or ns3::TwtAirtimeWifiQueueScheduler)", macQueueScheduler);
   cmd.AddValue ("twtWakeIntervalMultiplier", "double K, where wakeInterval = BI * K", twtWakeIntervalMultiplier);
 
   cmd.Parse (argc,argv);
@@ -769,6 +771,7 @@ int main (int argc, char *argv[])
 
 
 
+  mac.SetMacQueueScheduler (macQueueScheduler);
   apDevice = wifi.Install (phy, mac, wifiApNodes);
 
 
@@ -57,6 +57,8 @@ int main(int argc, char *argv[])
     double videoWeibullScale = 6950; // Will change for each video quality 
     // BV1 - 6950, BV2 - 13900, BV3 - 20850, BV4 - 27800, BV5 - 34750, BV6 - 54210
     double videoWeibullShape = 0.8099;
+    bool videoBurstMode = false;           // Send every frame in a single event if true
+    std::string videoFrameSizeTrace = "";  // Replay the frame sizes in this file, if not empty
 
     // Parse command line arguments
     CommandLine cmd;
@@ -67,6 +69,8 @@ int main(int argc, char *argv[])
     cmd.AddValue ("p2pLinkDelay_ms", "Delay of P2P link between the server node and the client node", p2pLinkDelay_ms);
     cmd.AddValue ("videoQuality", "integer: 1 through 6 for bv1 through bv6", videoQuality);
     cmd.AddValue ("videoFrameInterval_s", "Double: Frame interval based on frame rate. 0.03333 for 30 FPS", videoFrameInterval_s);
+    cmd.AddValue ("videoBurstMode", "Pass all the packets of a frame to the socket in a single event if true", videoBurstMode);
+    cmd.AddValue ("videoFrameSizeTrace", "File containing the trace of frame sizes to replay (Weibull distribution if empty)", videoFrameSizeTrace);
     cmd.Parse(argc, argv);
 
     // LogComponentEnable ("VideoApplication", LogLevel (LOG_PREFIX_TIME | LOG_PREFIX_NODE | LOG_LEVEL_ALL));
@@ -148,6 +152,8 @@ int main(int argc, char *argv[])
         videoUL.SetAttribute ("FrameInterval", TimeValue (Seconds(videoFrameInterval_s)));
         videoUL.SetAttribute ("WeibullScale", DoubleValue (videoWeibullScale));
         videoUL.SetAttribute ("WeibullShape", DoubleValue (videoWeibullShape));
+        videoUL.SetAttribute ("BurstMode", BooleanValue (videoBurstMode));
+        videoUL.SetAttribute ("FrameSizeTrace", StringValue (videoFrameSizeTrace));
         ApplicationContainer clientApp = videoUL.Install (clientNode);
 
         clientApp.Start (Seconds (0));        
@@ -169,6 +175,8 @@ int main(int argc, char *argv[])
         videoDL.SetAttribute ("FrameInterval", TimeValue (Seconds(videoFrameInterval_s)));
         videoDL.SetAttribute ("WeibullScale", DoubleValue (videoWeibullScale));
         videoDL.SetAttribute ("WeibullShape", DoubleValue (videoWeibullShape));
+        videoDL.SetAttribute ("BurstMode", BooleanValue (videoBurstMode));
+        videoDL.SetAttribute ("FrameSizeTrace", StringValue (videoFrameSizeTrace));
         ApplicationContainer clientApp = videoDL.Install (serverNode);
 
         clientApp.Start (Seconds (0));
@@ -43,6 +43,9 @@
 #include "ns3/boolean.h"
 #include "ns3/double.h"
 
+#include <fstream>
+#include <sstream>
+
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("VideoApplication");
@@ -100,6 +103,24 @@ VideoApplication::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&VideoApplication::m_enableSeqTsSizeHeader),
                    MakeBooleanChecker ())
+    .AddAttribute ("BurstMode",
+                   "If true, all the packets of a frame are passed to the socket in a single "
+                   "event, until the socket TX buffer is full; the remaining packets are sent "
+                   "when the socket notifies that room is available in its TX buffer. If false, "
+                   "a separate event is scheduled to send every packet of a frame.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&VideoApplication::m_burstMode),
+                   MakeBooleanChecker ())
+    .AddAttribute ("FrameSizeTrace",
+                   "The name of a file containing a trace of the frame sizes generated by a "
+                   "video encoder. Each line of the file describes a frame and its last field "
+                   "is the frame size in bytes; empty lines and text following a '#' are "
+                   "ignored. Frames are replayed in order (restarting from the first one "
+                   "when the trace is exhausted), every FrameInterval. If empty, the frame "
+                   "sizes are drawn from the Weibull distribution.",
+                   StringValue (""),
+                   MakeStringAccessor (&VideoApplication::m_frameSizeTrace),
+                   MakeStringChecker ())
     .AddTraceSource ("Tx", "A new packet is created and is sent",
                      MakeTraceSourceAccessor (&VideoApplication::m_txTrace),
                      "ns3::Packet::TracedCallback")
@@ -117,6 +138,8 @@ VideoApplication::GetTypeId (void)
 VideoApplication::VideoApplication ()
   : m_socket (0),
     m_connected (false),
+    m_RemainingFrameSize (0),
+    m_RemainingPkts (0),
     m_totFrames (0),
     m_totBytesGenerated (0),
     m_totBytes (0),
@@ -195,6 +218,11 @@ void VideoApplication::StartApplication () // Called at time specified by Start
         MakeCallback (&VideoApplication::ConnectionFailed, this));
     }
 
+  if (!m_frameSizeTrace.empty () && m_frameSizes.empty ())
+    {
+      LoadFrameSizeTrace ();
+    }
+
   // Ensure no pending event
   CancelEvents ();
   // If we are not yet connected, there is nothing to do here
@@ -217,6 +245,7 @@ void VideoApplication::StopApplication () // Called at time specified by Stop
   
   if (m_socket != nullptr)
     {
+      m_socket->SetSendCallback (MakeNullCallback<void, Ptr<Socket>, uint32_t> ());
       m_socket->Close ();
     }
   else
@@ -238,6 +267,8 @@ void VideoApplication::CancelEvents ()
       NS_LOG_DEBUG ("Discarding cached packet upon CancelEvents ()");
     }
   m_unsentPacket = 0;
+  m_pendingFrames.clear ();
+  m_RemainingPkts = 0;
 }
 
 // Private helpers
@@ -260,18 +291,25 @@ void VideoApplication::ScheduleNextTx ()
 
 void VideoApplication::ScheduleFrameGeneration()
 {
-  while (true) {
-    m_RemainingFrameSize = floor(rand_weibull->GetValue());
-    if (m_RemainingFrameSize < maxFrameSize) break;
-  }
-  m_RemainingPkts = ceil(double(m_RemainingFrameSize)/maxPacketSize);
+  uint32_t frameSize = GetNextFrameSize ();
 
   // NS_LOG_INFO ("Frame size: " << m_RemainingFrameSize << ", Number of packets: " << m_RemainingPkts);
   NS_LOG_INFO ("Average frame size to port "<< InetSocketAddress::ConvertFrom (m_peer).GetPort () << " is " << double(m_totBytesGenerated)/m_totFrames);
-  m_totBytesGenerated += m_RemainingFrameSize;
+  m_totBytesGenerated += frameSize;
   m_totFrames++;
 
-  ScheduleNextTx();
+  if (m_burstMode)
+    {
+      // frames that could not be entirely sent yet are sent first
+      m_pendingFrames.push_back (frameSize);
+      SendFrame ();
+    }
+  else
+    {
+      m_RemainingFrameSize = frameSize;
+      m_RemainingPkts = ceil(double(m_RemainingFrameSize)/maxPacketSize);
+      ScheduleNextTx();
+    }
   NS_LOG_INFO ("Next frame scheduled after " << m_frameInterval.As(Time::MS));
   m_frameEvent = Simulator::Schedule (m_frameInterval, &VideoApplication::ScheduleFrameGeneration, this);
 }
@@ -291,6 +329,54 @@ void VideoApplication::SendPacket ()
     // m_frameEvent = Simulator::Schedule (Seconds(m_frameInterval), &VideoApplication::ScheduleFrameGeneration, this);
   }
 
+  TransmitPacket ();
+
+  m_RemainingPkts--;
+  m_RemainingFrameSize -= maxPacketSize;
+  // NS_LOG_INFO ("Number of packets remaining in this state: " << m_RemainingPkts);
+  // if (m_RemainingPkts > 0) ScheduleNextTx ();
+}
+
+void VideoApplication::SendFrame ()
+{
+  // NS_LOG_FUNCTION (this);
+
+  while (m_RemainingPkts > 0 || !m_pendingFrames.empty ())
+    {
+      if (m_RemainingPkts == 0)
+        {
+          m_RemainingFrameSize = m_pendingFrames.front ();
+          m_pendingFrames.pop_front ();
+          m_RemainingPkts = ceil (double (m_RemainingFrameSize) / maxPacketSize);
+          continue;
+        }
+
+      m_pktSize = (m_RemainingPkts > 1 ? maxPacketSize : m_RemainingFrameSize);
+
+      if ((!m_unsentPacket && m_socket->GetTxAvailable () < m_pktSize) || !TransmitPacket ())
+        {
+          NS_LOG_DEBUG ("Socket TX buffer full; " << m_RemainingPkts << " packets and "
+                        << m_pendingFrames.size () << " frames left");
+          m_socket->SetSendCallback (MakeCallback (&VideoApplication::DataSend, this));
+          return;
+        }
+
+      m_RemainingPkts--;
+      m_RemainingFrameSize -= m_pktSize;
+    }
+}
+
+void VideoApplication::DataSend (Ptr<Socket> socket, uint32_t available)
+{
+  // NS_LOG_FUNCTION (this << socket << available);
+
+  // the send callback is only needed while the TX buffer is full
+  m_socket->SetSendCallback (MakeNullCallback<void, Ptr<Socket>, uint32_t> ());
+  SendFrame ();
+}
+
+bool VideoApplication::TransmitPacket ()
+{
   Ptr<Packet> packet;
   if (m_unsentPacket)
     {
@@ -348,12 +434,63 @@ void VideoApplication::SendPacket ()
     {
       NS_LOG_DEBUG ("Unable to send packet; actual " << actual << " size " << m_pktSize << "; caching for later attempt");
       m_unsentPacket = packet;
+      return false;
     }
-  
-  m_RemainingPkts--;
-  m_RemainingFrameSize -= maxPacketSize;
-  // NS_LOG_INFO ("Number of packets remaining in this state: " << m_RemainingPkts);
-  // if (m_RemainingPkts > 0) ScheduleNextTx ();
+  return true;
+}
+
+void VideoApplication::LoadFrameSizeTrace ()
+{
+  // NS_LOG_FUNCTION (this);
+
+  std::ifstream traceFile (m_frameSizeTrace);
+  NS_ABORT_MSG_IF (!traceFile.is_open (), "Cannot open frame size trace " << m_frameSizeTrace);
+
+  std::string line;
+  while (std::getline (traceFile, line))
+    {
+      line = line.substr (0, line.find ('#'));
+      std::istringstream iss (line);
+      std::string field;
+      std::string lastField;
+      while (iss >> field)
+        {
+          lastField = field;
+        }
+      if (lastField.empty ())
+        {
+          continue;
+        }
+
+      std::istringstream sizeStream (lastField);
+      uint32_t frameSize;
+      NS_ABORT_MSG_IF (!(sizeStream >> frameSize) || !sizeStream.eof (),
+                       "Invalid frame size in trace " << m_frameSizeTrace << ": " << line);
+      NS_ABORT_MSG_IF (frameSize >= maxFrameSize,
+                       "Frame size " << frameSize << " exceeds the maximum frame size");
+      m_frameSizes.push_back (frameSize);
+    }
+
+  NS_ABORT_MSG_IF (m_frameSizes.empty (), "No frame found in trace " << m_frameSizeTrace);
+  NS_LOG_INFO ("Read " << m_frameSizes.size () << " frames from " << m_frameSizeTrace);
+  m_nextFrame = 0;
+}
+
+uint32_t VideoApplication::GetNextFrameSize ()
+{
+  if (!m_frameSizes.empty ())
+    {
+      uint32_t frameSize = m_frameSizes[m_nextFrame];
+      m_nextFrame = (m_nextFrame + 1) % m_frameSizes.size ();
+      return frameSize;
+    }
+
+  uint32_t frameSize;
+  while (true) {
+    frameSize = floor(rand_weibull->GetValue());
+    if (frameSize < maxFrameSize) break;
+  }
+  return frameSize;
 }
 
 
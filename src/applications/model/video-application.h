@@ -10,6 +10,9 @@
 #include "ns3/traced-callback.h"
 #include "ns3/seq-ts-size-header.h"
 
+#include <deque>
+#include <vector>
+
 namespace ns3 {
 
 class Address;
@@ -54,6 +57,39 @@ private:
    */
   void SendPacket ();
 
+  /**
+   * \brief Send the packets of the pending frames, in burst mode, until the socket
+   * TX buffer is full
+   */
+  void SendFrame ();
+
+  /**
+   * \brief Create a packet of m_pktSize bytes (or take the cached unsent packet)
+   * and pass it to the socket
+   * \return true if the socket accepted the packet
+   */
+  bool TransmitPacket ();
+
+  /**
+   * \brief Resume sending the pending frames, in burst mode, when the socket
+   * has room in its TX buffer
+   * \param socket the socket
+   * \param available the number of bytes available in the socket TX buffer
+   */
+  void DataSend (Ptr<Socket> socket, uint32_t available);
+
+  /**
+   * \brief Read the frame sizes from the frame size trace file
+   */
+  void LoadFrameSizeTrace ();
+
+  /**
+   * \brief Get the size of the next frame, either drawn from the Weibull
+   * distribution or read from the frame size trace
+   * \return the size in bytes of the next frame
+   */
+  uint32_t GetNextFrameSize ();
+
   Ptr<Socket>     m_socket;       //!< Associated socket
   Address         m_peer;         //!< Peer address
   Address         m_local;        //!< Local address to bind to
@@ -76,6 +112,11 @@ private:
   uint32_t        m_seq {0};      //!< Sequence
   Ptr<Packet>     m_unsentPacket; //!< Unsent packet cached for future attempt
   bool            m_enableSeqTsSizeHeader {false}; //!< Enable or disable the use of SeqTsSizeHeader
+  bool            m_burstMode;    //!< Send all the packets of a frame in a single event
+  std::deque<uint32_t> m_pendingFrames; //!< Sizes of the frames waiting to be sent in burst mode
+  std::string     m_frameSizeTrace; //!< Name of the frame size trace file
+  std::vector<uint32_t> m_frameSizes; //!< Frame sizes read from the frame size trace file
+  std::size_t     m_nextFrame {0}; //!< Index of the next frame size in the trace
   // Ptr<GammaRandomVariable> rand_gamma = CreateObject<GammaRandomVariable> ();
   Ptr<WeibullRandomVariable> rand_weibull = CreateObject<WeibullRandomVariable> ();
 
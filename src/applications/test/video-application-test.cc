@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/config.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/neighbor-cache-helper.h"
+#include "ns3/packet-sink-helper.h"
+#include "ns3/packet-sink.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/tcp-socket.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/video-helper.h"
+
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief Test the trace-driven and burst modes of the VideoApplication
+ *
+ * A VideoApplication replays the frame sizes read from a trace file and sends the frames
+ * to a PacketSink. This test verifies that the packets sent at every frame generation
+ * add up to the frame size read from the trace (which is replayed from the beginning when
+ * exhausted) and that all the bytes are received by the sink. When the socket is a UDP
+ * socket, this test also verifies that the burst mode sends the same packets as the
+ * default mode by means of fewer simulator events. When the socket is a TCP socket with
+ * a TX buffer smaller than a frame, this test verifies that the burst mode resumes
+ * sending a frame when the socket notifies that room is available in its TX buffer.
+ */
+class VideoApplicationTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param protocol the type of socket factory used by the VideoApplication
+     */
+    VideoApplicationTestCase(std::string protocol);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run a simulation in which the VideoApplication replays the frame size trace.
+     *
+     * \param burstMode whether the burst mode is enabled
+     * \return the number of simulator events executed
+     */
+    uint64_t RunSimulation(bool burstMode);
+
+    /**
+     * Callback invoked when the VideoApplication sends a packet.
+     *
+     * \param packet the packet sent
+     */
+    void Tx(Ptr<const Packet> packet);
+
+    static constexpr uint32_t m_nFrames = 8; //!< number of frames to send
+    const Time m_frameInterval{MilliSeconds(20)}; //!< the frame interval
+    std::string m_protocol;                       //!< the type of socket factory
+    std::vector<uint32_t> m_trace{12000, 3000, 1472, 500}; //!< the frame sizes in the trace
+    std::string m_traceFile;                               //!< the frame size trace file
+    std::map<Time, uint32_t> m_txBytes; //!< bytes sent by the application at every time
+    uint32_t m_txPackets{0};            //!< number of packets sent by the application
+};
+
+VideoApplicationTestCase::VideoApplicationTestCase(std::string protocol)
+    : TestCase("Check the trace-driven and burst modes of the VideoApplication with " +
+               protocol),
+      m_protocol(protocol)
+{
+}
+
+void
+VideoApplicationTestCase::Tx(Ptr<const Packet> packet)
+{
+    m_txBytes[Simulator::Now()] += packet->GetSize();
+    ++m_txPackets;
+}
+
+uint64_t
+VideoApplicationTestCase::RunSimulation(bool burstMode)
+{
+    m_txBytes.clear();
+    m_txPackets = 0;
+
+    NodeContainer n(2);
+
+    InternetStackHelper internet;
+    internet.Install(n);
+
+    auto txDev = CreateObject<SimpleNetDevice>();
+    auto rxDev = CreateObject<SimpleNetDevice>();
+    txDev->SetAttribute("DataRate", StringValue("10Mbps"));
+    rxDev->SetAttribute("DataRate", StringValue("10Mbps"));
+    n.Get(0)->AddDevice(txDev);
+    n.Get(1)->AddDevice(rxDev);
+    auto channel = CreateObject<SimpleChannel>();
+    rxDev->SetChannel(channel);
+    txDev->SetChannel(channel);
+    NetDeviceContainer d;
+    d.Add(txDev);
+    d.Add(rxDev);
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    auto i = ipv4.Assign(d);
+    // the packets of the first frame are sent at once, hence prevent them from being
+    // dropped while the address of the sink is being resolved
+    NeighborCacheHelper neighborCache;
+    neighborCache.PopulateNeighborCache();
+
+    uint16_t port = 4000;
+    PacketSinkHelper sinkHelper(m_protocol, InetSocketAddress(Ipv4Address::GetAny(), port));
+    auto sinkApps = sinkHelper.Install(n.Get(1));
+    sinkApps.Start(Seconds(0.5));
+    sinkApps.Stop(Seconds(3.0));
+
+    VideoHelper video(m_protocol, InetSocketAddress(i.GetAddress(1), port));
+    video.SetAttribute("FrameInterval", TimeValue(m_frameInterval));
+    video.SetAttribute("FrameSizeTrace", StringValue(m_traceFile));
+    video.SetAttribute("BurstMode", BooleanValue(burstMode));
+    auto videoApps = video.Install(n.Get(0));
+    videoApps.Start(Seconds(1.0));
+    // stop the application after m_nFrames frames have been generated
+    videoApps.Stop(Seconds(1.0) + m_frameInterval * m_nFrames - m_frameInterval / 2);
+    videoApps.Get(0)->TraceConnectWithoutContext(
+        "Tx",
+        MakeCallback(&VideoApplicationTestCase::Tx, this));
+
+    Simulator::Run();
+    auto nEvents = Simulator::GetEventCount();
+
+    const auto totalBytes =
+        2 * std::accumulate(m_trace.cbegin(), m_trace.cend(), static_cast<uint32_t>(0));
+    NS_TEST_EXPECT_MSG_EQ(DynamicCast<PacketSink>(sinkApps.Get(0))->GetTotalRx(),
+                          totalBytes,
+                          "Unexpected number of bytes received (burst mode=" << burstMode
+                                                                              << ")");
+
+    if (m_protocol == "ns3::UdpSocketFactory")
+    {
+        // all the packets of a frame are sent at the time the frame is generated
+        NS_TEST_EXPECT_MSG_EQ(m_txBytes.size(), m_nFrames, "Unexpected number of frames");
+        std::size_t frame = 0;
+        for (const auto& [time, bytes] : m_txBytes)
+        {
+            NS_TEST_EXPECT_MSG_EQ(time,
+                                  Seconds(1.0) + m_frameInterval * frame,
+                                  "Unexpected generation time for frame " << frame);
+            NS_TEST_EXPECT_MSG_EQ(bytes,
+                                  m_trace[frame % m_trace.size()],
+                                  "Unexpected size for frame " << frame);
+            ++frame;
+        }
+    }
+
+    Simulator::Destroy();
+    return nEvents;
+}
+
+void
+VideoApplicationTestCase::DoRun()
+{
+    m_traceFile = CreateTempDirFilename("video-frame-sizes.txt");
+    std::ofstream ofs(m_traceFile);
+    ofs << "# frame type size\n";
+    ofs << "0 I " << m_trace[0] << "\n";
+    ofs << "1 P " << m_trace[1] << "\n\n";
+    ofs << "2 P " << m_trace[2] << "  # a frame fitting a single packet\n";
+    ofs << "3 B " << m_trace[3] << "\n";
+    ofs.close();
+
+    if (m_protocol == "ns3::UdpSocketFactory")
+    {
+        auto nEvents = RunSimulation(false);
+        auto nPackets = m_txPackets;
+        auto nEventsBurst = RunSimulation(true);
+
+        NS_TEST_EXPECT_MSG_EQ(m_txPackets,
+                              nPackets,
+                              "Burst mode sent a different number of packets");
+        NS_TEST_EXPECT_MSG_LT(nEventsBurst,
+                              nEvents,
+                              "Burst mode should require fewer simulator events");
+    }
+    else
+    {
+        // the socket TX buffer cannot hold the largest frame; restore the previous
+        // default value afterwards, so that other tests are not affected
+        TypeId::AttributeInformation info;
+        NS_ABORT_IF(!TcpSocket::GetTypeId().LookupAttributeByName("SndBufSize", &info));
+        auto previousSndBufSize = info.initialValue;
+        Config::SetDefault("ns3::TcpSocket::SndBufSize", UintegerValue(4000));
+        RunSimulation(true);
+        Config::SetDefault("ns3::TcpSocket::SndBufSize", *previousSndBufSize);
+
+        NS_TEST_EXPECT_MSG_GT(m_txBytes.size(),
+                              m_nFrames,
+                              "Frames should be sent across multiple send callbacks");
+    }
+}
+
+/**
+ * \ingroup applications-test
+ * \ingroup tests
+ *
+ * \brief VideoApplication TestSuite
+ */
+class VideoApplicationTestSuite : public TestSuite
+{
+  public:
+    VideoApplicationTestSuite();
+};
+
+VideoApplicationTestSuite::VideoApplicationTestSuite()
+    : TestSuite("video-application", UNIT)
+{
+    AddTestCase(new VideoApplicationTestCase("ns3::UdpSocketFactory"), TestCase::QUICK);
+    AddTestCase(new VideoApplicationTestCase("ns3::TcpSocketFactory"), TestCase::QUICK);
+}
+
+static VideoApplicationTestSuite
+    g_videoApplicationTestSuite; //!< Static variable for test initialization
@@ -19,12 +19,18 @@
 
 #include "default-simulator-impl.h"
 
+#include "abort.h"
 #include "assert.h"
+#include "boolean.h"
+#include "enum.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "string.h"
 
 #include <cmath>
+#include <fstream>
+#include <iostream>
 
 /**
  * \file
@@ -45,10 +51,33 @@ NS_OBJECT_ENSURE_REGISTERED(DefaultSimulatorImpl);
 TypeId
 DefaultSimulatorImpl::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
-                            .SetParent<SimulatorImpl>()
-                            .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+    static TypeId tid =
+        TypeId("ns3::DefaultSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<DefaultSimulatorImpl>()
+            .AddAttribute("ProfileEvents",
+                          "If true, the wall-clock time spent executing the events and the "
+                          "number of events are collected per event target and written at "
+                          "Simulator::Destroy.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&DefaultSimulatorImpl::m_profileEvents),
+                          MakeBooleanChecker())
+            .AddAttribute("ProfileOutputFile",
+                          "The name of the file the event profile is written to. The profile "
+                          "is printed on the standard output if empty.",
+                          StringValue(""),
+                          MakeStringAccessor(&DefaultSimulatorImpl::m_profileOutputFile),
+                          MakeStringChecker())
+            .AddAttribute("ProfileFormat",
+                          "The format of the event profile: a table sorted by decreasing total "
+                          "time or folded stacks suitable to generate flame graphs.",
+                          EnumValue(EventProfiler::TABLE),
+                          MakeEnumAccessor(&DefaultSimulatorImpl::m_profileFormat),
+                          MakeEnumChecker(EventProfiler::TABLE,
+                                          "Table",
+                                          EventProfiler::FOLDED,
+                                          "Folded"));
     return tid;
 }
 
@@ -62,13 +91,23 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
+    m_eventsWithContextTail = new EventWithContextNode;
+    m_eventsWithContextHead.store(m_eventsWithContextTail);
+    m_eventsWithContextEmpty.store(true);
     m_mainThreadId = std::this_thread::get_id();
+    m_profileEvents = false;
+    m_profileFormat = EventProfiler::TABLE;
 }
 
 DefaultSimulatorImpl::~DefaultSimulatorImpl()
 {
     NS_LOG_FUNCTION(this);
+    EventWithContext ev;
+    while (PopEventWithContext(ev))
+    {
+        ev.event->Unref();
+    }
+    delete m_eventsWithContextTail;
 }
 
 void
@@ -100,6 +139,29 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+    WriteEventProfile();
+}
+
+void
+DefaultSimulatorImpl::WriteEventProfile()
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_profileEvents)
+    {
+        return;
+    }
+    if (m_profileOutputFile.empty())
+    {
+        m_profiler.Write(std::cout, m_profileFormat);
+    }
+    else
+    {
+        std::ofstream ofs(m_profileOutputFile);
+        NS_ABORT_MSG_IF(!ofs.is_open(),
+                        "Unable to open event profile file " << m_profileOutputFile);
+        m_profiler.Write(ofs, m_profileFormat);
+    }
+    m_profiler.Clear();
 }
 
 void
@@ -141,7 +203,16 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profileEvents)
+    {
+        auto start = EventProfiler::Clock::now();
+        next.impl->Invoke();
+        m_profiler.Record(next.impl, EventProfiler::Clock::now() - start);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -154,24 +225,50 @@ DefaultSimulatorImpl::IsFinished() const
 }
 
 void
-DefaultSimulatorImpl::ProcessEventsWithContext()
+DefaultSimulatorImpl::PushEventWithContext(const EventWithContext& ev)
 {
-    if (m_eventsWithContextEmpty)
+    auto node = new EventWithContextNode;
+    node->event = ev;
+    EventWithContextNode* prev = m_eventsWithContextHead.exchange(node, std::memory_order_acq_rel);
+    // between the exchange above and the store below, the nodes pushed after this one
+    // are not reachable from the tail; they are popped once the link is published
+    prev->next.store(node, std::memory_order_release);
+    // a read-modify-write operation (rather than a store) extends the release sequence
+    // of the previous producers, so that the main thread sees all the published links
+    m_eventsWithContextEmpty.exchange(false, std::memory_order_release);
+}
+
+bool
+DefaultSimulatorImpl::PopEventWithContext(EventWithContext& ev)
+{
+    EventWithContextNode* tail = m_eventsWithContextTail;
+    EventWithContextNode* next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr)
     {
-        return;
+        return false;
     }
+    // the popped node becomes the new stub node
+    ev = next->event;
+    m_eventsWithContextTail = next;
+    delete tail;
+    return true;
+}
 
-    // swap queues
-    EventsWithContext eventsWithContext;
+void
+DefaultSimulatorImpl::ProcessEventsWithContext()
+{
+    if (m_eventsWithContextEmpty.load(std::memory_order_acquire))
     {
-        std::unique_lock lock{m_eventsWithContextMutex};
-        m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        return;
     }
-    while (!eventsWithContext.empty())
+
+    // A producer that is still linking its node clears the flag afterwards,
+    // hence its event is moved to the primary event queue at the next call
+    m_eventsWithContextEmpty.exchange(true, std::memory_order_acquire);
+
+    EventWithContext event;
+    while (PopEventWithContext(event))
     {
-        EventWithContext event = eventsWithContext.front();
-        eventsWithContext.pop_front();
         Scheduler::Event ev;
         ev.impl = event.event;
         ev.key.m_ts = m_currentTs + event.timestamp;
@@ -264,11 +361,7 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         // Current time added in ProcessEventsWithContext()
         ev.timestamp = delay.GetTimeStep();
         ev.event = event;
-        {
-            std::unique_lock lock{m_eventsWithContextMutex};
-            m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
-        }
+        PushEventWithContext(ev);
     }
 }
 
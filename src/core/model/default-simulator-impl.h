@@ -20,10 +20,12 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "event-profiler.h"
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
-#include <mutex>
+#include <string>
 #include <thread>
 
 /**
@@ -42,6 +44,11 @@ class Scheduler;
  * \ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * If the ProfileEvents attribute is set, the wall-clock time spent
+ * executing each event is attributed to the event target (see
+ * EventProfiler) and the resulting profile is written when
+ * Simulator::Destroy() is called.
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -83,6 +90,8 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Process the next event. */
     void ProcessOneEvent();
+    /** Write the event profile, if enabled, and reset it. */
+    void WriteEventProfile();
     /** Move events from a different context into the main event queue. */
     void ProcessEventsWithContext();
 
@@ -97,17 +106,48 @@ class DefaultSimulatorImpl : public SimulatorImpl
         EventImpl* event;
     };
 
-    /** Container type for the events from a different context. */
-    typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
+    /**
+     * Node of the queue of events from a different context.
+     *
+     * The queue is the intrusive multiple-producer single-consumer queue
+     * by D. Vyukov: producers only perform an atomic exchange on the head
+     * of the queue, hence ScheduleWithContext() never blocks, and the main
+     * thread pops the nodes from the tail without any synchronization other
+     * than acquiring the link to the next node.
+     */
+    struct EventWithContextNode
+    {
+        /** The event with context. */
+        EventWithContext event;
+        /** The next node in the queue (the node pushed after this one). */
+        std::atomic<EventWithContextNode*> next{nullptr};
+    };
+
+    /**
+     * Push an event with context into the queue of events from a different
+     * context. This method can be called concurrently by any thread.
+     *
+     * \param ev the event with context
+     */
+    void PushEventWithContext(const EventWithContext& ev);
+    /**
+     * Pop the oldest event with context from the queue of events from a
+     * different context. This method must only be called by the main thread.
+     *
+     * \param [out] ev the event with context
+     * \return true if an event was popped, false if the queue is empty
+     */
+    bool PopEventWithContext(EventWithContext& ev);
+
+    /** The most recently pushed node, updated by the producers. */
+    alignas(64) std::atomic<EventWithContextNode*> m_eventsWithContextHead;
+    /** The last popped node (initially a stub node), only used by the main thread. */
+    alignas(64) EventWithContextNode* m_eventsWithContextTail;
     /**
      * Flag \c true if all events with context have been moved to the
      * primary event queue.
      */
-    bool m_eventsWithContextEmpty;
-    /** Mutex to control access to the list of events with context. */
-    std::mutex m_eventsWithContextMutex;
+    std::atomic<bool> m_eventsWithContextEmpty;
 
     /** Container type for the events to run at Simulator::Destroy() */
     typedef std::list<EventId> DestroyEvents;
@@ -136,6 +176,15 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
+
+    /** Whether the wall-clock cost of the events is profiled. */
+    bool m_profileEvents;
+    /** The name of the file the event profile is written to (stdout if empty). */
+    std::string m_profileOutputFile;
+    /** The format of the event profile. */
+    EventProfiler::OutputFormat m_profileFormat;
+    /** The event profiler. */
+    EventProfiler m_profiler;
 };
 
 } // namespace ns3
@@ -67,4 +67,10 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+EventImpl::Target
+EventImpl::GetTarget() const
+{
+    return Target{};
+}
+
 } // namespace ns3
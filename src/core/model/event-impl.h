@@ -21,6 +21,8 @@
 
 #include "simple-ref-count.h"
 
+#include <array>
+#include <cstring>
 #include <stdint.h>
 
 /**
@@ -45,6 +47,15 @@ namespace ns3
 class EventImpl : public SimpleRefCount<EventImpl>
 {
   public:
+    /**
+     * Identity of the function invoked by an event, i.e., the bits of the
+     * function pointer or of the pointer to member function (all zero if the
+     * event invokes a function object). Member function pointers are two
+     * words long with the Itanium C++ ABI and up to three words long with
+     * the Microsoft ABI.
+     */
+    using Target = std::array<uintptr_t, 3>;
+
     /** Default constructor. */
     EventImpl();
     /** Destructor. */
@@ -66,8 +77,30 @@ class EventImpl : public SimpleRefCount<EventImpl>
      * Checked by the simulation engine before calling Invoke().
      */
     bool IsCancelled();
+    /**
+     * \returns the identity of the function invoked by this event.
+     *
+     * Used to attribute the cost of the events to their targets. The default
+     * implementation returns an all-zero Target.
+     */
+    virtual Target GetTarget() const;
 
   protected:
+    /**
+     * \tparam F \deduced The type of the function pointer or pointer to member
+     *            function.
+     * \param [in] function The function pointer or pointer to member function.
+     * \returns the identity of the given function.
+     */
+    template <typename F>
+    static Target MakeTarget(const F& function)
+    {
+        static_assert(sizeof(F) <= sizeof(Target), "Function pointer too large");
+        Target target{};
+        std::memcpy(target.data(), &function, sizeof(F));
+        return target;
+    }
+
     /**
      * Implementation for Invoke().
      *
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "event-profiler.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#if (__GNUC__ >= 3)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif
+
+#if __has_include(<dlfcn.h>)
+#include <dlfcn.h>
+#define NS3_EVENT_PROFILER_DLADDR
+#endif
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+namespace
+{
+
+/**
+ * \param mangled a mangled type name
+ * \return the demangled type name, if the ABI provides a demangler
+ */
+std::string
+DemangleTypeName(const char* mangled)
+{
+    std::string ret(mangled);
+#if (__GNUC__ >= 3)
+    int status;
+    char* demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+    if (status == 0 && demangled != nullptr)
+    {
+        ret = demangled;
+    }
+    std::free(demangled);
+#endif
+    return ret;
+}
+
+/**
+ * \param s a string
+ * \param start the position of an opening bracket (one of '<' or '(')
+ * \return the position of the matching closing bracket, or std::string::npos
+ */
+std::size_t
+FindClosingBracket(const std::string& s, std::size_t start)
+{
+    std::size_t depth = 0;
+    for (std::size_t i = start; i < s.size(); ++i)
+    {
+        if (s[i] == '<' || s[i] == '(')
+        {
+            ++depth;
+        }
+        else if (s[i] == '>' || s[i] == ')')
+        {
+            if (--depth == 0)
+            {
+                return i;
+            }
+        }
+    }
+    return std::string::npos;
+}
+
+} // namespace
+
+std::size_t
+EventProfiler::KeyHash::operator()(const Key& key) const
+{
+    std::size_t h = key.type.hash_code();
+    for (auto word : key.target)
+    {
+        h ^= std::hash<uintptr_t>{}(word) + 0x9e3779b9 + (h << 6) + (h >> 2);
+    }
+    return h;
+}
+
+void
+EventProfiler::Record(const EventImpl* event, Clock::duration elapsed)
+{
+    auto& entry = m_entries[Key{std::type_index(typeid(*event)), event->GetTarget()}];
+    entry.count++;
+    entry.total += elapsed;
+    entry.max = std::max(entry.max, elapsed);
+}
+
+void
+EventProfiler::Clear()
+{
+    m_entries.clear();
+}
+
+uint64_t
+EventProfiler::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& [type, entry] : m_entries)
+    {
+        count += entry.count;
+    }
+    return count;
+}
+
+EventProfiler::Clock::duration
+EventProfiler::GetTotalTime() const
+{
+    auto total = Clock::duration::zero();
+    for (const auto& [type, entry] : m_entries)
+    {
+        total += entry.total;
+    }
+    return total;
+}
+
+std::pair<std::string, std::string>
+EventProfiler::GetEventTarget(const std::type_index& type)
+{
+    std::string name = DemangleTypeName(type.name());
+
+    // Events created by MakeEvent are instances of classes local to a MakeEvent
+    // specialization, whose first function parameter is the callback
+    auto pos = name.find("MakeEvent<");
+    if (pos == std::string::npos)
+    {
+        return {name, name};
+    }
+    auto close = FindClosingBracket(name, pos + std::string("MakeEvent").size());
+    if (close == std::string::npos || close + 1 >= name.size() || name[close + 1] != '(')
+    {
+        return {name, name};
+    }
+    auto paramsEnd = FindClosingBracket(name, close + 1);
+    if (paramsEnd == std::string::npos)
+    {
+        return {name, name};
+    }
+    std::string args = name.substr(close + 2, paramsEnd - close - 2);
+    std::size_t depth = 0;
+    std::size_t end = 0;
+    for (; end < args.size(); ++end)
+    {
+        if (args[end] == '<' || args[end] == '(')
+        {
+            ++depth;
+        }
+        else if (args[end] == '>' || args[end] == ')')
+        {
+            --depth;
+        }
+        else if (args[end] == ',' && depth == 0)
+        {
+            break;
+        }
+    }
+    std::string callback = args.substr(0, end);
+
+    // pointer to member function: "R (C::*)(Args...)"
+    if (auto memPtr = callback.find("::*)"); memPtr != std::string::npos)
+    {
+        auto classStart = callback.rfind('(', memPtr);
+        if (classStart != std::string::npos)
+        {
+            return {callback.substr(classStart + 1, memPtr - classStart - 1), callback};
+        }
+    }
+    // pointer to function: "R (*)(Args...)"
+    if (callback.find("(*)") != std::string::npos)
+    {
+        return {"function", callback};
+    }
+    // lambda or other function object
+    return {"functor", callback};
+}
+
+std::string
+EventProfiler::GetFunctionName(const EventImpl::Target& target)
+{
+    if (target == EventImpl::Target{})
+    {
+        return "";
+    }
+    // The first word is the address of the function, except for pointers to
+    // virtual member functions, for which no symbol is found
+    auto address = target[0];
+#ifdef NS3_EVENT_PROFILER_DLADDR
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void*>(address), &info) != 0 && info.dli_sname != nullptr &&
+        reinterpret_cast<uintptr_t>(info.dli_saddr) == address)
+    {
+        return DemangleTypeName(info.dli_sname);
+    }
+#endif
+    std::ostringstream oss;
+    oss << "0x" << std::hex << address;
+    for (std::size_t i = 1; i < target.size(); ++i)
+    {
+        if (target[i] != 0)
+        {
+            oss << "+0x" << target[i];
+        }
+    }
+    return oss.str();
+}
+
+void
+EventProfiler::Write(std::ostream& os, OutputFormat format) const
+{
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+
+    /// Statistics of an event type, along with its description
+    struct Row
+    {
+        std::string cls;      //!< class owning the event target
+        std::string callback; //!< callback type
+        std::string function; //!< invoked function
+        Entry entry;          //!< collected statistics
+    };
+
+    std::vector<Row> rows;
+    rows.reserve(m_entries.size());
+    for (const auto& [key, entry] : m_entries)
+    {
+        auto [cls, callback] = GetEventTarget(key.type);
+        rows.push_back({cls, callback, GetFunctionName(key.target), entry});
+    }
+    std::sort(rows.begin(), rows.end(), [](const Row& a, const Row& b) {
+        return a.entry.total > b.entry.total;
+    });
+
+    if (format == FOLDED)
+    {
+        for (const auto& row : rows)
+        {
+            // ';' separates frames and the last space separates the value
+            std::string callback = row.callback;
+            std::string function = row.function;
+            std::replace(callback.begin(), callback.end(), ';', ',');
+            std::replace(function.begin(), function.end(), ';', ',');
+            std::string frames = function.empty() ? callback : callback + ";" + function;
+            std::replace(frames.begin(), frames.end(), ' ', '_');
+            os << "Simulator;" << row.cls << ";" << frames << " "
+               << duration_cast<nanoseconds>(row.entry.total).count() << "\n";
+        }
+        os.flush();
+        return;
+    }
+
+    auto total = GetTotalTime();
+    auto totalNs = static_cast<double>(duration_cast<nanoseconds>(total).count());
+
+    os << "Event profile: " << GetEventCount() << " events, " << std::fixed
+       << std::setprecision(6) << totalNs / 1e9 << " s" << std::endl;
+    os << std::setw(12) << "total(s)" << std::setw(8) << "%" << std::setw(12) << "count"
+       << std::setw(12) << "mean(us)" << std::setw(12) << "max(us)"
+       << "  target" << std::endl;
+    for (const auto& row : rows)
+    {
+        auto ns = static_cast<double>(duration_cast<nanoseconds>(row.entry.total).count());
+        os << std::fixed << std::setprecision(6) << std::setw(12) << ns / 1e9
+           << std::setprecision(2) << std::setw(8) << (totalNs > 0 ? 100 * ns / totalNs : 0)
+           << std::setw(12) << row.entry.count << std::setprecision(3) << std::setw(12)
+           << ns / 1e3 / row.entry.count << std::setw(12)
+           << duration_cast<nanoseconds>(row.entry.max).count() / 1e3 << "  " << row.cls
+           << " [" << row.callback << "] " << row.function << std::endl;
+    }
+    os << std::defaultfloat;
+}
+
+} // namespace ns3
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include "event-impl.h"
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * \file
+ * \ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * \ingroup simulator
+ *
+ * \brief Wall-clock cost breakdown of the executed simulation events.
+ *
+ * The profiler attributes the wall-clock time spent in EventImpl::Invoke()
+ * and the number of invocations to the target of each event.  The target is
+ * identified by the dynamic type of the EventImpl, which MakeEvent()
+ * instantiates once per (callback type, object type, argument types)
+ * combination, and by the function or member function that is invoked (see
+ * EventImpl::GetTarget()), so that member functions of the same class with
+ * the same signature are accounted for separately.  The demangled type name
+ * reveals the class owning the member function that is invoked (e.g.,
+ * \c ns3::InterferenceHelper) and the signature of that member function,
+ * while the function itself is named after its symbol, if it can be found
+ * in the dynamic symbol table, or after its address otherwise.
+ *
+ * Unlike DesMetrics, which records the causality between events, this
+ * class only accumulates costs, hence it can be left enabled for long runs.
+ *
+ * The collected data can be written either as a table sorted by decreasing
+ * total time or in the "folded stacks" format understood by flamegraph.pl
+ * and speedscope, where each line has the form
+ * \verbatim
+   Simulator;<class>;<callback>;<function> <nanoseconds>
+   \endverbatim
+ */
+class EventProfiler
+{
+  public:
+    /** Output formats */
+    enum OutputFormat
+    {
+        TABLE = 0,
+        FOLDED
+    };
+
+    /** Clock used to measure the duration of the events */
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Account for the execution of the given event.
+     *
+     * \param event the event that has been invoked
+     * \param elapsed the wall-clock time spent invoking the event
+     */
+    void Record(const EventImpl* event, Clock::duration elapsed);
+
+    /**
+     * Write the collected statistics.
+     *
+     * \param os the output stream
+     * \param format the output format
+     */
+    void Write(std::ostream& os, OutputFormat format) const;
+
+    /** Discard all the collected statistics. */
+    void Clear();
+
+    /**
+     * \return the total number of events accounted for
+     */
+    uint64_t GetEventCount() const;
+
+    /**
+     * \return the total wall-clock time spent invoking events
+     */
+    Clock::duration GetTotalTime() const;
+
+    /**
+     * Get a human readable name for the target of the events whose
+     * implementation has the given dynamic type.
+     *
+     * \param type the dynamic type of an EventImpl subclass
+     * \return a pair (owning class, callback) describing the event target
+     */
+    static std::pair<std::string, std::string> GetEventTarget(const std::type_index& type);
+
+    /**
+     * Get a human readable name for the function invoked by an event.
+     *
+     * \param target the identity of the function, as returned by EventImpl::GetTarget()
+     * \return the demangled symbol name of the function, if found, its address
+     *         otherwise, or an empty string if the event invokes a function object
+     */
+    static std::string GetFunctionName(const EventImpl::Target& target);
+
+  private:
+    /** Identity of an event target: the dynamic type of the event and the invoked function */
+    struct Key
+    {
+        std::type_index type;     //!< dynamic type of the EventImpl
+        EventImpl::Target target; //!< identity of the invoked function
+
+        /**
+         * \param other another key
+         * \return true if the keys are equal
+         */
+        bool operator==(const Key& other) const
+        {
+            return type == other.type && target == other.target;
+        }
+    };
+
+    /** Hash function for Key */
+    struct KeyHash
+    {
+        /**
+         * \param key the key
+         * \return the hash of the key
+         */
+        std::size_t operator()(const Key& key) const;
+    };
+
+    /** Statistics collected for one event target */
+    struct Entry
+    {
+        uint64_t count{0};                              //!< number of invocations
+        Clock::duration total{Clock::duration::zero()}; //!< total time spent
+        Clock::duration max{Clock::duration::zero()};   //!< longest invocation
+    };
+
+    std::unordered_map<Key, Entry, KeyHash> m_entries; //!< per event target statistics
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
@@ -58,6 +58,11 @@ MakeEvent(void (*f)())
             (*m_function)();
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
       private:
         F m_function;
     }* ev = new EventFunctionImpl0(f);
@@ -416,6 +416,11 @@ MakeEvent(MEM mem_ptr, OBJ obj)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)();
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
     }* ev = new EventMemberImpl0(obj, mem_ptr);
@@ -449,6 +454,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -484,6 +494,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1, m_a2);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -521,6 +536,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3)
             (EventMemberImplObjTraits<OBJ>::GetReference(m_obj).*m_function)(m_a1, m_a2, m_a3);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -561,6 +581,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4)
              m_function)(m_a1, m_a2, m_a3, m_a4);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -609,6 +634,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4, T5 a5)
              m_function)(m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -660,6 +690,11 @@ MakeEvent(MEM mem_ptr, OBJ obj, T1 a1, T2 a2, T3 a3, T4 a4, T5 a5, T6 a6)
              m_function)(m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         OBJ m_obj;
         MEM m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
@@ -700,6 +735,11 @@ MakeEvent(void (*f)(U1), T1 a1)
             (*m_function)(m_a1);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
     }* ev = new EventFunctionImpl1(f, a1);
@@ -735,6 +775,11 @@ MakeEvent(void (*f)(U1, U2), T1 a1, T2 a2)
             (*m_function)(m_a1, m_a2);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -772,6 +817,11 @@ MakeEvent(void (*f)(U1, U2, U3), T1 a1, T2 a2, T3 a3)
             (*m_function)(m_a1, m_a2, m_a3);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -818,6 +868,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4), T1 a1, T2 a2, T3 a3, T4 a4)
             (*m_function)(m_a1, m_a2, m_a3, m_a4);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -868,6 +923,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4, U5), T1 a1, T2 a2, T3 a3, T4 a4, T5 a5)
             (*m_function)(m_a1, m_a2, m_a3, m_a4, m_a5);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
@@ -922,6 +982,11 @@ MakeEvent(void (*f)(U1, U2, U3, U4, U5, U6), T1 a1, T2 a2, T3 a3, T4 a4, T5 a5,
             (*m_function)(m_a1, m_a2, m_a3, m_a4, m_a5, m_a6);
         }
 
+        Target GetTarget() const override
+        {
+            return MakeTarget(m_function);
+        }
+
         F m_function;
         typename TypeTraits<T1>::ReferencedType m_a1;
         typename TypeTraits<T2>::ReferencedType m_a2;
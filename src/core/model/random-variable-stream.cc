@@ -33,6 +33,7 @@
 #include "rng-seed-manager.h"
 #include "rng-stream.h"
 #include "string.h"
+#include "uinteger.h"
 
 #include <algorithm> // upper_bound
 #include <cmath>
@@ -72,12 +73,22 @@ RandomVariableStream::GetTypeId()
                                           BooleanValue(false),
                                           MakeBooleanAccessor(&RandomVariableStream::SetAntithetic,
                                                               &RandomVariableStream::IsAntithetic),
-                                          MakeBooleanChecker());
+                                          MakeBooleanChecker())
+                            .AddAttribute("BatchSize",
+                                          "The number of uniform randoms generated at once and "
+                                          "buffered by this RNG stream (0 to disable batching). "
+                                          "Batching does not change the values returned.",
+                                          UintegerValue(0),
+                                          MakeUintegerAccessor(&RandomVariableStream::SetBatchSize,
+                                                               &RandomVariableStream::GetBatchSize),
+                                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
 RandomVariableStream::RandomVariableStream()
-    : m_rng(nullptr)
+    : m_rng(nullptr),
+      m_batchSize(0),
+      m_batchIndex(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -116,6 +127,9 @@ RandomVariableStream::SetStream(int64_t stream)
     // negative values are not legal.
     NS_ASSERT(stream >= -1);
     delete m_rng;
+    // the buffered randoms belong to the previous RngStream
+    m_batch.clear();
+    m_batchIndex = 0;
     if (stream == -1)
     {
         // The first 2^63 streams are reserved for automatic stream
@@ -149,6 +163,37 @@ RandomVariableStream::Peek() const
     return m_rng;
 }
 
+void
+RandomVariableStream::SetBatchSize(uint32_t batchSize)
+{
+    NS_LOG_FUNCTION(this << batchSize);
+    // randoms already in the buffer are still served first, so that the
+    // sequence of values is not altered
+    m_batchSize = batchSize;
+}
+
+uint32_t
+RandomVariableStream::GetBatchSize() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_batchSize;
+}
+
+double
+RandomVariableStream::RefillBatch()
+{
+    if (m_batchSize == 0)
+    {
+        m_batch.clear();
+        m_batchIndex = 0;
+        return m_rng->RandU01();
+    }
+    m_batch.resize(m_batchSize);
+    m_rng->RandU01(m_batch.data(), m_batch.size());
+    m_batchIndex = 1;
+    return m_batch[0];
+}
+
 NS_OBJECT_ENSURE_REGISTERED(UniformRandomVariable);
 
 TypeId
@@ -196,7 +241,7 @@ double
 UniformRandomVariable::GetValue(double min, double max)
 {
     NS_LOG_FUNCTION(this << min << max);
-    double v = min + Peek()->RandU01() * (max - min);
+    double v = min + RandU01() * (max - min);
     if (IsAntithetic())
     {
         v = min + (max - v);
@@ -424,7 +469,7 @@ ExponentialRandomVariable::GetValue(double mean, double bound)
     while (true)
     {
         // Get a uniform random variable in [0,1].
-        double v = Peek()->RandU01();
+        double v = RandU01();
         if (IsAntithetic())
         {
             v = (1 - v);
@@ -523,7 +568,7 @@ ParetoRandomVariable::GetValue(double scale, double shape, double bound)
     while (true)
     {
         // Get a uniform random variable in [0,1].
-        double v = Peek()->RandU01();
+        double v = RandU01();
         if (IsAntithetic())
         {
             v = (1 - v);
@@ -620,7 +665,7 @@ WeibullRandomVariable::GetValue(double scale, double shape, double bound)
     while (true)
     {
         // Get a uniform random variable in [0,1].
-        double v = Peek()->RandU01();
+        double v = RandU01();
         if (IsAntithetic())
         {
             v = (1 - v);
@@ -728,8 +773,8 @@ NormalRandomVariable::GetValue(double mean, double variance, double bound)
     { // See Simulation Modeling and Analysis p. 466 (Averill Law)
         // for algorithm; basically a Box-Muller transform:
         // http://en.wikipedia.org/wiki/Box-Muller_transform
-        double u1 = Peek()->RandU01();
-        double u2 = Peek()->RandU01();
+        double u1 = RandU01();
+        double u2 = RandU01();
         if (IsAntithetic())
         {
             u1 = (1 - u1);
@@ -872,8 +917,8 @@ LogNormalRandomVariable::GetValue(double mu, double sigma)
     {
         /* choose x,y in uniform square (-1,-1) to (+1,+1) */
 
-        double u1 = Peek()->RandU01();
-        double u2 = Peek()->RandU01();
+        double u1 = RandU01();
+        double u2 = RandU01();
         if (IsAntithetic())
         {
             u1 = (1 - u1);
@@ -978,7 +1023,7 @@ GammaRandomVariable::GetValue(double alpha, double beta)
     NS_LOG_FUNCTION(this << alpha << beta);
     if (alpha < 1)
     {
-        double u = Peek()->RandU01();
+        double u = RandU01();
         if (IsAntithetic())
         {
             u = (1 - u);
@@ -1007,7 +1052,7 @@ GammaRandomVariable::GetValue(double alpha, double beta)
         } while (v <= 0);
 
         v = v * v * v;
-        u = Peek()->RandU01();
+        u = RandU01();
         if (IsAntithetic())
         {
             u = (1 - u);
@@ -1049,8 +1094,8 @@ GammaRandomVariable::GetNormalValue(double mean, double variance, double bound)
     { // See Simulation Modeling and Analysis p. 466 (Averill Law)
         // for algorithm; basically a Box-Muller transform:
         // http://en.wikipedia.org/wiki/Box-Muller_transform
-        double u1 = Peek()->RandU01();
-        double u2 = Peek()->RandU01();
+        double u1 = RandU01();
+        double u2 = RandU01();
         if (IsAntithetic())
         {
             u1 = (1 - u1);
@@ -1176,7 +1221,7 @@ ErlangRandomVariable::GetExponentialValue(double mean, double bound)
     while (true)
     {
         // Get a uniform random variable in [0,1].
-        double v = Peek()->RandU01();
+        double v = RandU01();
         if (IsAntithetic())
         {
             v = (1 - v);
@@ -1258,7 +1303,7 @@ TriangularRandomVariable::GetValue(double mean, double min, double max)
     double mode = 3.0 * mean - min - max;
 
     // Get a uniform random variable in [0,1].
-    double u = Peek()->RandU01();
+    double u = RandU01();
     if (IsAntithetic())
     {
         u = (1 - u);
@@ -1345,7 +1390,7 @@ ZipfRandomVariable::GetValue(uint32_t n, double alpha)
     m_c = 1.0 / m_c;
 
     // Get a uniform random variable in [0,1].
-    double u = Peek()->RandU01();
+    double u = RandU01();
     if (IsAntithetic())
     {
         u = (1 - u);
@@ -1425,14 +1470,14 @@ ZetaRandomVariable::GetValue(double alpha)
     do
     {
         // Get a uniform random variable in [0,1].
-        u = Peek()->RandU01();
+        u = RandU01();
         if (IsAntithetic())
         {
             u = (1 - u);
         }
 
         // Get a uniform random variable in [0,1].
-        v = Peek()->RandU01();
+        v = RandU01();
         if (IsAntithetic())
         {
             v = (1 - v);
@@ -1577,7 +1622,7 @@ EmpiricalRandomVariable::PreSample(double& value)
     }
 
     // Get a uniform random variable in [0, 1].
-    double r = Peek()->RandU01();
+    double r = RandU01();
     if (IsAntithetic())
     {
         r = (1 - r);
@@ -31,6 +31,7 @@
 
 #include <map>
 #include <stdint.h>
+#include <vector>
 
 /**
  * \file
@@ -153,17 +154,76 @@ class RandomVariableStream : public Object
     // The base implementation returns `(uint32_t)GetValue()`
     virtual uint32_t GetInteger();
 
+    /**
+     * \brief Set the number of uniform randoms generated at once.
+     *
+     * If \pname{batchSize} is not zero, the uniform randoms are generated
+     * \pname{batchSize} at a time and stored in a buffer owned by this RNG
+     * stream, from which the subsequent draws are served. The values drawn
+     * are the same as with no batching, in the same order. No state is
+     * shared among RNG streams, hence distinct RNG streams can still be
+     * used by distinct threads.
+     *
+     * \param [in] batchSize The number of uniform randoms generated at once,
+     * or zero to generate them one at a time.
+     */
+    void SetBatchSize(uint32_t batchSize);
+
+    /**
+     * \brief Get the number of uniform randoms generated at once.
+     * \return The number of uniform randoms generated at once (zero if disabled).
+     */
+    uint32_t GetBatchSize() const;
+
   protected:
     /**
      * \brief Get the pointer to the underlying RngStream.
+     *
+     * \note Randoms drawn directly from the RngStream bypass the buffer
+     * filled when batching is enabled (see SetBatchSize()), hence derived
+     * classes should use RandU01() instead.
+     *
      * \return The underlying RngStream
      */
     RngStream* Peek() const;
 
+    /**
+     * \brief Get the next uniform random in [0,1) of this RNG stream.
+     *
+     * The random is served from the buffer of pre-generated randoms, if
+     * batching is enabled, or drawn from the underlying RngStream otherwise.
+     *
+     * \return The next uniform random.
+     */
+    double RandU01()
+    {
+        if (m_batchIndex < m_batch.size())
+        {
+            return m_batch[m_batchIndex++];
+        }
+        return RefillBatch();
+    }
+
   private:
+    /**
+     * \brief Draw the next uniform random once the buffer has been exhausted,
+     * refilling the buffer first if batching is enabled.
+     * \return The next uniform random.
+     */
+    double RefillBatch();
+
     /** Pointer to the underlying RngStream. */
     RngStream* m_rng;
 
+    /** The number of uniform randoms generated at once (zero if disabled). */
+    uint32_t m_batchSize;
+
+    /** The buffer of pre-generated uniform randoms. */
+    std::vector<double> m_batch;
+
+    /** The index of the next uniform random to serve from the buffer. */
+    std::size_t m_batchIndex;
+
     /** Indicates if antithetic values should be generated by this RNG stream. */
     bool m_isAntithetic;
 
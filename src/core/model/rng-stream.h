@@ -18,6 +18,7 @@
 
 #ifndef RNGSTREAM_H
 #define RNGSTREAM_H
+#include <cstddef>
 #include <stdint.h>
 #include <string>
 
@@ -70,6 +71,18 @@ class RngStream
      * \returns The next random.
      */
     double RandU01();
+    /**
+     * Generate the next \pname{n} random numbers for this stream, i.e., the
+     * same values as \pname{n} consecutive calls to RandU01(), in order.
+     *
+     * The state is kept in local variables for the whole batch, which lets
+     * the compiler interleave the independent computations of the two
+     * components of the generator.
+     *
+     * \param [out] values The array to fill with \pname{n} random numbers.
+     * \param [in] n The number of random numbers to generate.
+     */
+    void RandU01(double* values, std::size_t n);
 
   private:
     /**
@@ -37,7 +37,8 @@ Timer::Timer()
     : m_flags(CHECK_ON_DESTROY),
       m_delay(FemtoSeconds(0)),
       m_event(),
-      m_impl(nullptr)
+      m_impl(nullptr),
+      m_end(FemtoSeconds(0))
 {
     NS_LOG_FUNCTION(this);
 }
@@ -46,7 +47,8 @@ Timer::Timer(DestroyPolicy destroyPolicy)
     : m_flags(destroyPolicy),
       m_delay(FemtoSeconds(0)),
       m_event(),
-      m_impl(nullptr)
+      m_impl(nullptr),
+      m_end(FemtoSeconds(0))
 {
     NS_LOG_FUNCTION(this << destroyPolicy);
 }
@@ -93,6 +95,10 @@ Timer::GetDelayLeft() const
     switch (GetState())
     {
     case Timer::RUNNING:
+        if (m_flags & TIMER_RESCHEDULED)
+        {
+            return m_end - Simulator::Now();
+        }
         return Simulator::GetDelayLeft(m_event);
     case Timer::EXPIRED:
         return TimeStep(0);
@@ -175,6 +181,49 @@ Timer::Schedule(Time delay)
         NS_FATAL_ERROR("Event is still running while re-scheduling.");
     }
     m_event = m_impl->Schedule(delay);
+    m_flags &= ~TIMER_RESCHEDULED;
+}
+
+void
+Timer::Reschedule()
+{
+    NS_LOG_FUNCTION(this);
+    Reschedule(m_delay);
+}
+
+void
+Timer::Reschedule(Time delay)
+{
+    NS_LOG_FUNCTION(this << delay);
+    NS_ASSERT(m_impl != nullptr);
+    Time end = Simulator::Now() + delay;
+    if (IsRunning())
+    {
+        if ((m_flags & TIMER_RESCHEDULED) && end >= m_end)
+        {
+            // Expire() will reschedule itself to be executed at the correct time
+            m_end = end;
+            return;
+        }
+        m_event.Remove();
+    }
+    m_end = end;
+    m_event = Simulator::Schedule(delay, &Timer::Expire, this);
+    m_flags |= TIMER_RESCHEDULED;
+}
+
+void
+Timer::Expire()
+{
+    NS_LOG_FUNCTION(this);
+    Time now = Simulator::Now();
+    if (m_end > now)
+    {
+        m_event = Simulator::Schedule(m_end - now, &Timer::Expire, this);
+        return;
+    }
+    m_flags &= ~TIMER_RESCHEDULED;
+    m_impl->Invoke();
 }
 
 void
@@ -182,7 +231,7 @@ Timer::Suspend()
 {
     NS_LOG_FUNCTION(this);
     NS_ASSERT(IsRunning());
-    m_delayLeft = Simulator::GetDelayLeft(m_event);
+    m_delayLeft = GetDelayLeft();
     if (m_flags & CANCEL_ON_DESTROY)
     {
         m_event.Cancel();
@@ -200,7 +249,7 @@ Timer::Resume()
     NS_LOG_FUNCTION(this);
     NS_ASSERT(m_flags & TIMER_SUSPENDED);
     m_event = m_impl->Schedule(m_delayLeft);
-    m_flags &= ~TIMER_SUSPENDED;
+    m_flags &= ~(TIMER_SUSPENDED | TIMER_RESCHEDULED);
 }
 
 } // namespace ns3
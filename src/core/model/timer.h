@@ -45,7 +45,7 @@ namespace ns3
  * when it is destroyed.
  *
  * A Timer can be suspended, resumed, cancelled and queried for time left,
- * but it can't be extended (except by suspending and resuming).
+ * and it can be rescheduled to expire earlier or later than planned.
  * In addition, it can be configured to take different actions when the
  * Timer is destroyed.
  */
@@ -61,8 +61,9 @@ class TimerImpl;
  * when the delay expires.
  *
  * A Timer can be suspended, resumed, cancelled and queried for the
- * time left, but it can't be extended (except by suspending and
- * resuming).
+ * time left. A running timer can be rescheduled (see Reschedule()),
+ * which is cheaper than cancelling and scheduling it again, because
+ * no cancelled event is left in the simulator event queue.
  *
  * A timer can also be used to enforce a set of predefined event lifetime
  * management policies. These policies are specified at construction time
@@ -212,6 +213,27 @@ class Timer
      */
     void Schedule(Time delay);
 
+    /**
+     * Reschedule the timer to expire after the currently-configured delay.
+     */
+    void Reschedule();
+    /**
+     * \param [in] delay the delay to use
+     *
+     * Reschedule the timer to expire after the specified delay, as if it
+     * were cancelled and scheduled again, but without leaving a cancelled
+     * event in the simulator event queue. If the timer is running and the
+     * new expiration time is not earlier than the current one, the event
+     * already in the event queue is kept and, when it expires, it schedules
+     * itself again for the remaining time; this way, a timer that is
+     * continuously postponed (e.g., an inactivity timer) only generates
+     * one event per expiration of the original delay. Otherwise, the event
+     * is removed from the event queue and a new event is inserted.
+     *
+     * If the timer is not running, this is equivalent to Schedule(delay).
+     */
+    void Reschedule(Time delay);
+
     /**
      * Pause the timer and save the amount of time left until it was
      * set to expire.
@@ -235,6 +257,14 @@ class Timer
   private:
     /** Internal bit marking the suspended timer state */
     static constexpr auto TIMER_SUSPENDED{1 << 7};
+    /** Internal bit marking that the scheduled event is Expire() */
+    static constexpr auto TIMER_RESCHEDULED{1 << 8};
+
+    /**
+     * Invoke the function, if the expiration time has been reached,
+     * or schedule itself again for the remaining time.
+     */
+    void Expire();
 
     /**
      * Bitfield for Timer State, DestroyPolicy and InternalSuspended.
@@ -257,6 +287,8 @@ class Timer
     TimerImpl* m_impl;
     /** The amount of time left on the Timer while it is suspended. */
     Time m_delayLeft;
+    /** The expiration time of a rescheduled Timer. */
+    Time m_end;
 };
 
 } // namespace ns3
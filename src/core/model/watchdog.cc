@@ -32,9 +32,7 @@ namespace ns3
 NS_LOG_COMPONENT_DEFINE("Watchdog");
 
 Watchdog::Watchdog()
-    : m_impl(nullptr),
-      m_event(),
-      m_end(MicroSeconds(0))
+    : m_timer(Timer::CANCEL_ON_DESTROY)
 {
     NS_LOG_FUNCTION_NOARGS();
 }
@@ -42,35 +40,18 @@ Watchdog::Watchdog()
 Watchdog::~Watchdog()
 {
     NS_LOG_FUNCTION(this);
-    m_event.Cancel();
-    delete m_impl;
 }
 
 void
 Watchdog::Ping(Time delay)
 {
     NS_LOG_FUNCTION(this << delay);
-    Time end = Simulator::Now() + delay;
-    m_end = std::max(m_end, end);
-    if (m_event.IsRunning())
+    // the watchdog can only be lengthened
+    if (m_timer.IsRunning() && delay <= m_timer.GetDelayLeft())
     {
         return;
     }
-    m_event = Simulator::Schedule(m_end - Now(), &Watchdog::Expire, this);
-}
-
-void
-Watchdog::Expire()
-{
-    NS_LOG_FUNCTION(this);
-    if (m_end == Simulator::Now())
-    {
-        m_impl->Invoke();
-    }
-    else
-    {
-        m_event = Simulator::Schedule(m_end - Now(), &Watchdog::Expire, this);
-    }
+    m_timer.Reschedule(delay);
 }
 
 } // namespace ns3
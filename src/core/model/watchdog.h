@@ -19,8 +19,8 @@
 #ifndef WATCHDOG_H
 #define WATCHDOG_H
 
-#include "event-id.h"
 #include "nstime.h"
+#include "timer.h"
 
 /**
  * \file
@@ -31,8 +31,6 @@
 namespace ns3
 {
 
-class TimerImpl;
-
 /**
  * \ingroup timer
  * \brief A very simple watchdog operating in virtual time.
@@ -51,6 +49,10 @@ class TimerImpl;
  * If you don't ping the watchdog sufficiently often, it triggers its
  * listening function.
  *
+ * The watchdog is implemented by a Timer that is rescheduled (see
+ * Timer::Reschedule()) when the watchdog is lengthened, so that pinging
+ * the watchdog does not add events to the simulator event queue.
+ *
  * \see Timer for a more sophisticated general purpose timer.
  */
 class Watchdog
@@ -109,17 +111,8 @@ class Watchdog
     /**@}*/
 
   private:
-    /** Internal callback invoked when the timer expires. */
-    void Expire();
-    /**
-     * The timer implementation, which contains the bound callback
-     * function and arguments.
-     */
-    TimerImpl* m_impl;
-    /** The future event scheduled to expire the timer. */
-    EventId m_event;
-    /** The absolute time when the timer will expire. */
-    Time m_end;
+    /** The timer invoking the bound callback function when the watchdog expires. */
+    Timer m_timer;
 };
 
 } // namespace ns3
@@ -128,8 +121,6 @@ class Watchdog
  *  Implementation of the templates declared above.
  ********************************************************************/
 
-#include "timer-impl.h"
-
 namespace ns3
 {
 
@@ -137,28 +128,21 @@ template <typename FN>
 void
 Watchdog::SetFunction(FN fn)
 {
-    delete m_impl;
-    m_impl = MakeTimerImpl(fn);
+    m_timer.SetFunction(fn);
 }
 
 template <typename MEM_PTR, typename OBJ_PTR>
 void
 Watchdog::SetFunction(MEM_PTR memPtr, OBJ_PTR objPtr)
 {
-    delete m_impl;
-    m_impl = MakeTimerImpl(memPtr, objPtr);
+    m_timer.SetFunction(memPtr, objPtr);
 }
 
 template <typename... Ts>
 void
 Watchdog::SetArguments(Ts&&... args)
 {
-    if (m_impl == nullptr)
-    {
-        NS_FATAL_ERROR("You cannot set the arguments of a Watchdog before setting its function.");
-        return;
-    }
-    m_impl->SetArgs(std::forward<Ts>(args)...);
+    m_timer.SetArguments(std::forward<Ts>(args)...);
 }
 
 } // namespace ns3
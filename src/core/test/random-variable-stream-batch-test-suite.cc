@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/double.h"
+#include "ns3/integer.h"
+#include "ns3/object-factory.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <string>
+
+/**
+ * \file
+ * \ingroup core-tests
+ * \ingroup randomvariable
+ * \ingroup randomvariable-tests
+ * Tests for the batched generation of uniform randoms by random variable streams.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * \ingroup randomvariable-tests
+ * Test case checking that batching the uniform randoms does not change the values
+ * returned by a random variable stream.
+ *
+ * Two random variables of the given type are created with the same stream number, one
+ * of which has batching enabled. The values returned by the two random variables must
+ * be identical, including after the batch size is changed or batching is disabled and
+ * after the stream number is changed.
+ */
+class RandomVariableStreamBatchTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param typeId the TypeId of the random variable
+     */
+    RandomVariableStreamBatchTestCase(const std::string& typeId);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check that the given random variables return the same values.
+     *
+     * \param reference the random variable without batching
+     * \param batched the random variable with batching
+     * \param count the number of values to compare
+     * \param phase a description of the current phase of the test
+     */
+    void CheckSameValues(Ptr<RandomVariableStream> reference,
+                         Ptr<RandomVariableStream> batched,
+                         uint32_t count,
+                         const std::string& phase);
+
+    std::string m_typeId; //!< the TypeId of the random variable
+};
+
+RandomVariableStreamBatchTestCase::RandomVariableStreamBatchTestCase(const std::string& typeId)
+    : TestCase("Check that batching does not change the values returned by a " + typeId),
+      m_typeId(typeId)
+{
+}
+
+void
+RandomVariableStreamBatchTestCase::CheckSameValues(Ptr<RandomVariableStream> reference,
+                                                   Ptr<RandomVariableStream> batched,
+                                                   uint32_t count,
+                                                   const std::string& phase)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        // compare the bit patterns, not just the values within a tolerance
+        const auto expected = reference->GetValue();
+        const auto actual = batched->GetValue();
+        NS_TEST_ASSERT_MSG_EQ(actual, expected, "Value " << i << " differs " << phase);
+    }
+}
+
+void
+RandomVariableStreamBatchTestCase::DoRun()
+{
+    ObjectFactory factory(m_typeId);
+    factory.Set("Stream", IntegerValue(42));
+    auto reference = factory.Create<RandomVariableStream>();
+    factory.Set("BatchSize", UintegerValue(7));
+    auto batched = factory.Create<RandomVariableStream>();
+    NS_TEST_ASSERT_MSG_EQ(batched->GetBatchSize(), 7, "Unexpected batch size");
+
+    CheckSameValues(reference, batched, 1000, "with a batch size of 7");
+
+    // a new batch size is used when the buffer is refilled
+    batched->SetBatchSize(256);
+    CheckSameValues(reference, batched, 1000, "after setting a batch size of 256");
+
+    // buffered values are served before randoms are drawn one at a time
+    batched->SetBatchSize(0);
+    CheckSameValues(reference, batched, 1000, "after disabling batching");
+
+    // the buffered values are dropped when the stream changes
+    batched->SetBatchSize(64);
+    CheckSameValues(reference, batched, 10, "after enabling batching again");
+    reference->SetStream(7);
+    batched->SetStream(7);
+    CheckSameValues(reference, batched, 1000, "after changing the stream");
+}
+
+/**
+ * \ingroup randomvariable-tests
+ * Test suite for the batched generation of uniform randoms
+ */
+class RandomVariableStreamBatchTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    RandomVariableStreamBatchTestSuite();
+};
+
+RandomVariableStreamBatchTestSuite::RandomVariableStreamBatchTestSuite()
+    : TestSuite("random-variable-stream-batch", UNIT)
+{
+    for (const auto typeId : {"ns3::UniformRandomVariable",
+                              "ns3::WeibullRandomVariable",
+                              "ns3::ExponentialRandomVariable",
+                              "ns3::NormalRandomVariable",
+                              "ns3::ParetoRandomVariable"})
+    {
+        AddTestCase(new RandomVariableStreamBatchTestCase(typeId));
+    }
+}
+
+/**
+ * \ingroup randomvariable-tests
+ * RandomVariableStreamBatchTestSuite instance variable.
+ */
+static RandomVariableStreamBatchTestSuite g_randomVariableStreamBatchTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -16,14 +16,22 @@
  *
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
+#include "ns3/boolean.h"
 #include "ns3/calendar-scheduler.h"
+#include "ns3/config.h"
+#include "ns3/event-impl.h"
+#include "ns3/event-profiler.h"
 #include "ns3/heap-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
 #include "ns3/simulator.h"
+#include "ns3/string.h"
 #include "ns3/test.h"
 
+#include <fstream>
+#include <typeindex>
+
 using namespace ns3;
 
 /**
@@ -707,6 +715,110 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup simulator-tests
+ *
+ * \brief Check that the event profiler attributes events to their targets.
+ */
+class SimulatorEventProfileTestCase : public TestCase
+{
+  public:
+    SimulatorEventProfileTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Test Event.
+     * \param value Event parameter.
+     */
+    void EventA(int value);
+    /** Test Event. */
+    void EventB();
+    /**
+     * Test Event with the same signature as EventA.
+     * \param value Event parameter.
+     */
+    void EventC(int value);
+};
+
+SimulatorEventProfileTestCase::SimulatorEventProfileTestCase()
+    : TestCase("Check the event profiler of the default simulator implementation")
+{
+}
+
+void
+SimulatorEventProfileTestCase::EventA(int /* value */)
+{
+}
+
+void
+SimulatorEventProfileTestCase::EventB()
+{
+}
+
+void
+SimulatorEventProfileTestCase::EventC(int /* value */)
+{
+}
+
+void
+SimulatorEventProfileTestCase::DoRun()
+{
+    EventImpl* event = MakeEvent(&SimulatorEventProfileTestCase::EventA, this, 0);
+    auto [cls, callback] = EventProfiler::GetEventTarget(std::type_index(typeid(*event)));
+    auto target = event->GetTarget();
+    event->Unref();
+    event = MakeEvent(&SimulatorEventProfileTestCase::EventC, this, 0);
+    NS_TEST_EXPECT_MSG_EQ((event->GetTarget() != target),
+                          true,
+                          "Member functions with the same signature must be different targets");
+    event->Unref();
+    NS_TEST_EXPECT_MSG_EQ(cls, "SimulatorEventProfileTestCase", "Unexpected event target class");
+    NS_TEST_EXPECT_MSG_EQ(callback,
+                          "void (SimulatorEventProfileTestCase::*)(int)",
+                          "Unexpected event target callback");
+
+    // make sure that a new simulator implementation is created with the profiler enabled
+    Simulator::Destroy();
+    std::string filename = CreateTempDirFilename("event-profile.txt");
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileEvents", BooleanValue(true));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFormat", StringValue("Folded"));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileOutputFile", StringValue(filename));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        Simulator::Schedule(MicroSeconds(i), &SimulatorEventProfileTestCase::EventA, this, i);
+    }
+    Simulator::Schedule(MicroSeconds(5), &SimulatorEventProfileTestCase::EventB, this);
+    Simulator::Schedule(MicroSeconds(6), &SimulatorEventProfileTestCase::EventC, this, 6);
+    Simulator::Run();
+    Simulator::Destroy();
+
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileEvents", BooleanValue(false));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileFormat", StringValue("Table"));
+    Config::SetDefault("ns3::DefaultSimulatorImpl::ProfileOutputFile", StringValue(""));
+
+    std::ifstream ifs(filename);
+    NS_TEST_ASSERT_MSG_EQ(ifs.is_open(), true, "Event profile not written");
+    // EventA and EventC have the same signature but are distinct targets
+    const std::string intEventPrefix =
+        "Simulator;SimulatorEventProfileTestCase;void_(SimulatorEventProfileTestCase::*)(int);";
+    std::string line;
+    std::size_t nLines = 0;
+    std::size_t nIntEvents = 0;
+    while (std::getline(ifs, line))
+    {
+        nLines++;
+        if (line.rfind(intEventPrefix, 0) == 0)
+        {
+            nIntEvents++;
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(nLines, 3, "Expected one line per event target");
+    NS_TEST_EXPECT_MSG_EQ(nIntEvents, 2, "Expected one line for each of EventA and EventC");
+}
+
 /**
  * \ingroup simulator-tests
  *
@@ -730,6 +842,7 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::QUICK);
+        AddTestCase(new SimulatorEventProfileTestCase(), TestCase::QUICK);
     }
 };
 
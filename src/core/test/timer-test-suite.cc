@@ -21,6 +21,8 @@
 #include "ns3/test.h"
 #include "ns3/timer.h"
 
+#include <vector>
+
 /**
  * \file
  * \ingroup timer-tests
@@ -220,6 +222,72 @@ TimerTemplateTestCase::DoTeardown()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup timer-tests
+ *
+ * \brief Check that a rescheduled Timer expires at the right time
+ * without leaving cancelled events in the event queue.
+ */
+class TimerRescheduleTestCase : public TestCase
+{
+  public:
+    TimerRescheduleTestCase();
+
+  private:
+    void DoRun() override;
+    /** Function invoked when the timer expires. */
+    void Expired();
+
+    std::vector<Time> m_expirations; //!< times at which the timer expired
+};
+
+TimerRescheduleTestCase::TimerRescheduleTestCase()
+    : TestCase("Check that rescheduled timers expire at the right time")
+{
+}
+
+void
+TimerRescheduleTestCase::Expired()
+{
+    m_expirations.push_back(Simulator::Now());
+}
+
+void
+TimerRescheduleTestCase::DoRun()
+{
+    Timer timer = Timer(Timer::CANCEL_ON_DESTROY);
+    timer.SetFunction(&TimerRescheduleTestCase::Expired, this);
+    timer.SetDelay(Seconds(10));
+
+    // postpone the timer every second: the timer expires 10 seconds after the last call
+    for (uint32_t i = 0; i < 20; i++)
+    {
+        Simulator::Schedule(Seconds(i), [&timer]() { timer.Reschedule(); });
+    }
+    Simulator::Schedule(Seconds(25), [&timer, this]() {
+        NS_TEST_EXPECT_MSG_EQ(timer.IsRunning(), true, "Timer should be running");
+        NS_TEST_EXPECT_MSG_EQ(timer.GetDelayLeft(), Seconds(4), "Unexpected delay left");
+        // move the expiration time up
+        timer.Reschedule(Seconds(2));
+    });
+    // reschedule the timer after it expired
+    Simulator::Schedule(Seconds(30), [&timer]() { timer.Reschedule(Seconds(1)); });
+    uint64_t eventCount = Simulator::GetEventCount();
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_expirations.size(), 2, "Unexpected number of expirations");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0], Seconds(27), "Unexpected first expiration time");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[1], Seconds(31), "Unexpected second expiration time");
+    // 22 events scheduled by this test case, plus the events scheduled by the timer: the
+    // first event is executed at 10s and schedules itself again at 20s (the expiration time
+    // at that moment), then at 29s; this event is removed at 25s and replaced by an event
+    // at 27s; the last event is executed at 31s
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount() - eventCount,
+                          26,
+                          "Unexpected number of executed events");
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup timer-tests
  *
@@ -233,6 +301,7 @@ class TimerTestSuite : public TestSuite
     {
         AddTestCase(new TimerStateTestCase(), TestCase::QUICK);
         AddTestCase(new TimerTemplateTestCase(), TestCase::QUICK);
+        AddTestCase(new TimerRescheduleTestCase(), TestCase::QUICK);
     }
 };
 
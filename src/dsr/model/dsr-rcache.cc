@@ -1195,15 +1195,13 @@ DsrRouteCache::PurgeMac()
         }
     }
     m_nb.erase(std::remove_if(m_nb.begin(), m_nb.end(), pred), m_nb.end());
-    m_ntimer.Cancel();
-    m_ntimer.Schedule();
+    m_ntimer.Reschedule();
 }
 
 void
 DsrRouteCache::ScheduleTimer()
 {
-    m_ntimer.Cancel();
-    m_ntimer.Schedule();
+    m_ntimer.Reschedule();
 }
 
 void
@@ -20,11 +20,14 @@
 #include "basic-energy-source.h"
 
 #include "ns3/assert.h"
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <cmath>
+
 namespace ns3
 {
 
@@ -68,6 +71,16 @@ BasicEnergySource::GetTypeId()
                           MakeTimeAccessor(&BasicEnergySource::SetEnergyUpdateInterval,
                                            &BasicEnergySource::GetEnergyUpdateInterval),
                           MakeTimeChecker())
+            .AddAttribute("AnalyticalEnergyUpdate",
+                          "If true, the remaining energy is only updated when the current "
+                          "draw changes or the remaining energy is queried, and a single "
+                          "event is scheduled at the time the remaining energy crosses the "
+                          "next battery threshold given the current draw (the "
+                          "PeriodicEnergyUpdateInterval attribute is ignored). If false, "
+                          "the remaining energy is also updated periodically.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&BasicEnergySource::m_analyticalUpdate),
+                          MakeBooleanChecker())
             .AddTraceSource("RemainingEnergy",
                             "Remaining energy at BasicEnergySource.",
                             MakeTraceSourceAccessor(&BasicEnergySource::m_remainingEnergyJ),
@@ -175,7 +188,11 @@ BasicEnergySource::UpdateEnergySource()
         NotifyEnergyChanged();
     }
 
-    if (m_energyUpdateEvent.IsExpired())
+    if (m_analyticalUpdate)
+    {
+        ScheduleNextUpdate();
+    }
+    else if (m_energyUpdateEvent.IsExpired())
     {
         m_energyUpdateEvent = Simulator::Schedule(m_energyUpdateInterval,
                                                   &BasicEnergySource::UpdateEnergySource,
@@ -183,6 +200,22 @@ BasicEnergySource::UpdateEnergySource()
     }
 }
 
+void
+BasicEnergySource::HandleCurrentChanged()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_analyticalUpdate)
+    {
+        UpdateEnergySource();
+    }
+}
+
+bool
+BasicEnergySource::IsAnalyticalUpdateEnabled() const
+{
+    return m_analyticalUpdate;
+}
+
 /*
  * Private functions start here.
  */
@@ -231,4 +264,50 @@ BasicEnergySource::CalculateRemainingEnergy()
     NS_LOG_DEBUG("BasicEnergySource:Remaining energy = " << m_remainingEnergyJ);
 }
 
+void
+BasicEnergySource::ScheduleNextUpdate()
+{
+    NS_LOG_FUNCTION(this);
+    // the remaining energy varies linearly until the current draw changes
+    double powerW = CalculateTotalCurrent() * m_supplyVoltageV;
+
+    if (m_energyUpdateEvent.IsRunning() && powerW == m_scheduledPowerW)
+    {
+        return; // the scheduled update is still accurate
+    }
+
+    m_energyUpdateEvent.Cancel();
+    m_scheduledPowerW = powerW;
+
+    double energyToThresholdJ;
+    if (!m_depleted && powerW > 0)
+    {
+        energyToThresholdJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    }
+    else if (m_depleted && powerW < 0)
+    {
+        energyToThresholdJ = m_remainingEnergyJ - m_highBatteryTh * m_initialEnergyJ;
+    }
+    else
+    {
+        return; // no threshold can be crossed with the current draw
+    }
+
+    double delayS = energyToThresholdJ / powerW;
+    if (delayS >= (Simulator::GetMaximumSimulationTime() - Simulator::Now()).GetSeconds())
+    {
+        return; // the threshold is never crossed
+    }
+
+    // round up so that the threshold has been crossed when the update takes place
+    auto delay = NanoSeconds(static_cast<int64_t>(std::ceil(delayS * 1e9)));
+    if (m_depleted)
+    {
+        delay += NanoSeconds(1); // the high threshold must be exceeded
+    }
+    NS_LOG_DEBUG("BasicEnergySource:Next update in " << delay.As(Time::S));
+    m_energyUpdateEvent =
+        Simulator::Schedule(delay, &BasicEnergySource::UpdateEnergySource, this);
+}
+
 } // namespace ns3
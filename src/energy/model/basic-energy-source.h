@@ -79,6 +79,17 @@ class BasicEnergySource : public EnergySource
      */
     void UpdateEnergySource() override;
 
+    /**
+     * Reschedules the next update, if the remaining energy is not updated
+     * periodically.
+     */
+    void HandleCurrentChanged() override;
+
+    /**
+     * \return the value of the AnalyticalEnergyUpdate attribute
+     */
+    bool IsAnalyticalUpdateEnabled() const override;
+
     /**
      * \param initialEnergyJ Initial energy, in Joules
      *
@@ -139,6 +150,14 @@ class BasicEnergySource : public EnergySource
      */
     void CalculateRemainingEnergy();
 
+    /**
+     * Schedules the next update at the time the remaining energy crosses the low
+     * battery threshold (or the high battery threshold, if the energy source is
+     * depleted and being recharged) given the current total current draw. The
+     * update is not rescheduled if the current draw did not change.
+     */
+    void ScheduleNextUpdate();
+
   private:
     double m_initialEnergyJ; //!< initial energy, in Joules
     double m_supplyVoltageV; //!< supply voltage, in Volts
@@ -153,6 +172,9 @@ class BasicEnergySource : public EnergySource
     EventId m_energyUpdateEvent;            //!< energy update event
     Time m_lastUpdateTime;                  //!< last update time
     Time m_energyUpdateInterval;            //!< energy update interval
+    bool m_analyticalUpdate;                //!< whether the remaining energy is not updated
+                                            //!< periodically
+    double m_scheduledPowerW{0};            //!< power drawn when the next update was scheduled
 };
 
 } // namespace ns3
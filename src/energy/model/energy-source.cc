@@ -64,6 +64,18 @@ EnergySource::GetNode() const
     return m_node;
 }
 
+void
+EnergySource::HandleCurrentChanged()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+bool
+EnergySource::IsAnalyticalUpdateEnabled() const
+{
+    return false;
+}
+
 void
 EnergySource::AppendDeviceEnergyModel(Ptr<DeviceEnergyModel> deviceEnergyModelPtr)
 {
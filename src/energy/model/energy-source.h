@@ -129,6 +129,23 @@ class EnergySource : public Object
      */
     virtual void UpdateEnergySource() = 0;
 
+    /**
+     * Called by DeviceEnergyModels after their current draw changed, i.e., after
+     * the state change they informed this EnergySource of by calling
+     * UpdateEnergySource. Energy sources that do not update the remaining energy
+     * periodically can use this notification to reschedule the next update based
+     * on the new total current draw. The default implementation does nothing.
+     */
+    virtual void HandleCurrentChanged();
+
+    /**
+     * \return true if this EnergySource does not update the remaining energy
+     *         periodically, but only when DeviceEnergyModels report a state change
+     *         or the remaining energy is queried. The default implementation
+     *         returns false.
+     */
+    virtual bool IsAnalyticalUpdateEnabled() const;
+
     /**
      * \brief Sets pointer to node containing this EnergySource.
      *
@@ -20,11 +20,13 @@
 #include "li-ion-energy-source.h"
 
 #include "ns3/assert.h"
+#include "ns3/boolean.h"
 #include "ns3/double.h"
 #include "ns3/log.h"
 #include "ns3/simulator.h"
 #include "ns3/trace-source-accessor.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace ns3
@@ -105,6 +107,16 @@ LiIonEnergySource::GetTypeId()
                           MakeTimeAccessor(&LiIonEnergySource::SetEnergyUpdateInterval,
                                            &LiIonEnergySource::GetEnergyUpdateInterval),
                           MakeTimeChecker())
+            .AddAttribute("AnalyticalEnergyUpdate",
+                          "If true, the remaining energy and the cell voltage are only "
+                          "updated when the current draw changes or the remaining energy is "
+                          "queried, and a single event is scheduled at the time the "
+                          "remaining energy reaches the low battery threshold given the "
+                          "current draw (the PeriodicEnergyUpdateInterval attribute is "
+                          "ignored). If false, they are also updated periodically.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&LiIonEnergySource::m_analyticalUpdate),
+                          MakeBooleanChecker())
             .AddTraceSource("RemainingEnergy",
                             "Remaining energy at BasicEnergySource.",
                             MakeTraceSourceAccessor(&LiIonEnergySource::m_remainingEnergyJ),
@@ -222,7 +234,10 @@ LiIonEnergySource::UpdateEnergySource()
         return;
     }
 
-    m_energyUpdateEvent.Cancel();
+    if (!m_analyticalUpdate)
+    {
+        m_energyUpdateEvent.Cancel();
+    }
 
     CalculateRemainingEnergy();
 
@@ -230,14 +245,37 @@ LiIonEnergySource::UpdateEnergySource()
 
     if (m_remainingEnergyJ <= m_lowBatteryTh * m_initialEnergyJ)
     {
+        m_energyUpdateEvent.Cancel();
         HandleEnergyDrainedEvent();
         return; // stop periodic update
     }
 
+    if (m_analyticalUpdate)
+    {
+        ScheduleNextUpdate();
+        return;
+    }
+
     m_energyUpdateEvent =
         Simulator::Schedule(m_energyUpdateInterval, &LiIonEnergySource::UpdateEnergySource, this);
 }
 
+void
+LiIonEnergySource::HandleCurrentChanged()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_analyticalUpdate)
+    {
+        UpdateEnergySource();
+    }
+}
+
+bool
+LiIonEnergySource::IsAnalyticalUpdateEnabled() const
+{
+    return m_analyticalUpdate;
+}
+
 /*
  * Private functions start here.
  */
@@ -272,6 +310,11 @@ LiIonEnergySource::CalculateRemainingEnergy()
     NS_ASSERT(duration.GetSeconds() >= 0);
     // energy = current * voltage * time
     double energyToDecreaseJ = totalCurrentA * m_supplyVoltageV * duration.GetSeconds();
+    if (m_analyticalUpdate && totalCurrentA > 0)
+    {
+        // the cell voltage is not sampled periodically, hence it is integrated
+        energyToDecreaseJ = GetDischargeEnergy(totalCurrentA, duration);
+    }
 
     if (m_remainingEnergyJ < energyToDecreaseJ)
     {
@@ -317,4 +360,95 @@ LiIonEnergySource::GetVoltage(double i) const
     return V;
 }
 
+double
+LiIonEnergySource::GetDischargeEnergy(double i, Time duration) const
+{
+    NS_LOG_FUNCTION(this << i << duration);
+
+    // drained capacity (in Ah) at the beginning and at the end of the interval
+    double it0 = m_drainedCapacity;
+    double it1 = m_drainedCapacity + (i * duration).GetHours();
+
+    if (it1 >= m_qRated)
+    {
+        // the cell voltage model does not hold beyond the rated capacity
+        return i * m_supplyVoltageV * duration.GetSeconds();
+    }
+
+    // empirical factors (see GetVoltage)
+    double A = m_eFull - m_eExp;
+    double B = 3 / m_qExp;
+    double K = std::abs((m_eFull - m_eNom + A * (std::exp(-B * m_qNom) - 1)) * (m_qRated - m_qNom) /
+                        m_qNom);
+    double E0 = m_eFull + K + m_internalResistance * m_typCurrent - A;
+
+    // integral of the cell voltage over the drained capacity, in Wh
+    double energyWh = (E0 - m_internalResistance * i) * (it1 - it0) +
+                      K * m_qRated * std::log((m_qRated - it1) / (m_qRated - it0)) -
+                      A / B * (std::exp(-B * it1) - std::exp(-B * it0));
+
+    return energyWh * 3600;
+}
+
+void
+LiIonEnergySource::ScheduleNextUpdate()
+{
+    NS_LOG_FUNCTION(this);
+    double currentA = CalculateTotalCurrent();
+
+    // the discharge energy is additive over consecutive intervals at the same current
+    if (m_energyUpdateEvent.IsRunning() && currentA == m_scheduledCurrentA)
+    {
+        return; // the scheduled update is still accurate
+    }
+
+    m_energyUpdateEvent.Cancel();
+    m_scheduledCurrentA = currentA;
+
+    if (currentA <= 0 || m_supplyVoltageV <= 0)
+    {
+        return; // the low battery threshold cannot be reached with the current draw
+    }
+
+    double energyJ = m_remainingEnergyJ - m_lowBatteryTh * m_initialEnergyJ;
+    Time maxDelay = Simulator::GetMaximumSimulationTime() - Simulator::Now();
+
+    // beyond the rated capacity, GetDischargeEnergy assumes a constant cell voltage, hence
+    // the threshold is reached at the latest when both the rated capacity is drained and
+    // the energy drawn at the current cell voltage exceeds the remaining energy
+    double ratedS = (m_qRated - m_drainedCapacity) * 3600 / currentA;
+    double boundS = std::max(ratedS, energyJ / (currentA * m_supplyVoltageV));
+    int64_t high = maxDelay.GetNanoSeconds();
+    if (boundS < maxDelay.GetSeconds())
+    {
+        high = static_cast<int64_t>(std::ceil(boundS * 1e9));
+    }
+
+    if (GetDischargeEnergy(currentA, NanoSeconds(high)) < energyJ)
+    {
+        return; // the threshold is never reached
+    }
+
+    // the discharge energy increases with the duration, hence search for the earliest
+    // time at which the threshold has been reached
+    int64_t low = 0;
+    while (low < high)
+    {
+        int64_t mid = low + (high - low) / 2;
+        if (GetDischargeEnergy(currentA, NanoSeconds(mid)) >= energyJ)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+
+    auto delay = NanoSeconds(high);
+    NS_LOG_DEBUG("LiIonEnergySource:Next update in " << delay.As(Time::S));
+    m_energyUpdateEvent =
+        Simulator::Schedule(delay, &LiIonEnergySource::UpdateEnergySource, this);
+}
+
 } // namespace ns3
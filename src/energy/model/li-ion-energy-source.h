@@ -151,6 +151,17 @@ class LiIonEnergySource : public EnergySource
      */
     void UpdateEnergySource() override;
 
+    /**
+     * Reschedules the next update, if the remaining energy is not updated
+     * periodically.
+     */
+    void HandleCurrentChanged() override;
+
+    /**
+     * \return the value of the AnalyticalEnergyUpdate attribute
+     */
+    bool IsAnalyticalUpdateEnabled() const override;
+
     /**
      * \param interval Energy update interval.
      *
@@ -194,24 +205,45 @@ class LiIonEnergySource : public EnergySource
      */
     double GetVoltage(double current) const;
 
+    /**
+     * Get the energy drawn from the cell when discharging it at the given current
+     * for the given duration, by integrating the cell voltage over the capacity
+     * drained in such interval.
+     *
+     * \param current the discharge current value.
+     * \param duration the discharge duration.
+     * \return the energy drawn from the cell, in Joules
+     */
+    double GetDischargeEnergy(double current, Time duration) const;
+
+    /**
+     * Schedules the next update at the time the remaining energy reaches the low
+     * battery threshold given the current total current draw, which is computed by
+     * integrating the cell voltage as done by GetDischargeEnergy. The update is not
+     * rescheduled if the total current draw did not change.
+     */
+    void ScheduleNextUpdate();
+
   private:
     double m_initialEnergyJ;                //!< initial energy, in Joules
     TracedValue<double> m_remainingEnergyJ; //!< remaining energy, in Joules
     double m_drainedCapacity;               //!< capacity drained from the cell, in Ah
     double m_supplyVoltageV;                //!< actual voltage of the cell
-    double m_lowBatteryTh;       //!< low battery threshold, as a fraction of the initial energy
-    EventId m_energyUpdateEvent; //!< energy update event
-    Time m_lastUpdateTime;       //!< last update time
-    Time m_energyUpdateInterval; //!< energy update interval
-    double m_eFull;              //!< initial voltage of the cell, in Volts
-    double m_eNom;               //!< nominal voltage of the cell, in Volts
-    double m_eExp;               //!< cell voltage at the end of the exponential zone, in Volts
-    double m_internalResistance; //!< internal resistance of the cell, in Ohms
-    double m_qRated;             //!< rated capacity of the cell, in Ah
-    double m_qNom;               //!< cell capacity at the end of the nominal zone, in Ah
-    double m_qExp;               //!< capacity value at the end of the exponential zone, in Ah
-    double m_typCurrent;         //!< typical discharge current used to fit the curves
-    double m_minVoltTh;          //!< minimum threshold voltage to consider the battery depleted
+    double m_lowBatteryTh;         //!< low battery threshold, as a fraction of the initial energy
+    EventId m_energyUpdateEvent;   //!< energy update event
+    Time m_lastUpdateTime;         //!< last update time
+    Time m_energyUpdateInterval;   //!< energy update interval
+    double m_eFull;                //!< initial voltage of the cell, in Volts
+    double m_eNom;                 //!< nominal voltage of the cell, in Volts
+    double m_eExp;                 //!< cell voltage at the end of the exponential zone, in Volts
+    double m_internalResistance;   //!< internal resistance of the cell, in Ohms
+    double m_qRated;               //!< rated capacity of the cell, in Ah
+    double m_qNom;                 //!< cell capacity at the end of the nominal zone, in Ah
+    double m_qExp;                 //!< capacity value at the end of the exponential zone, in Ah
+    double m_typCurrent;           //!< typical discharge current used to fit the curves
+    double m_minVoltTh;            //!< minimum threshold voltage to consider the battery depleted
+    bool m_analyticalUpdate;       //!< whether the remaining energy is not updated periodically
+    double m_scheduledCurrentA{0}; //!< current drawn when the next update was scheduled
 };
 
 } // namespace ns3
@@ -112,10 +112,20 @@ SimpleDeviceEnergyModel::SetCurrentA(double current)
     m_totalEnergyConsumption += energyToDecrease;
     // update last update time stamp
     m_lastUpdateTime = Simulator::Now();
+    if (!m_source->IsAnalyticalUpdateEnabled())
+    {
+        // update the current drain
+        m_actualCurrentA = current;
+        // notify energy source
+        m_source->UpdateEnergySource();
+        return;
+    }
+    // notify energy source, which accounts for the energy drawn with the previous current
+    m_source->UpdateEnergySource();
     // update the current drain
     m_actualCurrentA = current;
-    // notify energy source
-    m_source->UpdateEnergySource();
+    // notify energy source of the new current draw
+    m_source->HandleCurrentChanged();
 }
 
 void
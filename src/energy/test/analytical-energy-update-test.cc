@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/basic-energy-source.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/li-ion-energy-source.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/simple-device-energy-model.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("AnalyticalEnergyUpdateTestSuite");
+
+/**
+ * \ingroup energy-tests
+ *
+ * \brief Simple device energy model recording the times the energy source notifies
+ * the depletion of the energy
+ */
+class DepletionRecorderEnergyModel : public SimpleDeviceEnergyModel
+{
+  public:
+    void HandleEnergyDepletion() override
+    {
+        m_depletionTimes.push_back(Simulator::Now());
+    }
+
+    std::vector<Time> m_depletionTimes; //!< times the energy depletion was notified
+};
+
+/**
+ * \ingroup energy-tests
+ *
+ * \brief Test the analytical update of the BasicEnergySource
+ *
+ * A device draws a current that changes a few times and the remaining energy is queried
+ * at given times. This test verifies that the remaining energy returned by the queries is
+ * the same when the energy source is updated periodically and analytically, that the
+ * analytical update detects the crossing of the low battery threshold exactly and that,
+ * unlike the periodic update, the analytical update does not require any event while
+ * the current draw does not change.
+ */
+class BasicEnergySourceAnalyticalTestCase : public TestCase
+{
+  public:
+    BasicEnergySourceAnalyticalTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Results of a simulation
+    struct Results
+    {
+        std::vector<double> remainingEnergy; //!< remaining energy at every query
+        Time depletionTime;                  //!< time the low threshold crossing was detected
+        std::vector<Time> depletionTimes;    //!< times the energy depletion was notified
+        uint64_t nEvents;                    //!< number of simulator events executed
+    };
+
+    /**
+     * Run a simulation.
+     *
+     * \param analytical whether the energy source is updated analytically
+     * \param stopTime the simulation stop time
+     * \param changeCurrent whether the device changes its current draw
+     * \return the results of the simulation
+     */
+    Results RunSimulation(bool analytical, Time stopTime, bool changeCurrent);
+
+    const double m_initialEnergyJ{10}; //!< initial energy
+    const double m_voltageV{3};        //!< supply voltage
+    const double m_lowBatteryTh{0.1};  //!< low battery threshold
+};
+
+BasicEnergySourceAnalyticalTestCase::BasicEnergySourceAnalyticalTestCase()
+    : TestCase("Check the analytical update of the basic energy source")
+{
+}
+
+BasicEnergySourceAnalyticalTestCase::Results
+BasicEnergySourceAnalyticalTestCase::RunSimulation(bool analytical,
+                                                   Time stopTime,
+                                                   bool changeCurrent)
+{
+    Results results;
+
+    auto node = CreateObject<Node>();
+    auto sem = CreateObject<DepletionRecorderEnergyModel>();
+    auto es = CreateObjectWithAttributes<BasicEnergySource>(
+        "BasicEnergySourceInitialEnergyJ",
+        DoubleValue(m_initialEnergyJ),
+        "BasicEnergySupplyVoltageV",
+        DoubleValue(m_voltageV),
+        "BasicEnergyLowBatteryThreshold",
+        DoubleValue(m_lowBatteryTh),
+        "AnalyticalEnergyUpdate",
+        BooleanValue(analytical));
+
+    es->SetNode(node);
+    sem->SetEnergySource(es);
+    es->AppendDeviceEnergyModel(sem);
+    node->AggregateObject(es);
+
+    es->TraceConnectWithoutContext(
+        "RemainingEnergy",
+        Callback<void, double, double>([&](double, double remaining) {
+            if (remaining <= m_lowBatteryTh * m_initialEnergyJ && results.depletionTime.IsZero())
+            {
+                results.depletionTime = Simulator::Now();
+            }
+        }));
+
+    if (changeCurrent)
+    {
+        // with periodic update, SimpleDeviceEnergyModel accounts for the energy drawn since
+        // the last update with the new current, hence the source is updated beforehand
+        sem->SetCurrentA(0.1);
+        for (const auto& [time, currentA] : {std::pair{5.0, 0.01}, std::pair{12.3, 0.15}})
+        {
+            Simulator::Schedule(Seconds(time), [es, sem, currentA = currentA]() {
+                es->UpdateEnergySource();
+                sem->SetCurrentA(currentA);
+            });
+        }
+        for (const auto time : {3.0, 10.0, 15.0})
+        {
+            Simulator::Schedule(Seconds(time), [&results, es]() {
+                results.remainingEnergy.push_back(es->GetRemainingEnergy());
+            });
+        }
+    }
+
+    Simulator::Stop(stopTime);
+    Simulator::Run();
+    results.nEvents = Simulator::GetEventCount();
+    results.depletionTimes = sem->m_depletionTimes;
+    Simulator::Destroy();
+
+    return results;
+}
+
+void
+BasicEnergySourceAnalyticalTestCase::DoRun()
+{
+    auto periodic = RunSimulation(false, Seconds(30), true);
+    auto analytical = RunSimulation(true, Seconds(30), true);
+
+    NS_TEST_ASSERT_MSG_EQ(analytical.remainingEnergy.size(),
+                          periodic.remainingEnergy.size(),
+                          "Unexpected number of queries");
+    for (std::size_t i = 0; i < periodic.remainingEnergy.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(analytical.remainingEnergy[i],
+                                  periodic.remainingEnergy[i],
+                                  1e-9,
+                                  "Unexpected remaining energy at query " << i);
+    }
+
+    // the remaining energy reaches the low threshold when the device draws 0.15 A (the
+    // simulation stops before the energy is exhausted)
+    const auto energyAtLastChange = m_initialEnergyJ - 0.1 * m_voltageV * 5 -
+                                    0.01 * m_voltageV * 7.3;
+    const auto expectedDepletion =
+        12.3 + (energyAtLastChange - m_lowBatteryTh * m_initialEnergyJ) / (0.15 * m_voltageV);
+    NS_TEST_EXPECT_MSG_EQ_TOL(analytical.depletionTime.GetSeconds(),
+                              expectedDepletion,
+                              1e-8,
+                              "Unexpected depletion time with analytical update");
+    // the periodic update detects the depletion at the next periodic update
+    NS_TEST_EXPECT_MSG_EQ(periodic.depletionTime,
+                          Seconds(std::ceil(expectedDepletion)),
+                          "Unexpected depletion time with periodic update");
+    NS_TEST_EXPECT_MSG_LT(analytical.nEvents, periodic.nEvents, "Expected fewer events");
+
+    // the devices are notified of the depletion once, when the crossing is detected
+    NS_TEST_ASSERT_MSG_EQ(analytical.depletionTimes.size(),
+                          1,
+                          "Expected one depletion notification with analytical update");
+    NS_TEST_EXPECT_MSG_EQ(analytical.depletionTimes.front(),
+                          analytical.depletionTime,
+                          "Unexpected depletion notification time with analytical update");
+    NS_TEST_ASSERT_MSG_EQ(periodic.depletionTimes.size(),
+                          1,
+                          "Expected one depletion notification with periodic update");
+    NS_TEST_EXPECT_MSG_EQ(periodic.depletionTimes.front(),
+                          periodic.depletionTime,
+                          "Unexpected depletion notification time with periodic update");
+
+    // no event is needed while the current draw does not change
+    auto shortRun = RunSimulation(true, Seconds(10), false);
+    auto longRun = RunSimulation(true, Seconds(1000), false);
+    NS_TEST_EXPECT_MSG_EQ(longRun.nEvents,
+                          shortRun.nEvents,
+                          "Analytical update should not schedule idle events");
+    shortRun = RunSimulation(false, Seconds(10), false);
+    longRun = RunSimulation(false, Seconds(1000), false);
+    NS_TEST_EXPECT_MSG_GT(longRun.nEvents,
+                          shortRun.nEvents,
+                          "Periodic update should schedule idle events");
+}
+
+/**
+ * \ingroup energy-tests
+ *
+ * \brief Test the analytical update of the LiIonEnergySource
+ *
+ * A device discharges the cell at a constant current. This test verifies that the
+ * remaining energy and the cell voltage are close to those obtained when the energy
+ * source is updated periodically (the cell voltage is sampled at different times) and
+ * that the analytical update requires fewer events.
+ */
+class LiIonEnergySourceAnalyticalTestCase : public TestCase
+{
+  public:
+    LiIonEnergySourceAnalyticalTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LiIonEnergySourceAnalyticalTestCase::LiIonEnergySourceAnalyticalTestCase()
+    : TestCase("Check the analytical update of the Li-Ion energy source")
+{
+}
+
+void
+LiIonEnergySourceAnalyticalTestCase::DoRun()
+{
+    std::vector<double> remainingEnergy;
+    std::vector<double> voltage;
+    std::vector<uint64_t> nEvents;
+
+    for (const bool analytical : {false, true})
+    {
+        auto node = CreateObject<Node>();
+        auto sem = CreateObject<SimpleDeviceEnergyModel>();
+        auto es = CreateObjectWithAttributes<LiIonEnergySource>("AnalyticalEnergyUpdate",
+                                                                BooleanValue(analytical));
+
+        es->SetNode(node);
+        sem->SetEnergySource(es);
+        es->AppendDeviceEnergyModel(sem);
+        node->AggregateObject(es);
+
+        // discharge at 2.33 A for 1700 seconds
+        sem->SetCurrentA(2.33);
+        Simulator::Schedule(Seconds(1700), [&, es]() {
+            remainingEnergy.push_back(es->GetRemainingEnergy());
+            voltage.push_back(es->GetSupplyVoltage());
+        });
+
+        Simulator::Stop(Seconds(1701));
+        Simulator::Run();
+        nEvents.push_back(Simulator::GetEventCount());
+        Simulator::Destroy();
+    }
+
+    NS_TEST_EXPECT_MSG_EQ_TOL(remainingEnergy[1],
+                              remainingEnergy[0],
+                              1e-2 * remainingEnergy[0],
+                              "Unexpected remaining energy with analytical update");
+    NS_TEST_EXPECT_MSG_EQ_TOL(voltage[1],
+                              voltage[0],
+                              1e-2 * voltage[0],
+                              "Unexpected cell voltage with analytical update");
+    NS_TEST_EXPECT_MSG_LT(nEvents[1], nEvents[0], "Expected fewer events");
+}
+
+/**
+ * \ingroup energy-tests
+ *
+ * \brief Test the depletion of the LiIonEnergySource with analytical update
+ *
+ * A device discharges the cell at a constant current until the remaining energy reaches
+ * the low battery threshold. This test verifies that the analytical update predicts the
+ * time the threshold is reached by integrating the cell voltage, i.e., that the
+ * remaining energy is only updated once, when the threshold is reached, and that the
+ * devices are notified of the depletion at that time, which is close to the time the
+ * depletion is detected when the energy source is updated periodically.
+ */
+class LiIonEnergySourceDepletionTestCase : public TestCase
+{
+  public:
+    LiIonEnergySourceDepletionTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LiIonEnergySourceDepletionTestCase::LiIonEnergySourceDepletionTestCase()
+    : TestCase("Check the depletion of the Li-Ion energy source with analytical update")
+{
+}
+
+void
+LiIonEnergySourceDepletionTestCase::DoRun()
+{
+    std::vector<std::vector<Time>> depletionTimes;
+    std::vector<double> remainingEnergy; // remaining energy after every update (analytical)
+    double lowBatteryThJ = 0;
+
+    for (const bool analytical : {false, true})
+    {
+        auto node = CreateObject<Node>();
+        auto sem = CreateObject<DepletionRecorderEnergyModel>();
+        auto es = CreateObjectWithAttributes<LiIonEnergySource>("AnalyticalEnergyUpdate",
+                                                                BooleanValue(analytical));
+
+        es->SetNode(node);
+        sem->SetEnergySource(es);
+        es->AppendDeviceEnergyModel(sem);
+        node->AggregateObject(es);
+
+        DoubleValue initialEnergy;
+        DoubleValue lowBatteryTh;
+        es->GetAttribute("LiIonEnergySourceInitialEnergyJ", initialEnergy);
+        es->GetAttribute("LiIonEnergyLowBatteryThreshold", lowBatteryTh);
+        lowBatteryThJ = initialEnergy.Get() * lowBatteryTh.Get();
+
+        if (analytical)
+        {
+            es->TraceConnectWithoutContext(
+                "RemainingEnergy",
+                Callback<void, double, double>(
+                    [&](double, double remaining) { remainingEnergy.push_back(remaining); }));
+        }
+
+        // discharge at 2.33 A until the cell is depleted
+        sem->SetCurrentA(2.33);
+
+        Simulator::Stop(Hours(2));
+        Simulator::Run();
+        depletionTimes.push_back(sem->m_depletionTimes);
+        Simulator::Destroy();
+    }
+
+    NS_TEST_ASSERT_MSG_EQ(depletionTimes[0].size(),
+                          1,
+                          "Expected one depletion notification with periodic update");
+    NS_TEST_ASSERT_MSG_EQ(depletionTimes[1].size(),
+                          1,
+                          "Expected one depletion notification with analytical update");
+    // the periodic update detects the depletion at the next periodic update (every second)
+    NS_TEST_EXPECT_MSG_EQ_TOL(depletionTimes[1].front().GetSeconds(),
+                              depletionTimes[0].front().GetSeconds(),
+                              1,
+                              "Unexpected depletion time with analytical update");
+
+    // the update scheduled when the current changed is the one detecting the depletion
+    NS_TEST_ASSERT_MSG_EQ(remainingEnergy.size(), 1, "Expected a single update");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(remainingEnergy.front(),
+                                lowBatteryThJ,
+                                "The threshold was not reached at the depletion time");
+    // the current draw is such that less than 1e-7 J is drawn in a nanosecond
+    NS_TEST_EXPECT_MSG_GT(remainingEnergy.front(),
+                          lowBatteryThJ - 1e-7,
+                          "The depletion was detected after the threshold was reached");
+}
+
+/**
+ * \ingroup energy-tests
+ *
+ * \brief Analytical energy update TestSuite
+ */
+class AnalyticalEnergyUpdateTestSuite : public TestSuite
+{
+  public:
+    AnalyticalEnergyUpdateTestSuite();
+};
+
+AnalyticalEnergyUpdateTestSuite::AnalyticalEnergyUpdateTestSuite()
+    : TestSuite("analytical-energy-update", UNIT)
+{
+    AddTestCase(new BasicEnergySourceAnalyticalTestCase, TestCase::QUICK);
+    AddTestCase(new LiIonEnergySourceAnalyticalTestCase, TestCase::QUICK);
+    AddTestCase(new LiIonEnergySourceDepletionTestCase, TestCase::QUICK);
+}
+
+/// create an instance of the test suite
+static AnalyticalEnergyUpdateTestSuite g_analyticalEnergyUpdateTestSuite;
@@ -114,6 +114,12 @@ FlowMonitor::DoDispose()
     Object::DoDispose();
 }
 
+std::size_t
+FlowMonitor::TrackedPacketKeyHash::operator()(const TrackedPacketKey& key) const
+{
+    return std::hash<uint64_t>{}((static_cast<uint64_t>(key.first) << 32) | key.second);
+}
+
 inline FlowMonitor::FlowStats&
 FlowMonitor::GetStatsForFlow(FlowId flowId)
 {
@@ -156,10 +162,20 @@ FlowMonitor::ReportFirstTx(Ptr<FlowProbe> probe,
         return;
     }
     Time now = Simulator::Now();
-    TrackedPacket& tracked = m_trackedPackets[std::make_pair(flowId, packetId)];
+    auto [it, inserted] = m_trackedPackets.try_emplace(std::make_pair(flowId, packetId));
+    TrackedPacket& tracked = it->second;
     tracked.firstSeenTime = now;
     tracked.lastSeenTime = tracked.firstSeenTime;
     tracked.timesForwarded = 0;
+    // the packet is the most recently seen one
+    if (inserted)
+    {
+        tracked.lastSeenIt = m_lastSeenOrder.insert(m_lastSeenOrder.end(), it->first);
+    }
+    else
+    {
+        m_lastSeenOrder.splice(m_lastSeenOrder.end(), m_lastSeenOrder, tracked.lastSeenIt);
+    }
     NS_LOG_DEBUG("ReportFirstTx: adding tracked packet (flowId=" << flowId << ", packetId="
                                                                  << packetId << ").");
 
@@ -198,6 +214,7 @@ FlowMonitor::ReportForwarding(Ptr<FlowProbe> probe,
 
     tracked->second.timesForwarded++;
     tracked->second.lastSeenTime = Simulator::Now();
+    m_lastSeenOrder.splice(m_lastSeenOrder.end(), m_lastSeenOrder, tracked->second.lastSeenIt);
 
     Time delay = (Simulator::Now() - tracked->second.firstSeenTime);
     probe->AddPacketStats(flowId, packetSize, delay);
@@ -268,7 +285,7 @@ FlowMonitor::ReportLastRx(Ptr<FlowProbe> probe,
     NS_LOG_DEBUG("ReportLastTx: removing tracked packet (flowId=" << flowId << ", packetId="
                                                                   << packetId << ").");
 
-    m_trackedPackets.erase(tracked); // we don't need to track this packet anymore
+    RemoveTrackedPacket(tracked); // we don't need to track this packet anymore
 }
 
 void
@@ -306,7 +323,7 @@ FlowMonitor::ReportDrop(Ptr<FlowProbe> probe,
         // FIXME: this will not necessarily be true with broadcast/multicast
         NS_LOG_DEBUG("ReportDrop: removing tracked packet (flowId=" << flowId << ", packetId="
                                                                     << packetId << ").");
-        m_trackedPackets.erase(tracked);
+        RemoveTrackedPacket(tracked);
     }
 }
 
@@ -322,25 +339,34 @@ FlowMonitor::CheckForLostPackets(Time maxDelay)
     NS_LOG_FUNCTION(this << maxDelay.As(Time::S));
     Time now = Simulator::Now();
 
-    for (auto iter = m_trackedPackets.begin(); iter != m_trackedPackets.end();)
+    // the packets are visited in increasing order of the time they were last seen, hence
+    // we can stop at the first packet that is not considered lost
+    while (!m_lastSeenOrder.empty())
     {
-        if (now - iter->second.lastSeenTime >= maxDelay)
-        {
-            // packet is considered lost, add it to the loss statistics
-            auto flow = m_flowStats.find(iter->first.first);
-            NS_ASSERT(flow != m_flowStats.end());
-            flow->second.lostPackets++;
-
-            // we won't track it anymore
-            m_trackedPackets.erase(iter++);
-        }
-        else
+        auto iter = m_trackedPackets.find(m_lastSeenOrder.front());
+        NS_ASSERT(iter != m_trackedPackets.end());
+        if (now - iter->second.lastSeenTime < maxDelay)
         {
-            iter++;
+            break;
         }
+
+        // packet is considered lost, add it to the loss statistics
+        auto flow = m_flowStats.find(iter->first.first);
+        NS_ASSERT(flow != m_flowStats.end());
+        flow->second.lostPackets++;
+
+        // we won't track it anymore
+        RemoveTrackedPacket(iter);
     }
 }
 
+void
+FlowMonitor::RemoveTrackedPacket(TrackedPacketMap::iterator tracked)
+{
+    m_lastSeenOrder.erase(tracked->second.lastSeenIt);
+    m_trackedPackets.erase(tracked);
+}
+
 void
 FlowMonitor::CheckForLostPackets()
 {
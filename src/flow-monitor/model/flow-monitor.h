@@ -29,7 +29,9 @@
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 
+#include <list>
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 namespace ns3
@@ -282,20 +284,39 @@ class FlowMonitor : public Object
     void DoDispose() override;
 
   private:
+    /// (FlowId,PacketId) pair identifying a tracked packet
+    typedef std::pair<FlowId, FlowPacketId> TrackedPacketKey;
+
+    /// Hash function for the tracked packet keys
+    struct TrackedPacketKeyHash
+    {
+        /**
+         * Functional operator.
+         *
+         * \param key the tracked packet key
+         * \return the hash value
+         */
+        std::size_t operator()(const TrackedPacketKey& key) const;
+    };
+
     /// Structure to represent a single tracked packet data
     struct TrackedPacket
     {
         Time firstSeenTime;      //!< absolute time when the packet was first seen by a probe
         Time lastSeenTime;       //!< absolute time when the packet was last seen by a probe
         uint32_t timesForwarded; //!< number of times the packet was reportedly forwarded
+        std::list<TrackedPacketKey>::iterator lastSeenIt; //!< position in m_lastSeenOrder
     };
 
     /// FlowId --> FlowStats
     FlowStatsContainer m_flowStats;
 
     /// (FlowId,PacketId) --> TrackedPacket
-    typedef std::map<std::pair<FlowId, FlowPacketId>, TrackedPacket> TrackedPacketMap;
+    typedef std::unordered_map<TrackedPacketKey, TrackedPacket, TrackedPacketKeyHash>
+        TrackedPacketMap;
     TrackedPacketMap m_trackedPackets; //!< Tracked packets
+    /// Keys of the tracked packets sorted by increasing time they were last seen
+    std::list<TrackedPacketKey> m_lastSeenOrder;
     Time m_maxPerHopDelay;             //!< Minimum per-hop delay
     FlowProbeContainer m_flowProbes;   //!< all the FlowProbes
 
@@ -318,6 +339,10 @@ class FlowMonitor : public Object
 
     /// Periodic function to check for lost packets and prune statistics
     void PeriodicCheckForLostPackets();
+
+    /// Stop tracking a packet
+    /// \param tracked iterator to the tracked packet
+    void RemoveTrackedPacket(TrackedPacketMap::iterator tracked);
 };
 
 } // namespace ns3
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/flow-monitor.h"
+#include "ns3/flow-probe.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup flow-monitor
+ * \defgroup flow-monitor-test FlowMonitor module tests
+ */
+
+/**
+ * \ingroup flow-monitor-test
+ *
+ * Flow probe reporting the packet events of the test to the flow monitor.
+ */
+class FlowMonitorTestProbe : public FlowProbe
+{
+  public:
+    /**
+     * Constructor
+     * \param flowMonitor the FlowMonitor this probe is associated with
+     */
+    FlowMonitorTestProbe(Ptr<FlowMonitor> flowMonitor)
+        : FlowProbe(flowMonitor)
+    {
+    }
+};
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * Test the detection of the lost packets by the flow monitor.
+ *
+ * Packets of two flows are reported as transmitted, forwarded and received by a probe,
+ * at different times. A packet is considered lost if it is not seen for MaxPerHopDelay,
+ * which is checked by the flow monitor every second. This test verifies that:
+ * - a packet that is not seen anymore after being transmitted is detected as lost
+ * - a packet that is forwarded is detected as lost MaxPerHopDelay after it was last
+ *   forwarded, even if packets transmitted later were detected as lost before it
+ * - a packet that is transmitted again is detected as lost MaxPerHopDelay after the
+ *   last transmission, both if it was still tracked and if it had been received
+ */
+class FlowMonitorLostPacketsTestCase : public TestCase
+{
+  public:
+    FlowMonitorLostPacketsTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// Store the number of lost packets of every flow
+    void CheckLostPackets();
+
+    Ptr<FlowMonitor> m_monitor;                       //!< the flow monitor
+    std::vector<std::vector<uint32_t>> m_lostPackets; //!< number of lost packets of every flow
+                                                      //!< at every check
+};
+
+FlowMonitorLostPacketsTestCase::FlowMonitorLostPacketsTestCase()
+    : TestCase("Check the detection of the lost packets by the flow monitor")
+{
+}
+
+void
+FlowMonitorLostPacketsTestCase::CheckLostPackets()
+{
+    std::vector<uint32_t> lostPackets;
+    for (const FlowId flowId : {1, 2})
+    {
+        auto it = m_monitor->GetFlowStats().find(flowId);
+        NS_TEST_ASSERT_MSG_EQ((it != m_monitor->GetFlowStats().end()),
+                              true,
+                              "No statistics for flow " << flowId);
+        lostPackets.push_back(it->second.lostPackets);
+    }
+    m_lostPackets.push_back(lostPackets);
+}
+
+void
+FlowMonitorLostPacketsTestCase::DoRun()
+{
+    m_monitor = CreateObjectWithAttributes<FlowMonitor>("MaxPerHopDelay", TimeValue(Seconds(10)));
+    auto probe = CreateObject<FlowMonitorTestProbe>(m_monitor);
+    const uint32_t size = 1000;
+
+    // (flow 1, packet 1), (flow 1, packet 2), (flow 2, packet 1) and (flow 1, packet 3)
+    // are transmitted
+    Simulator::Schedule(Seconds(0.5), [=, this]() {
+        m_monitor->ReportFirstTx(probe, 1, 1, size);
+        m_monitor->ReportFirstTx(probe, 1, 2, size);
+        m_monitor->ReportFirstTx(probe, 2, 1, size);
+        m_monitor->ReportFirstTx(probe, 1, 3, size);
+    });
+    // (flow 1, packet 3) is received
+    Simulator::Schedule(Seconds(1.5), &FlowMonitor::ReportLastRx, m_monitor, probe, 1, 3, size);
+    // (flow 1, packet 1) is forwarded
+    Simulator::Schedule(Seconds(2.5),
+                        &FlowMonitor::ReportForwarding,
+                        m_monitor,
+                        probe,
+                        1,
+                        1,
+                        size);
+    // (flow 2, packet 1) is transmitted again while it is still tracked
+    Simulator::Schedule(Seconds(3.5), &FlowMonitor::ReportFirstTx, m_monitor, probe, 2, 1, size);
+    // (flow 1, packet 3) is transmitted again after it was received
+    Simulator::Schedule(Seconds(4.5), &FlowMonitor::ReportFirstTx, m_monitor, probe, 1, 3, size);
+
+    // the periodic checks for lost packets take place every second
+    for (uint32_t i = 0; i <= 6; ++i)
+    {
+        Simulator::Schedule(Seconds(10.75 + i),
+                            &FlowMonitorLostPacketsTestCase::CheckLostPackets,
+                            this);
+    }
+
+    Simulator::Stop(Seconds(17));
+    Simulator::Run();
+
+    auto it = m_monitor->GetFlowStats().find(1);
+    NS_TEST_ASSERT_MSG_EQ((it != m_monitor->GetFlowStats().end()), true, "No stats for flow 1");
+    NS_TEST_EXPECT_MSG_EQ(it->second.txPackets, 4, "Unexpected number of packets of flow 1");
+    NS_TEST_EXPECT_MSG_EQ(it->second.rxPackets, 1, "Unexpected received packets of flow 1");
+
+    Simulator::Destroy();
+
+    // (flow 1, packet 2) is lost at 11 s, (flow 1, packet 1) at 13 s, (flow 2, packet 1) at
+    // 14 s and (flow 1, packet 3) at 15 s
+    const std::vector<std::vector<uint32_t>> expected{{0, 0},
+                                                      {1, 0},
+                                                      {1, 0},
+                                                      {2, 0},
+                                                      {2, 1},
+                                                      {3, 1},
+                                                      {3, 1}};
+    NS_TEST_ASSERT_MSG_EQ(m_lostPackets.size(), expected.size(), "Unexpected number of checks");
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        for (std::size_t flow = 0; flow < 2; ++flow)
+        {
+            NS_TEST_EXPECT_MSG_EQ(m_lostPackets[i][flow],
+                                  expected[i][flow],
+                                  "Unexpected lost packets of flow " << flow + 1 << " at "
+                                                                     << 10.75 + i << " s");
+        }
+    }
+    m_monitor = nullptr;
+}
+
+/**
+ * \ingroup flow-monitor-test
+ * \ingroup tests
+ *
+ * FlowMonitor TestSuite
+ */
+class FlowMonitorTestSuite : public TestSuite
+{
+  public:
+    FlowMonitorTestSuite();
+};
+
+FlowMonitorTestSuite::FlowMonitorTestSuite()
+    : TestSuite("flow-monitor", UNIT)
+{
+    AddTestCase(new FlowMonitorLostPacketsTestCase, TestCase::QUICK);
+}
+
+static FlowMonitorTestSuite g_flowMonitorTestSuite; //!< Static variable for test initialization
@@ -89,6 +89,18 @@ class Ipv4GlobalRoutingHelper : public Ipv4RoutingHelper
      *
      */
     static void RecomputeRoutingTables();
+    /**
+     * \brief Update the routes that were previously installed in a prior call
+     * to either PopulateRoutingTables(), RecomputeRoutingTables() or
+     * UpdateRoutingTables() to reflect the changes of the topology.
+     *
+     * This method yields the same routes as RecomputeRoutingTables(), but only
+     * the routes of the nodes that may be affected by the topology changes
+     * are recomputed (see GlobalRouteManager::UpdateRoutes()).  Users must
+     * first call PopulateRoutingTables() and then may subsequently call
+     * UpdateRoutingTables() at any later time in the simulation.
+     */
+    static void UpdateRoutingTables();
 };
 
 } // namespace ns3
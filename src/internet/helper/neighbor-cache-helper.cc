@@ -29,6 +29,9 @@
 #include "ns3/ptr.h"
 #include "ns3/simulator.h"
 
+#include <map>
+#include <utility>
+
 namespace ns3
 {
 
@@ -60,145 +63,62 @@ void
 NeighborCacheHelper::PopulateNeighborCache(Ptr<Channel> channel) const
 {
     NS_LOG_FUNCTION(this << channel);
+    std::vector<Ptr<Ipv4Interface>> ipv4Interfaces;
+    std::vector<Ptr<Ipv6Interface>> ipv6Interfaces;
     for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
     {
         Ptr<NetDevice> netDevice = channel->GetDevice(i);
-        Ptr<Node> node = netDevice->GetNode();
-
-        int32_t ipv4InterfaceIndex = -1;
-        if (node->GetObject<Ipv4>())
+        if (Ptr<Ipv4Interface> ipv4Interface = GetIpv4Interface(netDevice))
         {
-            ipv4InterfaceIndex = node->GetObject<Ipv4>()->GetInterfaceForDevice(netDevice);
+            ipv4Interfaces.push_back(ipv4Interface);
         }
-        int32_t ipv6InterfaceIndex = -1;
-        if (node->GetObject<Ipv6>())
+        if (Ptr<Ipv6Interface> ipv6Interface = GetIpv6Interface(netDevice))
         {
-            ipv6InterfaceIndex = node->GetObject<Ipv6>()->GetInterfaceForDevice(netDevice);
-        }
-
-        for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
-        {
-            Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-            Ptr<Node> neighborNode = neighborDevice->GetNode();
-
-            int32_t ipv4NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv4>())
-            {
-                ipv4NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-            }
-            int32_t ipv6NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv6>())
-            {
-                ipv6NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-            }
-
-            if (neighborDevice != netDevice)
-            {
-                if (ipv4InterfaceIndex != -1)
-                {
-                    Ptr<Ipv4Interface> ipv4Interface =
-                        node->GetObject<Ipv4L3Protocol>()->GetInterface(ipv4InterfaceIndex);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
-                if (ipv6InterfaceIndex != -1)
-                {
-                    Ptr<Ipv6Interface> ipv6Interface =
-                        node->GetObject<Ipv6L3Protocol>()->GetInterface(ipv6InterfaceIndex);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
-            }
+            ipv6Interfaces.push_back(ipv6Interface);
         }
     }
+    PopulateNeighborCache(channel, ipv4Interfaces, ipv6Interfaces);
 }
 
 void
 NeighborCacheHelper::PopulateNeighborCache(const NetDeviceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    // group the interfaces by channel, so that the neighbors on every channel are only
+    // looked up once
+    std::map<Ptr<Channel>,
+             std::pair<std::vector<Ptr<Ipv4Interface>>, std::vector<Ptr<Ipv6Interface>>>>
+        interfaces;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         Ptr<NetDevice> netDevice = c.Get(i);
         Ptr<Channel> channel = netDevice->GetChannel();
-        Ptr<Node> node = netDevice->GetNode();
-
-        int32_t ipv4InterfaceIndex = -1;
-        if (node->GetObject<Ipv4>())
+        if (!channel)
         {
-            ipv4InterfaceIndex = node->GetObject<Ipv4>()->GetInterfaceForDevice(netDevice);
+            NS_LOG_LOGIC("NetDevice " << netDevice << " is not attached to a channel");
+            continue;
         }
-        int32_t ipv6InterfaceIndex = -1;
-        if (node->GetObject<Ipv6>())
+        auto& [ipv4Interfaces, ipv6Interfaces] = interfaces[channel];
+        if (Ptr<Ipv4Interface> ipv4Interface = GetIpv4Interface(netDevice))
         {
-            ipv6InterfaceIndex = node->GetObject<Ipv6>()->GetInterfaceForDevice(netDevice);
+            ipv4Interfaces.push_back(ipv4Interface);
         }
-
-        for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+        if (Ptr<Ipv6Interface> ipv6Interface = GetIpv6Interface(netDevice))
         {
-            Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-            Ptr<Node> neighborNode = neighborDevice->GetNode();
-
-            int32_t ipv4NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv4>())
-            {
-                ipv4NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-            }
-            int32_t ipv6NeighborInterfaceIndex = -1;
-            if (neighborNode->GetObject<Ipv6>())
-            {
-                ipv6NeighborInterfaceIndex =
-                    neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-            }
-
-            if (neighborDevice != netDevice)
-            {
-                if (ipv4InterfaceIndex != -1)
-                {
-                    Ptr<Ipv4Interface> ipv4Interface =
-                        node->GetObject<Ipv4L3Protocol>()->GetInterface(ipv4InterfaceIndex);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
-                if (ipv6InterfaceIndex != -1)
-                {
-                    Ptr<Ipv6Interface> ipv6Interface =
-                        node->GetObject<Ipv6L3Protocol>()->GetInterface(ipv6InterfaceIndex);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
-            }
+            ipv6Interfaces.push_back(ipv6Interface);
         }
     }
+    for (const auto& [channel, channelInterfaces] : interfaces)
+    {
+        PopulateNeighborCache(channel, channelInterfaces.first, channelInterfaces.second);
+    }
 }
 
 void
 NeighborCacheHelper::PopulateNeighborCache(const Ipv4InterfaceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    std::map<Ptr<Channel>, std::vector<Ptr<Ipv4Interface>>> interfaces;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         std::pair<Ptr<Ipv4>, uint32_t> returnValue = c.Get(i);
@@ -207,33 +127,21 @@ NeighborCacheHelper::PopulateNeighborCache(const Ipv4InterfaceContainer& c) cons
         Ptr<Ipv4Interface> ipv4Interface = DynamicCast<Ipv4L3Protocol>(ipv4)->GetInterface(index);
         if (ipv4Interface)
         {
-            Ptr<NetDevice> netDevice = ipv4Interface->GetDevice();
-            Ptr<Channel> channel = netDevice->GetChannel();
-            for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
-            {
-                Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-                if (neighborDevice != netDevice)
-                {
-                    Ptr<Node> neighborNode = neighborDevice->GetNode();
-                    int32_t ipv4NeighborInterfaceIndex =
-                        neighborNode->GetObject<Ipv4>()->GetInterfaceForDevice(neighborDevice);
-                    if (ipv4NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv4Interface> ipv4NeighborInterface =
-                            neighborNode->GetObject<Ipv4L3Protocol>()->GetInterface(
-                                ipv4NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4NeighborInterface);
-                    }
-                }
-            }
+            Ptr<Channel> channel = ipv4Interface->GetDevice()->GetChannel();
+            interfaces[channel].push_back(ipv4Interface);
         }
     }
+    for (const auto& [channel, ipv4Interfaces] : interfaces)
+    {
+        PopulateNeighborCache(channel, ipv4Interfaces, {});
+    }
 }
 
 void
 NeighborCacheHelper::PopulateNeighborCache(const Ipv6InterfaceContainer& c) const
 {
     NS_LOG_FUNCTION(this);
+    std::map<Ptr<Channel>, std::vector<Ptr<Ipv6Interface>>> interfaces;
     for (uint32_t i = 0; i < c.GetN(); ++i)
     {
         std::pair<Ptr<Ipv6>, uint32_t> returnValue = c.Get(i);
@@ -242,35 +150,84 @@ NeighborCacheHelper::PopulateNeighborCache(const Ipv6InterfaceContainer& c) cons
         Ptr<Ipv6Interface> ipv6Interface = DynamicCast<Ipv6L3Protocol>(ipv6)->GetInterface(index);
         if (ipv6Interface)
         {
-            Ptr<NetDevice> netDevice = ipv6Interface->GetDevice();
-            Ptr<Channel> channel = netDevice->GetChannel();
-            for (std::size_t j = 0; j < channel->GetNDevices(); ++j)
+            Ptr<Channel> channel = ipv6Interface->GetDevice()->GetChannel();
+            interfaces[channel].push_back(ipv6Interface);
+        }
+    }
+    for (const auto& [channel, ipv6Interfaces] : interfaces)
+    {
+        PopulateNeighborCache(channel, {}, ipv6Interfaces);
+    }
+}
+
+void
+NeighborCacheHelper::PopulateNeighborCache(
+    Ptr<Channel> channel,
+    const std::vector<Ptr<Ipv4Interface>>& ipv4Interfaces,
+    const std::vector<Ptr<Ipv6Interface>>& ipv6Interfaces) const
+{
+    NS_LOG_FUNCTION(this << channel << ipv4Interfaces.size() << ipv6Interfaces.size());
+
+    std::vector<Ptr<Ipv4Interface>> ipv4Neighbors;
+    std::vector<Ptr<Ipv6Interface>> ipv6Neighbors;
+    for (std::size_t i = 0; i < channel->GetNDevices(); ++i)
+    {
+        Ptr<NetDevice> neighborDevice = channel->GetDevice(i);
+        if (!ipv4Interfaces.empty())
+        {
+            if (Ptr<Ipv4Interface> ipv4Neighbor = GetIpv4Interface(neighborDevice))
             {
-                Ptr<NetDevice> neighborDevice = channel->GetDevice(j);
-                if (neighborDevice != netDevice)
-                {
-                    Ptr<Node> neighborNode = neighborDevice->GetNode();
-                    int32_t ipv6NeighborInterfaceIndex =
-                        neighborNode->GetObject<Ipv6>()->GetInterfaceForDevice(neighborDevice);
-                    if (ipv6NeighborInterfaceIndex != -1)
-                    {
-                        Ptr<Ipv6Interface> ipv6NeighborInterface =
-                            neighborNode->GetObject<Ipv6L3Protocol>()->GetInterface(
-                                ipv6NeighborInterfaceIndex);
-                        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6NeighborInterface);
-                    }
-                }
+                ipv4Neighbors.push_back(ipv4Neighbor);
+            }
+        }
+        if (!ipv6Interfaces.empty())
+        {
+            if (Ptr<Ipv6Interface> ipv6Neighbor = GetIpv6Interface(neighborDevice))
+            {
+                ipv6Neighbors.push_back(ipv6Neighbor);
             }
         }
     }
+
+    for (const auto& ipv4Interface : ipv4Interfaces)
+    {
+        PopulateNeighborEntriesIpv4(ipv4Interface, ipv4Neighbors);
+    }
+    for (const auto& ipv6Interface : ipv6Interfaces)
+    {
+        PopulateNeighborEntriesIpv6(ipv6Interface, ipv6Neighbors);
+    }
+}
+
+Ptr<Ipv4Interface>
+NeighborCacheHelper::GetIpv4Interface(Ptr<NetDevice> netDevice)
+{
+    Ptr<Ipv4L3Protocol> ipv4 = netDevice->GetNode()->GetObject<Ipv4L3Protocol>();
+    if (!ipv4)
+    {
+        return nullptr;
+    }
+    int32_t ipv4InterfaceIndex = ipv4->GetInterfaceForDevice(netDevice);
+    return ipv4InterfaceIndex != -1 ? ipv4->GetInterface(ipv4InterfaceIndex) : nullptr;
+}
+
+Ptr<Ipv6Interface>
+NeighborCacheHelper::GetIpv6Interface(Ptr<NetDevice> netDevice)
+{
+    Ptr<Ipv6L3Protocol> ipv6 = netDevice->GetNode()->GetObject<Ipv6L3Protocol>();
+    if (!ipv6)
+    {
+        return nullptr;
+    }
+    int32_t ipv6InterfaceIndex = ipv6->GetInterfaceForDevice(netDevice);
+    return ipv6InterfaceIndex != -1 ? ipv6->GetInterface(ipv6InterfaceIndex) : nullptr;
 }
 
 void
-NeighborCacheHelper::PopulateNeighborEntriesIpv4(Ptr<Ipv4Interface> ipv4Interface,
-                                                 Ptr<Ipv4Interface> neighborDeviceInterface) const
+NeighborCacheHelper::PopulateNeighborEntriesIpv4(
+    Ptr<Ipv4Interface> ipv4Interface,
+    const std::vector<Ptr<Ipv4Interface>>& neighborInterfaces) const
 {
-    uint32_t netDeviceAddresses = ipv4Interface->GetNAddresses();
-    uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
     if (m_dynamicNeighborCache)
     {
         ipv4Interface->RemoveAddressCallback(
@@ -281,30 +238,47 @@ NeighborCacheHelper::PopulateNeighborEntriesIpv4(Ptr<Ipv4Interface> ipv4Interfac
                 MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv4AddressAdded, this));
         }
     }
-    for (uint32_t n = 0; n < netDeviceAddresses; ++n)
+    Ptr<ArpCache> arpCache = ipv4Interface->GetArpCache();
+    if (!arpCache)
+    {
+        NS_LOG_LOGIC(
+            "ArpCache doesn't exist, might be a point-to-point NetDevice without ArpCache");
+        return;
+    }
+
+    std::vector<std::pair<Ipv4Address, Address>> entries;
+    uint32_t netDeviceAddresses = ipv4Interface->GetNAddresses();
+    for (const auto& neighborDeviceInterface : neighborInterfaces)
     {
-        Ipv4InterfaceAddress netDeviceIfAddr = ipv4Interface->GetAddress(n);
-        for (uint32_t m = 0; m < neighborDeviceAddresses; ++m)
+        if (neighborDeviceInterface == ipv4Interface)
         {
-            Ipv4InterfaceAddress neighborDeviceIfAddr = neighborDeviceInterface->GetAddress(m);
-            if (netDeviceIfAddr.IsInSameSubnet(neighborDeviceIfAddr.GetLocal()))
+            continue;
+        }
+        Address neighborMacAddress = neighborDeviceInterface->GetDevice()->GetAddress();
+        uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
+        for (uint32_t n = 0; n < netDeviceAddresses; ++n)
+        {
+            Ipv4InterfaceAddress netDeviceIfAddr = ipv4Interface->GetAddress(n);
+            for (uint32_t m = 0; m < neighborDeviceAddresses; ++m)
             {
-                Ptr<NetDevice> neighborDevice = neighborDeviceInterface->GetDevice();
-                // Add Arp entry of neighbor interface to current interface's Arp cache
-                AddEntry(ipv4Interface,
-                         neighborDeviceIfAddr.GetAddress(),
-                         neighborDevice->GetAddress());
+                Ipv4InterfaceAddress neighborDeviceIfAddr = neighborDeviceInterface->GetAddress(m);
+                if (netDeviceIfAddr.IsInSameSubnet(neighborDeviceIfAddr.GetLocal()))
+                {
+                    // Add Arp entry of neighbor interface to current interface's Arp cache
+                    entries.emplace_back(neighborDeviceIfAddr.GetAddress(), neighborMacAddress);
+                }
             }
         }
     }
+    NS_LOG_LOGIC("Adding " << entries.size() << " ARP entries");
+    arpCache->AddAutoGeneratedEntries(std::move(entries));
 }
 
 void
-NeighborCacheHelper::PopulateNeighborEntriesIpv6(Ptr<Ipv6Interface> ipv6Interface,
-                                                 Ptr<Ipv6Interface> neighborDeviceInterface) const
+NeighborCacheHelper::PopulateNeighborEntriesIpv6(
+    Ptr<Ipv6Interface> ipv6Interface,
+    const std::vector<Ptr<Ipv6Interface>>& neighborInterfaces) const
 {
-    uint32_t netDeviceAddresses = ipv6Interface->GetNAddresses();
-    uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
     if (m_dynamicNeighborCache)
     {
         ipv6Interface->RemoveAddressCallback(
@@ -315,43 +289,61 @@ NeighborCacheHelper::PopulateNeighborEntriesIpv6(Ptr<Ipv6Interface> ipv6Interfac
                 MakeCallback(&NeighborCacheHelper::UpdateCacheByIpv6AddressAdded, this));
         }
     }
-    for (uint32_t n = 0; n < netDeviceAddresses; ++n)
+    Ptr<NdiscCache> ndiscCache = ipv6Interface->GetNdiscCache();
+    if (!ndiscCache)
+    {
+        NS_LOG_LOGIC(
+            "NdiscCache doesn't exist, might be a point-to-point NetDevice without NdiscCache");
+        return;
+    }
+
+    std::vector<std::pair<Ipv6Address, Address>> entries;
+    uint32_t netDeviceAddresses = ipv6Interface->GetNAddresses();
+    for (const auto& neighborDeviceInterface : neighborInterfaces)
     {
-        Ipv6InterfaceAddress netDeviceIfAddr = ipv6Interface->GetAddress(n);
-        // Ignore if it is a linklocal address, which will be added along with the global address
-        if (netDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::LINKLOCAL ||
-            netDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::HOST)
+        if (neighborDeviceInterface == ipv6Interface)
         {
-            NS_LOG_LOGIC("Skip the LINKLOCAL or LOCALHOST interface " << netDeviceIfAddr);
             continue;
         }
-        for (uint32_t m = 0; m < neighborDeviceAddresses; ++m)
+        Address neighborMacAddress = neighborDeviceInterface->GetDevice()->GetAddress();
+        uint32_t neighborDeviceAddresses = neighborDeviceInterface->GetNAddresses();
+        for (uint32_t n = 0; n < netDeviceAddresses; ++n)
         {
+            Ipv6InterfaceAddress netDeviceIfAddr = ipv6Interface->GetAddress(n);
             // Ignore if it is a linklocal address, which will be added along with the global
             // address
-            Ipv6InterfaceAddress neighborDeviceIfAddr = neighborDeviceInterface->GetAddress(m);
-            if (neighborDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::LINKLOCAL ||
-                neighborDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::HOST)
+            if (netDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::LINKLOCAL ||
+                netDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::HOST)
             {
-                NS_LOG_LOGIC("Skip the LINKLOCAL or LOCALHOST interface " << neighborDeviceIfAddr);
+                NS_LOG_LOGIC("Skip the LINKLOCAL or LOCALHOST interface " << netDeviceIfAddr);
                 continue;
             }
-            if (netDeviceIfAddr.IsInSameSubnet(neighborDeviceIfAddr.GetAddress()))
+            for (uint32_t m = 0; m < neighborDeviceAddresses; ++m)
             {
-                Ptr<NetDevice> neighborDevice = neighborDeviceInterface->GetDevice();
-                // Add neighbor's Ndisc entries of global address and linklocal address to current
-                // interface's Ndisc cache
-                AddEntry(ipv6Interface,
-                         neighborDeviceIfAddr.GetAddress(),
-                         neighborDevice->GetAddress());
-                Ipv6InterfaceAddress neighborlinkLocalAddr =
-                    neighborDeviceInterface->GetLinkLocalAddress();
-                AddEntry(ipv6Interface,
-                         neighborlinkLocalAddr.GetAddress(),
-                         neighborDevice->GetAddress());
+                // Ignore if it is a linklocal address, which will be added along with the
+                // global address
+                Ipv6InterfaceAddress neighborDeviceIfAddr = neighborDeviceInterface->GetAddress(m);
+                if (neighborDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::LINKLOCAL ||
+                    neighborDeviceIfAddr.GetScope() == Ipv6InterfaceAddress::HOST)
+                {
+                    NS_LOG_LOGIC("Skip the LINKLOCAL or LOCALHOST interface "
+                                 << neighborDeviceIfAddr);
+                    continue;
+                }
+                if (netDeviceIfAddr.IsInSameSubnet(neighborDeviceIfAddr.GetAddress()))
+                {
+                    // Add neighbor's Ndisc entries of global address and linklocal address to
+                    // current interface's Ndisc cache
+                    entries.emplace_back(neighborDeviceIfAddr.GetAddress(), neighborMacAddress);
+                    entries.emplace_back(
+                        neighborDeviceInterface->GetLinkLocalAddress().GetAddress(),
+                        neighborMacAddress);
+                }
             }
         }
     }
+    NS_LOG_LOGIC("Adding " << entries.size() << " NDISC entries");
+    ndiscCache->AddAutoGeneratedEntries(std::move(entries));
 }
 
 void
@@ -36,6 +36,8 @@
 #include "ns3/net-device-container.h"
 #include "ns3/node-list.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -46,6 +48,9 @@ namespace ns3
  *
  * This class is used to populate neighbor cache. Permanent entries will be added
  * on the scope of a channel, a NetDeviceContainer, an InterfaceContainer or globally.
+ * The neighbors attached to a channel are looked up once per channel and the
+ * entries of every cache are added in bulk (see ArpCache::AddAutoGeneratedEntries
+ * and NdiscCache::AddAutoGeneratedEntries).
  */
 class NeighborCacheHelper
 {
@@ -105,21 +110,48 @@ class NeighborCacheHelper
     void SetDynamicNeighborCache(bool enable);
 
   private:
+    /**
+     * \brief Populate the neighbor ARP and NDISC caches of the given interfaces, which are
+     * attached to the given Channel, with the addresses of all their neighbors on the Channel.
+     * \param channel the Channel to process
+     * \param ipv4Interfaces the IPv4 interfaces whose ARP cache is populated
+     * \param ipv6Interfaces the IPv6 interfaces whose NDISC cache is populated
+     */
+    void PopulateNeighborCache(Ptr<Channel> channel,
+                               const std::vector<Ptr<Ipv4Interface>>& ipv4Interfaces,
+                               const std::vector<Ptr<Ipv6Interface>>& ipv6Interfaces) const;
+
+    /**
+     * \brief Get the IPv4 interface of the given NetDevice.
+     * \param netDevice the NetDevice
+     * \return the IPv4 interface of the NetDevice, if any, or a null pointer
+     */
+    static Ptr<Ipv4Interface> GetIpv4Interface(Ptr<NetDevice> netDevice);
+
+    /**
+     * \brief Get the IPv6 interface of the given NetDevice.
+     * \param netDevice the NetDevice
+     * \return the IPv6 interface of the NetDevice, if any, or a null pointer
+     */
+    static Ptr<Ipv6Interface> GetIpv6Interface(Ptr<NetDevice> netDevice);
+
     /**
      * \brief Populate neighbor ARP entries for given IPv4 interface.
      * \param ipv4Interface the Ipv4Interface to process
-     * \param neighborDeviceInterface the potential neighbor Ipv4Interface
+     * \param neighborInterfaces the potential neighbor Ipv4Interfaces
      */
-    void PopulateNeighborEntriesIpv4(Ptr<Ipv4Interface> ipv4Interface,
-                                     Ptr<Ipv4Interface> neighborDeviceInterface) const;
+    void PopulateNeighborEntriesIpv4(
+        Ptr<Ipv4Interface> ipv4Interface,
+        const std::vector<Ptr<Ipv4Interface>>& neighborInterfaces) const;
 
     /**
      * \brief Populate neighbor NDISC entries for given IPv6 interface.
      * \param ipv6Interface the Ipv6Interface to process
-     * \param neighborDeviceInterface the potential neighbor Ipv6Interface
+     * \param neighborInterfaces the potential neighbor Ipv6Interfaces
      */
-    void PopulateNeighborEntriesIpv6(Ptr<Ipv6Interface> ipv6Interface,
-                                     Ptr<Ipv6Interface> neighborDeviceInterface) const;
+    void PopulateNeighborEntriesIpv6(
+        Ptr<Ipv6Interface> ipv6Interface,
+        const std::vector<Ptr<Ipv6Interface>>& neighborInterfaces) const;
 
     /**
      * \brief Add an auto_generated entry to the ARP cache of an interface.
@@ -30,6 +30,8 @@
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -360,6 +362,34 @@ ArpCache::Add(Ipv4Address to)
     return entry;
 }
 
+void
+ArpCache::AddAutoGeneratedEntries(std::vector<std::pair<Ipv4Address, Address>> entries)
+{
+    NS_LOG_FUNCTION(this << entries.size());
+    std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    // walk the cache along with the sorted entries, so that every entry is found or
+    // inserted next to the position of the previous one
+    auto it = m_arpCache.begin();
+    for (const auto& [to, macAddress] : entries)
+    {
+        while (it != m_arpCache.end() && it->first < to)
+        {
+            ++it;
+        }
+        if (it == m_arpCache.end() || to < it->first)
+        {
+            auto entry = new ArpCache::Entry(this);
+            entry->SetIpv4Address(to);
+            it = m_arpCache.emplace_hint(it, to, entry);
+        }
+        it->second->SetMacAddress(macAddress);
+        it->second->MarkAutoGenerated();
+    }
+}
+
 void
 ArpCache::Remove(ArpCache::Entry* entry)
 {
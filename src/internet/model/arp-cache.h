@@ -34,6 +34,8 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -150,6 +152,17 @@ class ArpCache : public Object
      * \returns A pointer to a new ARP Entry.
      */
     ArpCache::Entry* Add(Ipv4Address to);
+    /**
+     * \brief Add auto-generated entries to this ARP cache
+     *
+     * Every IPv4 address is resolved to the paired MAC address by an entry marked
+     * as auto-generated, which is added to the cache if there is no entry for the
+     * IPv4 address yet. The entries are sorted and merged with the cache in a
+     * single pass, rather than looked up and added one at a time.
+     *
+     * \param entries the IPv4 addresses and the MAC addresses they resolve to
+     */
+    void AddAutoGeneratedEntries(std::vector<std::pair<Ipv4Address, Address>> entries);
     /**
      * \brief Remove an entry.
      * \param entry pointer to delete it from the list
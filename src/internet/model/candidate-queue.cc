@@ -22,8 +22,8 @@
 #include "ns3/assert.h"
 #include "ns3/log.h"
 
-#include <algorithm>
 #include <iostream>
+#include <vector>
 
 namespace ns3
 {
@@ -63,15 +63,16 @@ operator<<(std::ostream& os, const CandidateQueue& q)
     os << "*** CandidateQueue Begin (<id, distance, LSA-type>) ***" << std::endl;
     for (auto iter = list.begin(); iter != list.end(); iter++)
     {
-        os << "<" << (*iter)->GetVertexId() << ", " << (*iter)->GetDistanceFromRoot() << ", "
-           << (*iter)->GetVertexType() << ">" << std::endl;
+        os << "<" << iter->second->GetVertexId() << ", " << iter->second->GetDistanceFromRoot()
+           << ", " << iter->second->GetVertexType() << ">" << std::endl;
     }
     os << "*** CandidateQueue End ***";
     return os;
 }
 
 CandidateQueue::CandidateQueue()
-    : m_candidates()
+    : m_candidates(),
+      m_pushed(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -94,16 +95,31 @@ CandidateQueue::Clear()
     }
 }
 
+CandidateQueue::CandidateKey_t
+CandidateQueue::GetKey(const SPFVertex* v)
+{
+    return {v->GetDistanceFromRoot(),
+            v->GetVertexType() == SPFVertex::VertexNetwork ? 0 : 1,
+            m_pushed++};
+}
+
+void
+CandidateQueue::Insert(SPFVertex* v)
+{
+    auto it = m_candidates.emplace(GetKey(v), v).first;
+    // if several candidates have the same ID, the index refers to the first one
+    auto [indexIt, inserted] = m_index.emplace(v->GetVertexId(), it);
+    if (!inserted && CompareSPFVertex(v, indexIt->second->second))
+    {
+        indexIt->second = it;
+    }
+}
+
 void
 CandidateQueue::Push(SPFVertex* vNew)
 {
     NS_LOG_FUNCTION(this << vNew);
-
-    auto i = std::upper_bound(m_candidates.begin(),
-                              m_candidates.end(),
-                              vNew,
-                              &CandidateQueue::CompareSPFVertex);
-    m_candidates.insert(i, vNew);
+    Insert(vNew);
 }
 
 SPFVertex*
@@ -115,8 +131,14 @@ CandidateQueue::Pop()
         return nullptr;
     }
 
-    SPFVertex* v = m_candidates.front();
-    m_candidates.pop_front();
+    auto it = m_candidates.begin();
+    SPFVertex* v = it->second;
+    if (auto indexIt = m_index.find(v->GetVertexId());
+        indexIt != m_index.end() && indexIt->second == it)
+    {
+        m_index.erase(indexIt);
+    }
+    m_candidates.erase(it);
     return v;
 }
 
@@ -129,7 +151,7 @@ CandidateQueue::Top() const
         return nullptr;
     }
 
-    return m_candidates.front();
+    return m_candidates.begin()->second;
 }
 
 bool
@@ -150,26 +172,50 @@ SPFVertex*
 CandidateQueue::Find(const Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this);
-    auto i = m_candidates.begin();
+    auto it = m_index.find(addr);
+    return it != m_index.end() ? it->second->second : nullptr;
+}
 
-    for (; i != m_candidates.end(); i++)
+void
+CandidateQueue::Reorder()
+{
+    NS_LOG_FUNCTION(this);
+
+    // Re-insert the vertices in their current order, so that vertices with the
+    // same distance and type keep their relative order (as a stable sort)
+    std::vector<SPFVertex*> vertices;
+    vertices.reserve(m_candidates.size());
+    for (const auto& [key, v] : m_candidates)
     {
-        SPFVertex* v = *i;
-        if (v->GetVertexId() == addr)
-        {
-            return v;
-        }
+        vertices.push_back(v);
     }
-
-    return nullptr;
+    m_candidates.clear();
+    m_index.clear();
+    for (auto v : vertices)
+    {
+        Insert(v);
+    }
+    NS_LOG_LOGIC("After reordering the CandidateQueue");
+    NS_LOG_LOGIC(*this);
 }
 
 void
-CandidateQueue::Reorder()
+CandidateQueue::Reorder(SPFVertex* v)
 {
-    NS_LOG_FUNCTION(this);
+    NS_LOG_FUNCTION(this << v);
 
-    m_candidates.sort(&CandidateQueue::CompareSPFVertex);
+    auto indexIt = m_index.find(v->GetVertexId());
+    if (indexIt == m_index.end() || indexIt->second->second != v)
+    {
+        Reorder();
+        return;
+    }
+    // The distance of the vertex has decreased, hence a stable sort would move
+    // the vertex after all the other vertices having the same (new) key, which
+    // is where a vertex pushed now is inserted
+    m_candidates.erase(indexIt->second);
+    m_index.erase(indexIt);
+    Insert(v);
     NS_LOG_LOGIC("After reordering the CandidateQueue");
     NS_LOG_LOGIC(*this);
 }
@@ -22,8 +22,10 @@
 
 #include "ns3/ipv4-address.h"
 
-#include <list>
+#include <map>
 #include <stdint.h>
+#include <tuple>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -159,7 +161,28 @@ class CandidateQueue
      */
     void Reorder();
 
+    /**
+     * @brief Moves a vertex whose m_distanceFromRoot has decreased to its new
+     * position in the Candidate Queue.
+     *
+     * This is equivalent to Reorder () when only the given vertex has changed,
+     * but it only takes a time logarithmic in the size of the queue.
+     *
+     * @see SPFVertex
+     * @param v The Shortest Path First Vertex whose distance has changed.
+     */
+    void Reorder(SPFVertex* v);
+
   private:
+    /**
+     * The key ordering the candidates: the distance from the root, the rank
+     * of the vertex type (network vertices are ranked before router vertices
+     * at the same distance, which is necessary for implementing ECMP) and the
+     * insertion order, so that vertices with the same distance and type are
+     * popped in the order they have been pushed.
+     */
+    typedef std::tuple<uint32_t, uint8_t, uint64_t> CandidateKey_t;
+
     /**
      * \brief return true if v1 < v2
      *
@@ -173,8 +196,29 @@ class CandidateQueue
      */
     static bool CompareSPFVertex(const SPFVertex* v1, const SPFVertex* v2);
 
-    typedef std::list<SPFVertex*> CandidateList_t; //!< container of SPFVertex pointers
-    CandidateList_t m_candidates;                  //!< SPFVertex candidates
+    /**
+     * \brief Compute the key for a vertex pushed (or moved) now.
+     *
+     * \param v the vertex
+     * \return the key ordering the vertex in the queue
+     */
+    CandidateKey_t GetKey(const SPFVertex* v);
+
+    /**
+     * \brief Insert a vertex in the queue.
+     *
+     * \param v the vertex
+     */
+    void Insert(SPFVertex* v);
+
+    /// container of SPFVertex pointers
+    typedef std::map<CandidateKey_t, SPFVertex*> CandidateList_t;
+    CandidateList_t m_candidates; //!< SPFVertex candidates
+
+    /// The candidates indexed by vertex ID, to find them in logarithmic time
+    std::unordered_map<Ipv4Address, CandidateList_t::iterator, Ipv4AddressHash> m_index;
+
+    uint64_t m_pushed; //!< the number of vertices pushed (or moved) so far
 
     /**
      * \brief Stream insertion operator.
@@ -30,13 +30,18 @@
 
 #include "ns3/assert.h"
 #include "ns3/fatal-error.h"
+#include "ns3/global-value.h"
 #include "ns3/log.h"
 #include "ns3/node-list.h"
 #include "ns3/simulator.h"
+#include "ns3/uinteger.h"
 
 #include <algorithm>
+#include <atomic>
 #include <iostream>
+#include <memory>
 #include <queue>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -45,6 +50,21 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("GlobalRouteManagerImpl");
 
+/**
+ * \ingroup globalrouting
+ * \anchor GlobalValueGlobalRoutingSpfThreads
+ * \brief The number of threads running the SPF calculations of the global routing.
+ *
+ * The log messages of the SPF calculations run by different threads may be
+ * interleaved.
+ */
+static GlobalValue g_spfThreads =
+    GlobalValue("GlobalRoutingSpfThreads",
+                "The number of threads running the SPF calculations of the global routing "
+                "(0 to use as many threads as hardware threads)",
+                UintegerValue(1),
+                MakeUintegerChecker<uint32_t>());
+
 /**
  * \brief Stream insertion operator.
  *
@@ -426,7 +446,8 @@ SPFVertex::ClearVertexProcessed()
 
 GlobalRouteManagerLSDB::GlobalRouteManagerLSDB()
     : m_database(),
-      m_extdatabase()
+      m_extdatabase(),
+      m_indexesValid(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -473,6 +494,7 @@ GlobalRouteManagerLSDB::Insert(Ipv4Address addr, GlobalRoutingLSA* lsa)
     {
         m_database.insert(LSDBPair_t(addr, lsa));
     }
+    m_indexesValid = false;
 }
 
 GlobalRoutingLSA*
@@ -496,14 +518,8 @@ GlobalRouteManagerLSDB::GetLSA(Ipv4Address addr) const
     //
     // Look up an LSA by its address.
     //
-    for (auto i = m_database.begin(); i != m_database.end(); i++)
-    {
-        if (i->first == addr)
-        {
-            return i->second;
-        }
-    }
-    return nullptr;
+    auto i = m_database.find(addr);
+    return i != m_database.end() ? i->second : nullptr;
 }
 
 GlobalRoutingLSA*
@@ -511,8 +527,95 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
 {
     NS_LOG_FUNCTION(this << addr);
     //
-    // Look up an LSA by its address.
+    // Look up an LSA by the LinkData field of its TransitNetwork link records.
     //
+    BuildIndexes();
+    auto i = m_linkDataIndex.find(addr);
+    return i != m_linkDataIndex.end() ? i->second : nullptr;
+}
+
+const std::vector<GlobalRoutingLSA*>&
+GlobalRouteManagerLSDB::GetAttachedRouterLSAs(GlobalRoutingLSA* lsa) const
+{
+    NS_LOG_FUNCTION(this << lsa);
+    NS_ASSERT(lsa->GetLSType() == GlobalRoutingLSA::NetworkLSA);
+
+    BuildIndexes();
+    auto [i, inserted] = m_attachedRouters.try_emplace(lsa);
+    if (inserted)
+    {
+        for (uint32_t j = 0; j < lsa->GetNAttachedRouters(); j++)
+        {
+            GlobalRoutingLSA* temp = GetLSAByLinkData(lsa->GetAttachedRouter(j));
+            if (!temp)
+            {
+                continue;
+            }
+            if (IsLeafRouter(temp) &&
+                temp->GetLinkRecord(0)->GetLinkId() == lsa->GetLinkStateId())
+            {
+                NS_LOG_LOGIC("Leaving out leaf router " << temp->GetLinkStateId()
+                                                        << " attached to network "
+                                                        << lsa->GetLinkStateId());
+                continue;
+            }
+            i->second.push_back(temp);
+        }
+    }
+    return i->second;
+}
+
+bool
+GlobalRouteManagerLSDB::IsLeafRouter(GlobalRoutingLSA* lsa) const
+{
+    NS_LOG_FUNCTION(this << lsa);
+    BuildIndexes();
+    return lsa->GetLSType() == GlobalRoutingLSA::RouterLSA && lsa->GetNLinkRecords() == 1 &&
+           lsa->GetLinkRecord(0)->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
+           m_nonLeafRouters.count(lsa->GetLinkStateId()) == 0;
+}
+
+std::vector<Ipv4Address>
+GlobalRouteManagerLSDB::GetLinkStateIds() const
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<Ipv4Address> ids;
+    ids.reserve(m_database.size());
+    for (auto i = m_database.begin(); i != m_database.end(); i++)
+    {
+        ids.push_back(i->first);
+    }
+    return ids;
+}
+
+GlobalRouteManagerLSDB*
+GlobalRouteManagerLSDB::Copy() const
+{
+    NS_LOG_FUNCTION(this);
+    auto lsdb = new GlobalRouteManagerLSDB();
+    for (auto i = m_database.begin(); i != m_database.end(); i++)
+    {
+        lsdb->m_database.insert(LSDBPair_t(i->first, new GlobalRoutingLSA(*i->second)));
+    }
+    for (auto lsa : m_extdatabase)
+    {
+        lsdb->m_extdatabase.push_back(new GlobalRoutingLSA(*lsa));
+    }
+    return lsdb;
+}
+
+void
+GlobalRouteManagerLSDB::BuildIndexes() const
+{
+    if (m_indexesValid)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this);
+
+    m_linkDataIndex.clear();
+    m_attachedRouters.clear();
+    m_nonLeafRouters.clear();
     for (auto i = m_database.begin(); i != m_database.end(); i++)
     {
         GlobalRoutingLSA* temp = i->second;
@@ -520,14 +623,78 @@ GlobalRouteManagerLSDB::GetLSAByLinkData(Ipv4Address addr) const
         for (uint32_t j = 0; j < temp->GetNLinkRecords(); j++)
         {
             GlobalRoutingLinkRecord* lr = temp->GetLinkRecord(j);
-            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork &&
-                lr->GetLinkData() == addr)
+            if (lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork)
+            {
+                // keep the first LSA in Link State ID order
+                m_linkDataIndex.emplace(lr->GetLinkData(), temp);
+            }
+            else if (lr->GetLinkType() == GlobalRoutingLinkRecord::PointToPoint)
             {
-                return temp;
+                m_nonLeafRouters.insert(lr->GetLinkId());
             }
         }
     }
-    return nullptr;
+    for (auto lsa : m_extdatabase)
+    {
+        m_nonLeafRouters.insert(lsa->GetAdvertisingRouter());
+    }
+    m_indexesValid = true;
+}
+
+/**
+ * \brief Check whether two LSAs lead to the same SPF calculations.
+ *
+ * The LSAs are the same if all their fields but the SPF status are equal,
+ * except for the attached routers of Network LSAs, which only need to be the
+ * same non-leaf routers (see GlobalRouteManagerLSDB::GetAttachedRouterLSAs).
+ *
+ * \param lsdb1 the database of the first LSA
+ * \param lsa1 the first LSA
+ * \param lsdb2 the database of the second LSA
+ * \param lsa2 the second LSA
+ * \returns true if the LSAs are the same
+ */
+static bool
+IsSameLSA(const GlobalRouteManagerLSDB& lsdb1,
+          GlobalRoutingLSA* lsa1,
+          const GlobalRouteManagerLSDB& lsdb2,
+          GlobalRoutingLSA* lsa2)
+{
+    if (lsa1->GetLSType() != lsa2->GetLSType() ||
+        lsa1->GetLinkStateId() != lsa2->GetLinkStateId() ||
+        lsa1->GetAdvertisingRouter() != lsa2->GetAdvertisingRouter() ||
+        lsa1->GetNetworkLSANetworkMask() != lsa2->GetNetworkLSANetworkMask() ||
+        lsa1->GetNLinkRecords() != lsa2->GetNLinkRecords())
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < lsa1->GetNLinkRecords(); i++)
+    {
+        GlobalRoutingLinkRecord* lr1 = lsa1->GetLinkRecord(i);
+        GlobalRoutingLinkRecord* lr2 = lsa2->GetLinkRecord(i);
+        if (lr1->GetLinkType() != lr2->GetLinkType() || lr1->GetLinkId() != lr2->GetLinkId() ||
+            lr1->GetLinkData() != lr2->GetLinkData() || lr1->GetMetric() != lr2->GetMetric())
+        {
+            return false;
+        }
+    }
+    if (lsa1->GetLSType() == GlobalRoutingLSA::NetworkLSA)
+    {
+        const auto& routers1 = lsdb1.GetAttachedRouterLSAs(lsa1);
+        const auto& routers2 = lsdb2.GetAttachedRouterLSAs(lsa2);
+        if (routers1.size() != routers2.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < routers1.size(); i++)
+        {
+            if (routers1[i]->GetLinkStateId() != routers2[i]->GetLinkStateId())
+            {
+                return false;
+            }
+        }
+    }
+    return true;
 }
 
 // ---------------------------------------------------------------------------
@@ -543,6 +710,14 @@ GlobalRouteManagerImpl::GlobalRouteManagerImpl()
     m_lsdb = new GlobalRouteManagerLSDB();
 }
 
+GlobalRouteManagerImpl::GlobalRouteManagerImpl(GlobalRouteManagerLSDB* lsdb)
+    : m_spfroot(nullptr),
+      m_lsdb(lsdb)
+{
+    NS_LOG_FUNCTION(this << lsdb);
+    NS_ASSERT(m_lsdb);
+}
+
 GlobalRouteManagerImpl::~GlobalRouteManagerImpl()
 {
     NS_LOG_FUNCTION(this);
@@ -611,6 +786,11 @@ GlobalRouteManagerImpl::BuildGlobalRoutingDatabase()
 {
     NS_LOG_FUNCTION(this);
     //
+    // The topology does not change while the LSAs are discovered, hence the
+    // designated router of a link only needs to be looked up once.
+    //
+    GlobalRouter::EnableDesignatedRouterCache(true);
+    //
     // Walk the list of nodes looking for the GlobalRouter Interface.  Nodes with
     // global router interfaces are, not too surprisingly, our routers.
     //
@@ -653,6 +833,7 @@ GlobalRouteManagerImpl::BuildGlobalRoutingDatabase()
             m_lsdb->Insert(lsa->GetLinkStateId(), lsa);
         }
     }
+    GlobalRouter::EnableDesignatedRouterCache(false);
 }
 
 //
@@ -696,6 +877,16 @@ GlobalRouteManagerImpl::InitializeRoutes()
     // Walk the list of nodes in the system.
     //
     NS_LOG_INFO("About to start SPF calculation");
+    SPFCalculate(GetSPFRoots());
+    NS_LOG_INFO("Finished SPF calculation");
+}
+
+std::vector<GlobalRouteManagerImpl::SPFRoot>
+GlobalRouteManagerImpl::GetSPFRoots() const
+{
+    NS_LOG_FUNCTION(this);
+    std::vector<SPFRoot> roots;
+    uint32_t systemId = Simulator::GetSystemId();
     for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
     {
         Ptr<Node> node = *i;
@@ -705,7 +896,6 @@ GlobalRouteManagerImpl::InitializeRoutes()
         //
         Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
 
-        uint32_t systemId = Simulator::GetSystemId();
         // Ignore nodes that are not assigned to our systemId (distributed sim)
         if (node->GetSystemId() != systemId)
         {
@@ -718,10 +908,228 @@ GlobalRouteManagerImpl::InitializeRoutes()
         //
         if (rtr && rtr->GetNumLSAs())
         {
-            SPFCalculate(rtr->GetRouterId());
+            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+            NS_ASSERT_MSG(ipv4,
+                          "GlobalRouteManagerImpl::GetSPFRoots (): "
+                          "GetObject for <Ipv4> interface failed");
+            roots.push_back({rtr->GetRouterId(), ipv4, rtr->GetRoutingProtocol()});
         }
     }
-    NS_LOG_INFO("Finished SPF calculation");
+    return roots;
+}
+
+void
+GlobalRouteManagerImpl::SPFCalculate(const std::vector<SPFRoot>& roots)
+{
+    NS_LOG_FUNCTION(this << roots.size());
+
+    UintegerValue spfThreads;
+    g_spfThreads.GetValue(spfThreads);
+    std::size_t nThreads = spfThreads.Get();
+    if (nThreads == 0)
+    {
+        nThreads = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    nThreads = std::min(nThreads, roots.size());
+
+    if (nThreads <= 1)
+    {
+        m_lsdb->Initialize();
+        for (const auto& root : roots)
+        {
+            SPFCalculate(root);
+        }
+        return;
+    }
+
+    //
+    // The status of the LSAs is updated during the SPF calculations, hence every
+    // thread runs the calculations on its own copy of the LSDB.  The routes of
+    // a router are only written by the thread that runs the calculation rooted
+    // at that router.
+    //
+    NS_LOG_LOGIC("Running " << roots.size() << " SPF calculations on " << nThreads << " threads");
+    std::vector<std::unique_ptr<GlobalRouteManagerImpl>> workers;
+    for (std::size_t i = 0; i < nThreads; i++)
+    {
+        std::unique_ptr<GlobalRouteManagerImpl> worker(
+            new GlobalRouteManagerImpl(m_lsdb->Copy()));
+        worker->m_lsdb->Initialize();
+        workers.push_back(std::move(worker));
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> threads;
+    for (auto& worker : workers)
+    {
+        threads.emplace_back([&roots, &next, impl = worker.get()]() {
+            for (std::size_t i = next++; i < roots.size(); i = next++)
+            {
+                impl->SPFCalculate(roots[i]);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+void
+GlobalRouteManagerImpl::UpdateRoutes()
+{
+    NS_LOG_FUNCTION(this);
+    //
+    // Build the new database, keeping the current one to find out which LSAs
+    // have changed.
+    //
+    GlobalRouteManagerLSDB* oldLsdb = m_lsdb;
+    m_lsdb = new GlobalRouteManagerLSDB();
+    BuildGlobalRoutingDatabase();
+
+    //
+    // If the external LSAs have changed, the routes of all the routers may
+    // have changed.
+    //
+    bool recomputeAll = oldLsdb->GetNumExtLSAs() != m_lsdb->GetNumExtLSAs();
+    for (uint32_t i = 0; !recomputeAll && i < m_lsdb->GetNumExtLSAs(); i++)
+    {
+        recomputeAll = !IsSameLSA(*oldLsdb, oldLsdb->GetExtLSA(i), *m_lsdb, m_lsdb->GetExtLSA(i));
+    }
+
+    //
+    // Compare the LSAs of the two databases.  A change in the LSA of a leaf
+    // router is only visible to the leaf router itself, whereas any other
+    // change may be visible to all the routers of the connected component of
+    // the changed LSA.
+    //
+    std::vector<Ipv4Address> ids = oldLsdb->GetLinkStateIds();
+    std::vector<Ipv4Address> newIds = m_lsdb->GetLinkStateIds();
+    ids.insert(ids.end(), newIds.begin(), newIds.end());
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+    std::unordered_set<Ipv4Address, Ipv4AddressHash> affected;
+    std::vector<Ipv4Address> visibleChanges;
+    for (const auto& id : ids)
+    {
+        GlobalRoutingLSA* oldLsa = oldLsdb->GetLSA(id);
+        GlobalRoutingLSA* newLsa = m_lsdb->GetLSA(id);
+        if (oldLsa && newLsa && IsSameLSA(*oldLsdb, oldLsa, *m_lsdb, newLsa))
+        {
+            continue;
+        }
+        if ((!oldLsa || oldLsdb->IsLeafRouter(oldLsa)) && (!newLsa || m_lsdb->IsLeafRouter(newLsa)))
+        {
+            NS_LOG_LOGIC("LSA of leaf router " << id << " changed");
+            affected.insert(id);
+        }
+        else
+        {
+            NS_LOG_LOGIC("LSA " << id << " changed");
+            visibleChanges.push_back(id);
+        }
+    }
+
+    if (!recomputeAll && !visibleChanges.empty())
+    {
+        //
+        // Find the connected components of the union of the two topologies, so
+        // that a link that has been removed or added still connects the routers
+        // it separates or joins.
+        //
+        std::unordered_map<Ipv4Address, Ipv4Address, Ipv4AddressHash> parents;
+        auto find = [&parents](Ipv4Address id) {
+            parents.try_emplace(id, id);
+            Ipv4Address root = id;
+            while (parents.at(root) != root)
+            {
+                root = parents.at(root);
+            }
+            while (id != root)
+            {
+                Ipv4Address parent = parents.at(id);
+                parents.at(id) = root;
+                id = parent;
+            }
+            return root;
+        };
+        auto unite = [&parents, &find](Ipv4Address a, Ipv4Address b) {
+            Ipv4Address rootA = find(a);
+            Ipv4Address rootB = find(b);
+            parents.at(rootA) = rootB;
+        };
+        for (auto lsdb : {oldLsdb, m_lsdb})
+        {
+            for (const auto& id : lsdb->GetLinkStateIds())
+            {
+                GlobalRoutingLSA* lsa = lsdb->GetLSA(id);
+                for (uint32_t j = 0; j < lsa->GetNLinkRecords(); j++)
+                {
+                    GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+                    if (lr->GetLinkType() == GlobalRoutingLinkRecord::PointToPoint ||
+                        lr->GetLinkType() == GlobalRoutingLinkRecord::TransitNetwork)
+                    {
+                        unite(id, lr->GetLinkId());
+                    }
+                }
+                for (uint32_t j = 0; j < lsa->GetNAttachedRouters(); j++)
+                {
+                    GlobalRoutingLSA* router = lsdb->GetLSAByLinkData(lsa->GetAttachedRouter(j));
+                    if (router)
+                    {
+                        unite(id, router->GetLinkStateId());
+                    }
+                }
+            }
+        }
+
+        std::unordered_set<Ipv4Address, Ipv4AddressHash> components;
+        for (const auto& id : visibleChanges)
+        {
+            components.insert(find(id));
+        }
+        for (const auto& id : ids)
+        {
+            if (components.count(find(id)) > 0)
+            {
+                affected.insert(id);
+            }
+        }
+    }
+    delete oldLsdb;
+
+    //
+    // Delete the routes of the affected routers and compute their new routes.
+    //
+    std::vector<SPFRoot> roots;
+    uint32_t systemId = Simulator::GetSystemId();
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<Node> node = *i;
+        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        if (!rtr || (!recomputeAll && affected.count(rtr->GetRouterId()) == 0))
+        {
+            continue;
+        }
+        Ptr<Ipv4GlobalRouting> gr = rtr->GetRoutingProtocol();
+        uint32_t nRoutes = gr->GetNRoutes();
+        NS_LOG_LOGIC("Deleting " << nRoutes << " routes from node " << node->GetId());
+        for (uint32_t j = 0; j < nRoutes; j++)
+        {
+            gr->RemoveRoute(0);
+        }
+        if (node->GetSystemId() == systemId && rtr->GetNumLSAs())
+        {
+            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
+            NS_ASSERT_MSG(ipv4,
+                          "GlobalRouteManagerImpl::UpdateRoutes (): "
+                          "GetObject for <Ipv4> interface failed");
+            roots.push_back({rtr->GetRouterId(), ipv4, gr});
+        }
+    }
+    NS_LOG_INFO("Recomputing the routes of " << roots.size() << " routers");
+    SPFCalculate(roots);
 }
 
 //
@@ -757,7 +1165,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
     }
     if (v->GetVertexType() == SPFVertex::VertexNetwork)
     {
-        numRecordsInVertex = v->GetLSA()->GetNAttachedRouters();
+        numRecordsInVertex = m_lsdb->GetAttachedRouterLSAs(v->GetLSA()).size();
     }
 
     for (uint32_t i = 0; i < numRecordsInVertex; i++)
@@ -810,11 +1218,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
         // Get w_lsa:  In case of V is Network-LSA
         if (v->GetVertexType() == SPFVertex::VertexNetwork)
         {
-            w_lsa = m_lsdb->GetLSAByLinkData(v->GetLSA()->GetAttachedRouter(i));
-            if (!w_lsa)
-            {
-                continue;
-            }
+            w_lsa = m_lsdb->GetAttachedRouterLSAs(v->GetLSA())[i];
             NS_LOG_LOGIC("Found a Network LSA from " << v->GetVertexId() << " to "
                                                      << w_lsa->GetLinkStateId());
         }
@@ -864,6 +1268,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
             if (SPFNexthopCalculation(v, w, l, distance))
             {
                 w_lsa->SetStatus(GlobalRoutingLSA::LSA_SPF_CANDIDATE);
+                m_exploredLSAs.push_back(w_lsa);
                 //
                 // Push this new vertex onto the priority queue (ordered by distance from the
                 // root node).
@@ -952,7 +1357,7 @@ GlobalRouteManagerImpl::SPFNext(SPFVertex* v, CandidateQueue& candidate)
                     // If we've changed the cost to get to the vertex represented by <w>, we
                     // must reorder the priority queue keyed to that cost.
                     //
-                    candidate.Reorder();
+                    candidate.Reorder(cw);
                 }
             } // new lower cost path found
         }     // end W is already on the candidate list
@@ -1307,11 +1712,8 @@ GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
                 if (lr->GetLinkId() == myRouterId)
                 {
                     // Next hop is stored in the LinkID field of lr
-                    Ptr<GlobalRouter> router = rlsa->GetNode()->GetObject<GlobalRouter>();
-                    NS_ASSERT(router);
-                    Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-                    NS_ASSERT(gr);
-                    gr->AddNetworkRouteTo(Ipv4Address("0.0.0.0"),
+                    NS_ASSERT(m_spfrootRouting);
+                    m_spfrootRouting->AddNetworkRouteTo(Ipv4Address("0.0.0.0"),
                                           Ipv4Mask("0.0.0.0"),
                                           lr->GetLinkData(),
                                           FindOutgoingInterfaceId(transitLink->GetLinkData()));
@@ -1327,17 +1729,49 @@ GlobalRouteManagerImpl::CheckForStubNode(Ipv4Address root)
     return false;
 }
 
-// quagga ospf_spf_calculate
 void
 GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
 {
     NS_LOG_FUNCTION(this << root);
 
-    SPFVertex* v;
+    SPFRoot spfRoot{root, nullptr, nullptr};
+    //
+    // Walk the list of nodes in the system looking for the one corresponding to
+    // the router at the root of the calculation.  This is the node for which we
+    // are building the routing table.
+    //
+    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    {
+        Ptr<GlobalRouter> rtr = (*i)->GetObject<GlobalRouter>();
+        if (rtr && rtr->GetRouterId() == root)
+        {
+            spfRoot.ipv4 = (*i)->GetObject<Ipv4>();
+            NS_ASSERT_MSG(spfRoot.ipv4,
+                          "GlobalRouteManagerImpl::SPFCalculate (): "
+                          "GetObject for <Ipv4> interface failed");
+            spfRoot.routing = rtr->GetRoutingProtocol();
+            break;
+        }
+    }
     //
     // Initialize the Link State Database.
     //
     m_lsdb->Initialize();
+    SPFCalculate(spfRoot);
+}
+
+// quagga ospf_spf_calculate
+void
+GlobalRouteManagerImpl::SPFCalculate(const SPFRoot& root)
+{
+    NS_LOG_FUNCTION(this << root.routerId);
+
+    SPFVertex* v;
+    //
+    // Remember where the routes are written to.
+    //
+    m_spfrootIpv4 = root.ipv4;
+    m_spfrootRouting = root.routing;
     //
     // The candidate queue is a priority queue of SPFVertex objects, with the top
     // of the queue being the closest vertex in terms of distance from the root
@@ -1350,7 +1784,7 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // calculation.  Each router (and corresponding network) is a vertex in the
     // shortest path first (SPF) tree.
     //
-    v = new SPFVertex(m_lsdb->GetLSA(root));
+    v = new SPFVertex(m_lsdb->GetLSA(root.routerId));
     //
     // This vertex is the root of the SPF tree and it is distance 0 from the root.
     // We also mark this vertex as being in the SPF tree.
@@ -1358,7 +1792,8 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     m_spfroot = v;
     v->SetDistanceFromRoot(0);
     v->GetLSA()->SetStatus(GlobalRoutingLSA::LSA_SPF_IN_SPFTREE);
-    NS_LOG_LOGIC("Starting SPFCalculate for node " << root);
+    m_exploredLSAs.push_back(v->GetLSA());
+    NS_LOG_LOGIC("Starting SPFCalculate for node " << root.routerId);
 
     //
     // Optimize SPF calculation, for ns-3.
@@ -1367,10 +1802,10 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // reached.  Instead, short-circuit this computation and just install
     // a default route in the CheckForStubNode() method.
     //
-    if (NodeList::GetNNodes() > 0 && CheckForStubNode(root))
+    if (m_spfrootRouting && CheckForStubNode(root.routerId))
     {
-        NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root);
-        delete m_spfroot;
+        NS_LOG_LOGIC("SPFCalculate truncated for stub node " << root.routerId);
+        ResetSPFState();
         return;
     }
 
@@ -1490,8 +1925,27 @@ GlobalRouteManagerImpl::SPFCalculate(Ipv4Address root)
     // the SPF tree.  Delete all of the vertices and corresponding resources.  Go
     // possibly do it again for the next router.
     //
+    ResetSPFState();
+}
+
+void
+GlobalRouteManagerImpl::ResetSPFState()
+{
+    NS_LOG_FUNCTION(this);
     delete m_spfroot;
     m_spfroot = nullptr;
+    m_spfrootIpv4 = nullptr;
+    m_spfrootRouting = nullptr;
+    //
+    // Only the LSAs explored by the calculation have a status other than
+    // LSA_SPF_NOT_EXPLORED, hence the next calculation does not need to
+    // initialize the whole database.
+    //
+    for (auto lsa : m_exploredLSAs)
+    {
+        lsa->SetStatus(GlobalRoutingLSA::LSA_SPF_NOT_EXPLORED);
+    }
+    m_exploredLSAs.clear();
 }
 
 void
@@ -1548,103 +2002,56 @@ GlobalRouteManagerImpl::SPFAddASExternal(GlobalRoutingLSA* extlsa, SPFVertex* v)
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The routing information is written to the routing protocol of the router
+    // at the root of the SPF tree, which has been looked up when the SPF
+    // calculation started.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    if (!m_spfrootRouting)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        NS_LOG_LOGIC("No routing protocol for router " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for router " << routerId);
+    //
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
+    //
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFAddASExternal (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = extlsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
 
-        if (!rtr)
+    //
+    // The vertex <v> (corresponding to the router advertising the external
+    // route) has the next hop addresses and the outbound interface indices
+    // precalculated for us, which are used to reach the external network.
+    //
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
+    {
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            m_spfrootRouting->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId
+                                   << " add external network route to " << tempip
+                                   << " using next hop " << nextHop << " via interface " << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = extlsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = extlsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddASExternalRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add external network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
 }
 
 // Processing logic from RFC 2328, page 166 and quagga ospf_spf_process_stubs ()
@@ -1703,112 +2110,52 @@ GlobalRouteManagerImpl::SPFIntraAddStub(GlobalRoutingLinkRecord* l, SPFVertex* v
     NS_LOG_LOGIC("Stub is on remote host: " << v->GetVertexId() << "; installing");
     //
     // The root of the Shortest Path First tree is the router to which we are
-    // going to write the actual routing table entries.  The vertex corresponding
-    // to this router has a vertex ID which is the router ID of that node.  We're
-    // going to use this ID to discover which node it is that we're actually going
-    // to update.
+    // going to write the actual routing table entries.  Its routing protocol
+    // has been looked up when the SPF calculation started.
     //
     Ipv4Address routerId = m_spfroot->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
+    if (!m_spfrootRouting)
+    {
+        NS_LOG_LOGIC("No routing protocol for router " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for router " << routerId);
+    NS_ASSERT_MSG(v->GetLSA(),
+                  "GlobalRouteManagerImpl::SPFIntraAddStub (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask(l->GetLinkData().Get());
+    Ipv4Address tempip = l->GetLinkId();
+    tempip = tempip.CombineMask(tempmask);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // The vertex <v> (corresponding to the node that has the stub network) has
+    // the next hop addresses and the outbound interface indices precalculated
+    // for us, which the node at the root of the SPF tree uses to forward the
+    // packets to the stub network.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    // walk through all next-hop-IPs and out-going-interfaces for reaching
+    // the stub network gateway 'v' from the root node
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to QI for that interface.  If there's no GlobalRouter interface, the node
-        // in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-
-        if (!rtr)
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            m_spfrootRouting->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId << " add network route to "
+                                   << tempip << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to QI
-            // for that interface.  If the node is acting as an IP version 4 router, it
-            // should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "QI for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            NS_ASSERT_MSG(v->GetLSA(),
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask(l->GetLinkData().Get());
-            Ipv4Address tempip = l->GetLinkId();
-            tempip = tempip.CombineMask(tempmask);
-            //
-            // Here's why we did all of that work.  We're going to add a host route to the
-            // host address found in the m_linkData field of the point-to-point link
-            // record.  In the case of a point-to-point link, this is the local IP address
-            // of the node connected to the link.  Each of these point-to-point links
-            // will correspond to a local interface that has an IP address to which
-            // the node at the root of the SPF tree can send packets.  The vertex <v>
-            // (corresponding to the node that has these links and interfaces) has
-            // an m_nextHop address precalculated for us that is the address to which the
-            // root node should send packets to be forwarded to these IP addresses.
-            // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-            // which the packets should be send for forwarding.
-            //
-
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all next-hop-IPs and out-going-interfaces for reaching
-            // the stub network gateway 'v' from the root node
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative");
-                }
-            }
-            return;
-        } // if
-    }     // for
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative");
+        }
+    }
 }
 
 //
@@ -1825,65 +2172,24 @@ GlobalRouteManagerImpl::FindOutgoingInterfaceId(Ipv4Address a, Ipv4Mask amask)
     //
     // We have an IP address <a> and a vertex ID of the root of the SPF tree.
     // The question is what interface index does this address correspond to.
-    // The answer is a little complicated since we have to find a pointer to
-    // the node corresponding to the vertex ID, find the Ipv4 interface on that
-    // node in order to iterate the interfaces and find the one corresponding to
-    // the address in question.
+    // The Ipv4 interface of the node corresponding to the vertex ID has been
+    // looked up when the SPF calculation started.
     //
-    Ipv4Address routerId = m_spfroot->GetVertexId();
-    //
-    // Walk the list of nodes in the system looking for the one corresponding to
-    // the node at the root of the SPF tree.  This is the node for which we are
-    // building the routing table.
-    //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    if (!m_spfrootIpv4)
     {
-        Ptr<Node> node = *i;
-
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
         //
-        // If the node doesn't have a GlobalRouter interface it can't be the one
-        // we're interested in.
+        // Couldn't find it.
         //
-        if (!rtr)
-        {
-            continue;
-        }
-
-        if (rtr->GetRouterId() == routerId)
-        {
-            //
-            // This is the node we're building the routing table for.  We're going to need
-            // the Ipv4 interface to look for the ipv4 interface index.  Since this node
-            // is participating in routing IP version 4 packets, it certainly must have
-            // an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::FindOutgoingInterfaceId (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Look through the interfaces on this node for one that has the IP address
-            // we're looking for.  If we find one, return the corresponding interface
-            // index, or -1 if not found.
-            //
-            int32_t interface = ipv4->GetInterfaceForPrefix(a, amask);
-
-#if 0
-          if (interface < 0)
-            {
-              NS_FATAL_ERROR ("GlobalRouteManagerImpl::FindOutgoingInterfaceId(): "
-                              "Expected an interface associated with address a:" << a);
-            }
-#endif
-            return interface;
-        }
+        NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node "
+                     << m_spfroot->GetVertexId());
+        return -1;
     }
     //
-    // Couldn't find it.
+    // Look through the interfaces on this node for one that has the IP address
+    // we're looking for.  If we find one, return the corresponding interface
+    // index, or -1 if not found.
     //
-    NS_LOG_LOGIC("FindOutgoingInterfaceId():Can't find root node " << routerId);
-    return -1;
+    return m_spfrootIpv4->GetInterfaceForPrefix(a, amask);
 }
 
 //
@@ -1910,137 +2216,86 @@ GlobalRouteManagerImpl::SPFIntraAddRouter(SPFVertex* v)
     NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFIntraAddRouter (): Root pointer not set");
     //
     // The root of the Shortest Path First tree is the router to which we are
-    // going to write the actual routing table entries.  The vertex corresponding
-    // to this router has a vertex ID which is the router ID of that node.  We're
-    // going to use this ID to discover which node it is that we're actually going
-    // to update.
+    // going to write the actual routing table entries.  Its routing protocol
+    // has been looked up when the SPF calculation started.
     //
     Ipv4Address routerId = m_spfroot->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
+    if (!m_spfrootRouting)
+    {
+        NS_LOG_LOGIC("No routing protocol for router " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("Setting routes for router " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA will have a number of attached Global Router
+    // Link Records corresponding to links off of that vertex / node.  We're going
+    // to be interested in the records corresponding to point-to-point links.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
+                  "Expected valid LSA in SPFVertex* v");
+
+    uint32_t nLinkRecords = lsa->GetNLinkRecords();
+    //
+    // Iterate through the link records on the vertex to which we're going to add
+    // routes.  To make sure we're being clear, we're going to add routing table
+    // entries to the tables on the node corresping to the root of the SPF tree.
+    // These entries will have routes to the IP addresses we find from looking at
+    // the local side of the point-to-point links found on the node described by
+    // the vertex <v>.
+    //
+    NS_LOG_LOGIC(" Router " << routerId << " found " << nLinkRecords << " link records in LSA "
+                            << lsa << "with LinkStateId " << lsa->GetLinkStateId());
+    for (uint32_t j = 0; j < nLinkRecords; ++j)
     {
-        Ptr<Node> node = *i;
         //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
+        // We are only concerned about point-to-point links
         //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
-
-        if (!rtr)
+        GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
+        if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
             continue;
         }
         //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
+        // Here's why we did all of that work.  We're going to add a host route to the
+        // host address found in the m_linkData field of the point-to-point link
+        // record.  In the case of a point-to-point link, this is the local IP address
+        // of the node connected to the link.  Each of these point-to-point links
+        // will correspond to a local interface that has an IP address to which
+        // the node at the root of the SPF tree can send packets.  The vertex <v>
+        // (corresponding to the node that has these links and interfaces) has
+        // an m_nextHop address precalculated for us that is the address to which the
+        // root node should send packets to be forwarded to these IP addresses.
+        // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
+        // which the packets should be send for forwarding.
         //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        // walk through all available exit directions due to ECMP,
+        // and add host route for each of the exit direction toward
+        // the vertex 'v'
+        for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
         {
-            NS_LOG_LOGIC("Setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddRouter (): "
-                          "Expected valid LSA in SPFVertex* v");
-
-            uint32_t nLinkRecords = lsa->GetNLinkRecords();
-            //
-            // Iterate through the link records on the vertex to which we're going to add
-            // routes.  To make sure we're being clear, we're going to add routing table
-            // entries to the tables on the node corresping to the root of the SPF tree.
-            // These entries will have routes to the IP addresses we find from looking at
-            // the local side of the point-to-point links found on the node described by
-            // the vertex <v>.
-            //
-            NS_LOG_LOGIC(" Node " << node->GetId() << " found " << nLinkRecords
-                                  << " link records in LSA " << lsa << "with LinkStateId "
-                                  << lsa->GetLinkStateId());
-            for (uint32_t j = 0; j < nLinkRecords; ++j)
+            SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+            Ipv4Address nextHop = exit.first;
+            int32_t outIf = exit.second;
+            if (outIf >= 0)
             {
-                //
-                // We are only concerned about point-to-point links
-                //
-                GlobalRoutingLinkRecord* lr = lsa->GetLinkRecord(j);
-                if (lr->GetLinkType() != GlobalRoutingLinkRecord::PointToPoint)
-                {
-                    continue;
-                }
-                //
-                // Here's why we did all of that work.  We're going to add a host route to the
-                // host address found in the m_linkData field of the point-to-point link
-                // record.  In the case of a point-to-point link, this is the local IP address
-                // of the node connected to the link.  Each of these point-to-point links
-                // will correspond to a local interface that has an IP address to which
-                // the node at the root of the SPF tree can send packets.  The vertex <v>
-                // (corresponding to the node that has these links and interfaces) has
-                // an m_nextHop address precalculated for us that is the address to which the
-                // root node should send packets to be forwarded to these IP addresses.
-                // Similarly, the vertex <v> has an m_rootOif (outbound interface index) to
-                // which the packets should be send for forwarding.
-                //
-                Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-                if (!router)
-                {
-                    continue;
-                }
-                Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-                NS_ASSERT(gr);
-                // walk through all available exit directions due to ECMP,
-                // and add host route for each of the exit direction toward
-                // the vertex 'v'
-                for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-                {
-                    SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                    Ipv4Address nextHop = exit.first;
-                    int32_t outIf = exit.second;
-                    if (outIf >= 0)
-                    {
-                        gr->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " adding host route to " << lr->GetLinkData()
-                                               << " using next hop " << nextHop
-                                               << " and outgoing interface " << outIf);
-                    }
-                    else
-                    {
-                        NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                               << " NOT able to add host route to "
-                                               << lr->GetLinkData() << " using next hop " << nextHop
-                                               << " since outgoing interface id is negative "
-                                               << outIf);
-                    }
-                } // for all routes from the root the vertex 'v'
+                m_spfrootRouting->AddHostRouteTo(lr->GetLinkData(), nextHop, outIf);
+                NS_LOG_LOGIC("(Route " << i << ") Router " << routerId << " adding host route to "
+                                       << lr->GetLinkData() << " using next hop " << nextHop
+                                       << " and outgoing interface " << outIf);
             }
-            //
-            // Done adding the routes for the selected node.
-            //
-            return;
-        }
+            else
+            {
+                NS_LOG_LOGIC("(Route " << i << ") Router " << routerId
+                                       << " NOT able to add host route to " << lr->GetLinkData()
+                                       << " using next hop " << nextHop
+                                       << " since outgoing interface id is negative " << outIf);
+            }
+        } // for all routes from the root the vertex 'v'
     }
 }
 
@@ -2052,98 +2307,52 @@ GlobalRouteManagerImpl::SPFIntraAddTransit(SPFVertex* v)
     NS_ASSERT_MSG(m_spfroot, "GlobalRouteManagerImpl::SPFIntraAddTransit (): Root pointer not set");
     //
     // The root of the Shortest Path First tree is the router to which we are
-    // going to write the actual routing table entries.  The vertex corresponding
-    // to this router has a vertex ID which is the router ID of that node.  We're
-    // going to use this ID to discover which node it is that we're actually going
-    // to update.
+    // going to write the actual routing table entries.  Its routing protocol
+    // has been looked up when the SPF calculation started.
     //
     Ipv4Address routerId = m_spfroot->GetVertexId();
 
     NS_LOG_LOGIC("Vertex ID = " << routerId);
+    if (!m_spfrootRouting)
+    {
+        NS_LOG_LOGIC("No routing protocol for router " << routerId);
+        return;
+    }
+    NS_LOG_LOGIC("setting routes for router " << routerId);
     //
-    // We need to walk the list of nodes looking for the one that has the router
-    // ID corresponding to the root vertex.  This is the one we're going to write
-    // the routing information to.
+    // Get the Global Router Link State Advertisement from the vertex we're
+    // adding the routes to.  The LSA of a network vertex carries the address
+    // and the mask of the network.
     //
-    for (auto i = NodeList::Begin(); i != NodeList::End(); i++)
+    GlobalRoutingLSA* lsa = v->GetLSA();
+    NS_ASSERT_MSG(lsa,
+                  "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
+                  "Expected valid LSA in SPFVertex* v");
+    Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
+    Ipv4Address tempip = lsa->GetLinkStateId();
+    tempip = tempip.CombineMask(tempmask);
+    // walk through all available exit directions due to ECMP,
+    // and add host route for each of the exit direction toward
+    // the vertex 'v'
+    for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
     {
-        Ptr<Node> node = *i;
-        //
-        // The router ID is accessible through the GlobalRouter interface, so we need
-        // to GetObject for that interface.  If there's no GlobalRouter interface,
-        // the node in question cannot be the router we want, so we continue.
-        //
-        Ptr<GlobalRouter> rtr = node->GetObject<GlobalRouter>();
+        SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
+        Ipv4Address nextHop = exit.first;
+        int32_t outIf = exit.second;
 
-        if (!rtr)
+        if (outIf >= 0)
         {
-            NS_LOG_LOGIC("No GlobalRouter interface on node " << node->GetId());
-            continue;
+            m_spfrootRouting->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId << " add network route to "
+                                   << tempip << " using next hop " << nextHop << " via interface "
+                                   << outIf);
         }
-        //
-        // If the router ID of the current node is equal to the router ID of the
-        // root of the SPF tree, then this node is the one for which we need to
-        // write the routing tables.
-        //
-        NS_LOG_LOGIC("Considering router " << rtr->GetRouterId());
-
-        if (rtr->GetRouterId() == routerId)
+        else
         {
-            NS_LOG_LOGIC("setting routes for node " << node->GetId());
-            //
-            // Routing information is updated using the Ipv4 interface.  We need to
-            // GetObject for that interface.  If the node is acting as an IP version 4
-            // router, it should absolutely have an Ipv4 interface.
-            //
-            Ptr<Ipv4> ipv4 = node->GetObject<Ipv4>();
-            NS_ASSERT_MSG(ipv4,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "GetObject for <Ipv4> interface failed");
-            //
-            // Get the Global Router Link State Advertisement from the vertex we're
-            // adding the routes to.  The LSA will have a number of attached Global Router
-            // Link Records corresponding to links off of that vertex / node.  We're going
-            // to be interested in the records corresponding to point-to-point links.
-            //
-            GlobalRoutingLSA* lsa = v->GetLSA();
-            NS_ASSERT_MSG(lsa,
-                          "GlobalRouteManagerImpl::SPFIntraAddTransit (): "
-                          "Expected valid LSA in SPFVertex* v");
-            Ipv4Mask tempmask = lsa->GetNetworkLSANetworkMask();
-            Ipv4Address tempip = lsa->GetLinkStateId();
-            tempip = tempip.CombineMask(tempmask);
-            Ptr<GlobalRouter> router = node->GetObject<GlobalRouter>();
-            if (!router)
-            {
-                continue;
-            }
-            Ptr<Ipv4GlobalRouting> gr = router->GetRoutingProtocol();
-            NS_ASSERT(gr);
-            // walk through all available exit directions due to ECMP,
-            // and add host route for each of the exit direction toward
-            // the vertex 'v'
-            for (uint32_t i = 0; i < v->GetNRootExitDirections(); i++)
-            {
-                SPFVertex::NodeExit_t exit = v->GetRootExitDirection(i);
-                Ipv4Address nextHop = exit.first;
-                int32_t outIf = exit.second;
-
-                if (outIf >= 0)
-                {
-                    gr->AddNetworkRouteTo(tempip, tempmask, nextHop, outIf);
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " add network route to " << tempip
-                                           << " using next hop " << nextHop << " via interface "
-                                           << outIf);
-                }
-                else
-                {
-                    NS_LOG_LOGIC("(Route " << i << ") Node " << node->GetId()
-                                           << " NOT able to add network route to " << tempip
-                                           << " using next hop " << nextHop
-                                           << " since outgoing interface id is negative " << outIf);
-                }
-            }
+            NS_LOG_LOGIC("(Route " << i << ") Router " << routerId
+                                   << " NOT able to add network route to " << tempip
+                                   << " using next hop " << nextHop
+                                   << " since outgoing interface id is negative " << outIf);
         }
     }
 }
@@ -31,6 +31,8 @@
 #include <map>
 #include <queue>
 #include <stdint.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace ns3
@@ -39,6 +41,7 @@ namespace ns3
 const uint32_t SPF_INFINITY = 0xffffffff; //!< "infinite" distance between nodes
 
 class CandidateQueue;
+class Ipv4;
 class Ipv4GlobalRouting;
 
 /**
@@ -639,6 +642,57 @@ class GlobalRouteManagerLSDB
      */
     GlobalRoutingLSA* GetLSAByLinkData(Ipv4Address addr) const;
 
+    /**
+     * @brief Get the Link State Advertisements of the routers attached to the
+     * network described by the given Network LSA, except the leaf routers.
+     *
+     * The attached routers are looked up by means of GetLSAByLinkData ().  A
+     * leaf router is a router whose only link record is a TransitNetwork record
+     * to the given network and which does not advertise any external route.
+     * Adding a leaf router to a shortest path tree does not add any route, nor
+     * any other vertex, hence the leaf routers can be left out of the SPF
+     * calculations rooted at any other router.
+     *
+     * The lists are computed once after the database has changed, hence finding
+     * the attached routers of a network takes a constant time.
+     *
+     * @see GetLSAByLinkData
+     * @param lsa A pointer to the Network LSA.
+     * @returns The Router LSAs of the attached routers that are not leaf routers,
+     * in the order of the attached routers in the Network LSA.
+     */
+    const std::vector<GlobalRoutingLSA*>& GetAttachedRouterLSAs(GlobalRoutingLSA* lsa) const;
+
+    /**
+     * @brief Check whether the given Router LSA describes a leaf router, i.e.,
+     * a router whose only link record is a TransitNetwork record and which does
+     * not advertise any external route.
+     *
+     * @see GetAttachedRouterLSAs
+     * @param lsa A pointer to the Router LSA.
+     * @returns True if the router is a leaf router, false otherwise.
+     */
+    bool IsLeafRouter(GlobalRoutingLSA* lsa) const;
+
+    /**
+     * @brief Get the Link State IDs of all the LSAs in the database, except the
+     * External LSAs, in increasing order.
+     *
+     * @returns the Link State IDs of the LSAs.
+     */
+    std::vector<Ipv4Address> GetLinkStateIds() const;
+
+    /**
+     * @brief Create a deep copy of this Link State Database.
+     *
+     * The LSAs are copied, hence the SPF calculations that use the copy do not
+     * change the status of the LSAs of this database.  The caller is given the
+     * responsibility for releasing the copy.
+     *
+     * @returns A pointer to the copy of this database.
+     */
+    GlobalRouteManagerLSDB* Copy() const;
+
     /**
      * @brief Set all LSA flags to an initialized state, for SPF computation
      *
@@ -681,6 +735,27 @@ class GlobalRouteManagerLSDB
     LSDBMap_t m_database; //!< database of IPv4 addresses / Link State Advertisements
     std::vector<GlobalRoutingLSA*>
         m_extdatabase; //!< database of External Link State Advertisements
+
+    /**
+     * @brief Build the index of the LSAs by the LinkData field of their
+     * TransitNetwork link records and the lists of attached routers, if the
+     * database has changed since they have been last built.
+     */
+    void BuildIndexes() const;
+
+    mutable bool m_indexesValid; //!< whether the indexes reflect the database
+
+    /// The first LSA (in Link State ID order) having a TransitNetwork link record
+    /// with a given LinkData field
+    mutable std::unordered_map<Ipv4Address, GlobalRoutingLSA*, Ipv4AddressHash> m_linkDataIndex;
+
+    /// The LSAs of the non-leaf routers attached to each Network LSA
+    mutable std::unordered_map<const GlobalRoutingLSA*, std::vector<GlobalRoutingLSA*>>
+        m_attachedRouters;
+
+    /// The routers that advertise external routes or that are the neighbor of
+    /// another router on a point-to-point link, which are never leaf routers
+    mutable std::unordered_set<Ipv4Address, Ipv4AddressHash> m_nonLeafRouters;
 };
 
 /**
@@ -722,9 +797,32 @@ class GlobalRouteManagerImpl
     /**
      * @brief Compute routes using a Dijkstra SPF computation and populate
      * per-node forwarding tables
+     *
+     * The SPF calculations rooted at the different routers are independent,
+     * hence they are distributed over the number of threads set by the
+     * GlobalRoutingSpfThreads global value.
      */
     virtual void InitializeRoutes();
 
+    /**
+     * @brief Rebuild the routing database and recompute the routes of the
+     * routers whose routes may have changed since the database was last built.
+     *
+     * The new LSAs are compared with the LSAs of the current database.  The
+     * routes of a router are recomputed if a changed LSA belongs to the same
+     * connected component of the topology (before or after the change) as the
+     * router, or if the router is a leaf router whose own LSA has changed.  A
+     * change in the LSAs of the leaf routers (see
+     * GlobalRouteManagerLSDB::GetAttachedRouterLSAs) is not visible to the other
+     * routers, hence a wireless station joining or leaving a network only leads
+     * to the calculation of its own routes.  If the external LSAs have changed,
+     * the routes of all the routers are recomputed.
+     *
+     * The resulting routes are the same as those computed by
+     * DeleteGlobalRoutes (), BuildGlobalRoutingDatabase () and InitializeRoutes ().
+     */
+    virtual void UpdateRoutes();
+
     /**
      * @brief Debugging routine; allow client code to supply a pre-built LSDB
      * @param lsdb the pre-built LSDB
@@ -738,9 +836,48 @@ class GlobalRouteManagerImpl
     void DebugSPFCalculate(Ipv4Address root);
 
   private:
+    /**
+     * @brief Construct a route manager that runs the SPF calculations on the
+     * given LSDB, e.g., a copy of the LSDB of another route manager.
+     * @param lsdb the LSDB, which is deleted by this route manager
+     */
+    explicit GlobalRouteManagerImpl(GlobalRouteManagerLSDB* lsdb);
+
+    /// A router at the root of an SPF calculation and the objects its routes are
+    /// written to
+    struct SPFRoot
+    {
+        Ipv4Address routerId;           //!< the router ID
+        Ptr<Ipv4> ipv4;                 //!< the Ipv4 object of the router
+        Ptr<Ipv4GlobalRouting> routing; //!< the routing protocol of the router
+    };
+
     SPFVertex* m_spfroot;           //!< the root node
     GlobalRouteManagerLSDB* m_lsdb; //!< the Link State DataBase (LSDB) of the Global Route Manager
 
+    Ptr<Ipv4> m_spfrootIpv4;                       //!< the Ipv4 object of the root node
+    Ptr<Ipv4GlobalRouting> m_spfrootRouting;       //!< the routing protocol of the root node
+    std::vector<GlobalRoutingLSA*> m_exploredLSAs; //!< the LSAs explored by the SPF calculation
+
+    /**
+     * \brief Get the routers of this system for which the SPF calculation
+     * needs to be run.
+     *
+     * \returns the roots of the SPF calculations
+     */
+    std::vector<SPFRoot> GetSPFRoots() const;
+
+    /**
+     * \brief Run the SPF calculations rooted at the given routers and populate
+     * their forwarding tables.
+     *
+     * If more than one thread is used, each thread runs the SPF calculations
+     * on its own copy of the LSDB.
+     *
+     * \param roots the roots of the SPF calculations
+     */
+    void SPFCalculate(const std::vector<SPFRoot>& roots);
+
     /**
      * \brief Test if a node is a stub, from an OSPF sense.
      *
@@ -761,6 +898,24 @@ class GlobalRouteManagerImpl
      */
     void SPFCalculate(Ipv4Address root);
 
+    /**
+     * \brief Calculate the shortest path first (SPF) tree and write the routes
+     * to the given routing protocol.
+     *
+     * The LSAs of the LSDB must not have been explored since the LSDB was last
+     * initialized or since the last SPF calculation, which resets the status of
+     * the LSAs it explores.
+     *
+     * \param root the root node
+     */
+    void SPFCalculate(const SPFRoot& root);
+
+    /**
+     * \brief Delete the SPF tree and reset the status of the LSAs explored by
+     * the SPF calculation.
+     */
+    void ResetSPFState();
+
     /**
      * \brief Process Stub nodes
      *
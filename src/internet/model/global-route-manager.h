@@ -70,6 +70,16 @@ class GlobalRouteManager
      * per-node forwarding tables
      */
     static void InitializeRoutes();
+
+    /**
+     * @brief Rebuild the routing database and recompute the routes of the
+     * nodes whose routes may have changed since the database was last built.
+     *
+     * This yields the same routes as DeleteGlobalRoutes (),
+     * BuildGlobalRoutingDatabase () and InitializeRoutes (), but the routes
+     * of the nodes that are not affected by the topology changes are kept.
+     */
+    static void UpdateRoutes();
 };
 
 } // namespace ns3
@@ -32,6 +32,7 @@
 #include "ns3/node-list.h"
 #include "ns3/node.h"
 
+#include <map>
 #include <vector>
 
 namespace ns3
@@ -497,6 +498,12 @@ operator<<(std::ostream& os, GlobalRoutingLSA& lsa)
 
 NS_OBJECT_ENSURE_REGISTERED(GlobalRouter);
 
+/// Whether the designated routers of the links without bridges are cached
+static bool g_designatedRouterCacheEnabled = false;
+
+/// The designated routers of the links without bridges, indexed by channel ID
+static std::map<uint32_t, Ipv4Address> g_designatedRouterCache;
+
 TypeId
 GlobalRouter::GetTypeId()
 {
@@ -569,6 +576,14 @@ GlobalRouter::GetRouterId() const
     return m_routerId;
 }
 
+void
+GlobalRouter::EnableDesignatedRouterCache(bool enable)
+{
+    NS_LOG_FUNCTION(enable);
+    g_designatedRouterCacheEnabled = enable;
+    g_designatedRouterCache.clear();
+}
+
 //
 // DiscoverLSAs is called on all nodes in the system that have a GlobalRouter
 // interface aggregated.  We need to go out and discover any adjacent routers
@@ -1328,7 +1343,22 @@ GlobalRouter::FindDesignatedRouterForLink(Ptr<NetDevice> ndLocal) const
     NS_LOG_LOGIC("Looking for designated router off of net device " << ndLocal << " on node "
                                                                     << ndLocal->GetNode()->GetId());
 
+    if (g_designatedRouterCacheEnabled)
+    {
+        auto it = g_designatedRouterCache.find(ch->GetId());
+        if (it != g_designatedRouterCache.end())
+        {
+            NS_LOG_LOGIC("Designated router of channel " << ch->GetId() << " is " << it->second);
+            return it->second;
+        }
+    }
+
     Ipv4Address designatedRtr("255.255.255.255");
+    //
+    // If no device on the channel is bridged, the designated router does not
+    // depend on the net device we came in on and it can be cached.
+    //
+    bool bridged = false;
 
     //
     // Look through all of the devices on the channel to which the net device
@@ -1354,6 +1384,7 @@ GlobalRouter::FindDesignatedRouterForLink(Ptr<NetDevice> ndLocal) const
         if (bnd)
         {
             NS_LOG_LOGIC("Device is bridged by BridgeNetDevice " << bnd);
+            bridged = true;
 
             //
             // When enumerating a bridge, don't count the netdevice we came in on
@@ -1463,6 +1494,10 @@ GlobalRouter::FindDesignatedRouterForLink(Ptr<NetDevice> ndLocal) const
             }
         }
     }
+    if (g_designatedRouterCacheEnabled && !bridged)
+    {
+        g_designatedRouterCache[ch->GetId()] = designatedRtr;
+    }
     return designatedRtr;
 }
 
@@ -652,6 +652,23 @@ class GlobalRouter : public Object
      */
     uint32_t DiscoverLSAs();
 
+    /**
+     * @brief Enable or disable the caching of the designated routers of the
+     * links without bridges.
+     *
+     * Finding the designated router of a link takes a time linear in the
+     * number of devices on the link, hence discovering the LSAs of all the
+     * routers attached to a link takes a time quadratic in the number of
+     * devices.  While the cache is enabled, the designated router of a link
+     * without bridges is only looked up once.  The cache must only be enabled
+     * while the topology does not change, e.g., while the LSAs of all the
+     * routers are discovered.  The cache is cleared when it is enabled or
+     * disabled.
+     *
+     * @param enable whether to enable the cache
+     */
+    static void EnableDesignatedRouterCache(bool enable);
+
     /**
      * @brief Get the Number of Global Routing Link State Advertisements that this
      * router can export.
@@ -28,6 +28,8 @@
 #include "ns3/node.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -142,6 +144,34 @@ NdiscCache::Add(Ipv6Address to)
     return entry;
 }
 
+void
+NdiscCache::AddAutoGeneratedEntries(std::vector<std::pair<Ipv6Address, Address>> entries)
+{
+    NS_LOG_FUNCTION(this << entries.size());
+    std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.first < b.first;
+    });
+
+    // walk the cache along with the sorted entries, so that every entry is found or
+    // inserted next to the position of the previous one
+    auto it = m_ndCache.begin();
+    for (const auto& [to, macAddress] : entries)
+    {
+        while (it != m_ndCache.end() && it->first < to)
+        {
+            ++it;
+        }
+        if (it == m_ndCache.end() || to < it->first)
+        {
+            auto entry = new NdiscCache::Entry(this);
+            entry->SetIpv6Address(to);
+            it = m_ndCache.emplace_hint(it, to, entry);
+        }
+        it->second->SetMacAddress(macAddress);
+        it->second->MarkAutoGenerated();
+    }
+}
+
 void
 NdiscCache::Remove(NdiscCache::Entry* entry)
 {
@@ -31,6 +31,8 @@
 #include <list>
 #include <map>
 #include <stdint.h>
+#include <utility>
+#include <vector>
 
 namespace ns3
 {
@@ -108,6 +110,18 @@ class NdiscCache : public Object
      */
     virtual NdiscCache::Entry* Add(Ipv6Address to);
 
+    /**
+     * \brief Add auto-generated entries.
+     *
+     * Every IPv6 address is resolved to the paired MAC address by an entry marked
+     * as auto-generated, which is added to the cache if there is no entry for the
+     * IPv6 address yet. The entries are sorted and merged with the cache in a
+     * single pass, rather than looked up and added one at a time.
+     *
+     * \param entries the IPv6 addresses and the MAC addresses they resolve to
+     */
+    void AddAutoGeneratedEntries(std::vector<std::pair<Ipv6Address, Address>> entries);
+
     /**
      * \brief Delete an entry.
      * \param entry pointer to delete from the list.
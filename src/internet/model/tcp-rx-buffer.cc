@@ -171,8 +171,14 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
             headSeq = tailSeq;
         }
     }
-    // Remove overlapped bytes from packet
-    auto i = m_data.begin();
+    // Remove overlapped bytes from packet. The buffered packets do not overlap each
+    // other, hence the packets preceding the last one starting at or before headSeq
+    // cannot overlap the incoming packet and do not need to be checked
+    auto i = m_data.upper_bound(headSeq);
+    if (i != m_data.begin())
+    {
+        --i;
+    }
     while (i != m_data.end() && i->first <= tailSeq)
     {
         SequenceNumber32 lastByteSeq = i->first + SequenceNumber32(i->second->GetSize());
@@ -221,13 +227,10 @@ TcpRxBuffer::Add(Ptr<Packet> p, const TcpHeader& tcph)
     NS_LOG_LOGIC("Buffered packet of seqno=" << headSeq << " len=" << p->GetSize());
     // Update variables
     m_size += p->GetSize(); // Occupancy
-    for (i = m_data.begin(); i != m_data.end(); ++i)
+    // Walk the in-sequence packets starting from the one at RCV.NXT (if any)
+    for (i = m_data.lower_bound(m_nextRxSeq); i != m_data.end(); ++i)
     {
-        if (i->first < m_nextRxSeq)
-        {
-            continue;
-        }
-        else if (i->first > m_nextRxSeq)
+        if (i->first > m_nextRxSeq)
         {
             break;
         };
@@ -3689,7 +3689,9 @@ TcpSocketBase::NewAck(const SequenceNumber32& ack, bool resetRTO)
         NS_LOG_LOGIC(
             this << " Cancelled ReTxTimeout event which was set to expire at "
                  << (Simulator::Now() + Simulator::GetDelayLeft(m_retxEvent)).GetSeconds());
-        m_retxEvent.Cancel();
+        // The timer is restarted on every new ACK, hence remove the pending event
+        // rather than cancelling it, so that it does not linger in the event queue
+        m_retxEvent.Remove();
         // On receiving a "New" ack we restart retransmission timer .. RFC 6298
         // RFC 6298, clause 2.4
         m_rto = Max(m_rtt->GetEstimate() + Max(m_clockGranularity, m_rtt->GetVariation() * 4),
@@ -3718,7 +3720,7 @@ TcpSocketBase::NewAck(const SequenceNumber32& ack, bool resetRTO)
         NS_LOG_LOGIC(
             this << " Cancelled ReTxTimeout event which was set to expire at "
                  << (Simulator::Now() + Simulator::GetDelayLeft(m_retxEvent)).GetSeconds());
-        m_retxEvent.Cancel();
+        m_retxEvent.Remove();
     }
 }
 
@@ -175,6 +175,8 @@ TcpTxBuffer::SetHeadSequence(const SequenceNumber32& seq)
     // if you change the head with data already sent, something bad will happen
     NS_ASSERT(m_sentList.empty());
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_sackedRanges.clear();
+    m_lostOrSackedUpTo = seq;
 }
 
 bool
@@ -309,13 +311,13 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
     NS_ASSERT(numBytes <= m_sentSize);
     NS_ASSERT(!m_sentList.empty());
 
-    auto it = m_sentList.begin();
+    auto it = FindSentItem(seq);
     bool listEdited = false;
     uint32_t s = numBytes;
 
     // Avoid to merge different packet for this retransmission if flags are
     // different.
-    for (; it != m_sentList.end(); ++it)
+    if (it != m_sentList.end())
     {
         if ((*it)->m_startSeq == seq)
         {
@@ -339,7 +341,6 @@ TcpTxBuffer::GetTransmittedSegment(uint32_t numBytes, const SequenceNumber32& se
             {
                 s = std::min(s, (*it)->m_packet->GetSize());
             }
-            break;
         }
     }
 
@@ -376,6 +377,135 @@ TcpTxBuffer::FindHighestSacked() const
     return ret;
 }
 
+TcpTxBuffer::PacketList::const_iterator
+TcpTxBuffer::FindSentItem(const SequenceNumber32& seq) const
+{
+    NS_LOG_FUNCTION(this << seq);
+
+    const SequenceNumber32 tailSeq = m_firstByteSeq + m_sentSize;
+
+    if (seq >= tailSeq)
+    {
+        return m_sentList.end();
+    }
+    if (seq <= m_firstByteSeq)
+    {
+        return m_sentList.begin();
+    }
+
+    // Select the closest anchor among the head, the tail and the highest SACKed item
+    auto it = m_sentList.begin();
+    uint32_t distance = seq - m_firstByteSeq;
+    bool forward = true;
+
+    if (static_cast<uint32_t>(tailSeq - seq) < distance)
+    {
+        it = m_sentList.end();
+        distance = tailSeq - seq;
+        forward = false;
+    }
+
+    if (m_highestSack.first != m_sentList.end())
+    {
+        const SequenceNumber32 anchorSeq = (*m_highestSack.first)->m_startSeq;
+        const uint32_t anchorDistance = (seq >= anchorSeq ? seq - anchorSeq : anchorSeq - seq);
+        if (anchorDistance < distance)
+        {
+            it = m_highestSack.first;
+            forward = (seq >= anchorSeq);
+        }
+    }
+
+    if (forward)
+    {
+        while (it != m_sentList.end() && (*it)->m_startSeq + (*it)->m_packet->GetSize() <= seq)
+        {
+            ++it;
+        }
+        return it;
+    }
+
+    while (it != m_sentList.begin())
+    {
+        auto prev = std::prev(it);
+        if ((*prev)->m_startSeq + (*prev)->m_packet->GetSize() <= seq)
+        {
+            break;
+        }
+        it = prev;
+    }
+    return it;
+}
+
+void
+TcpTxBuffer::AddSackedRange(const SequenceNumber32& start, const SequenceNumber32& end)
+{
+    NS_LOG_FUNCTION(this << start << end);
+    NS_ASSERT(start < end);
+
+    SequenceNumber32 first = start;
+    SequenceNumber32 last = end;
+
+    auto it = m_sackedRanges.lower_bound(start);
+    if (it != m_sackedRanges.begin() && std::prev(it)->second >= start)
+    {
+        // merge with the preceding range
+        --it;
+        first = it->first;
+        last = std::max(last, it->second);
+        it = m_sackedRanges.erase(it);
+    }
+    while (it != m_sackedRanges.end() && it->first <= last)
+    {
+        // merge with the following range
+        last = std::max(last, it->second);
+        it = m_sackedRanges.erase(it);
+    }
+    m_sackedRanges.emplace_hint(it, first, last);
+}
+
+void
+TcpTxBuffer::RemoveSackedRange(const SequenceNumber32& start, const SequenceNumber32& end)
+{
+    NS_LOG_FUNCTION(this << start << end);
+
+    auto it = m_sackedRanges.upper_bound(start);
+    if (it != m_sackedRanges.begin())
+    {
+        --it;
+    }
+    while (it != m_sackedRanges.end() && it->first < end)
+    {
+        if (it->second <= start)
+        {
+            ++it;
+            continue;
+        }
+        const auto [first, last] = *it;
+        it = m_sackedRanges.erase(it);
+        if (first < start)
+        {
+            m_sackedRanges.emplace(first, start);
+        }
+        if (last > end)
+        {
+            m_sackedRanges.emplace(end, last);
+        }
+    }
+}
+
+SequenceNumber32
+TcpTxBuffer::GetSackedRangeEnd(const SequenceNumber32& seq) const
+{
+    auto it = m_sackedRanges.upper_bound(seq);
+    if (it == m_sackedRanges.begin())
+    {
+        return seq;
+    }
+    --it;
+    return (it->second > seq ? it->second : seq);
+}
+
 void
 TcpTxBuffer::SplitItems(TcpTxItem* t1, TcpTxItem* t2, uint32_t size) const
 {
@@ -744,6 +874,13 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
         m_firstByteSeq = seq;
     }
 
+    // Forget the SACKed bytes that have been discarded
+    if (!m_sackedRanges.empty() && m_sackedRanges.begin()->first < m_firstByteSeq)
+    {
+        RemoveSackedRange(m_sackedRanges.begin()->first, m_firstByteSeq);
+    }
+    m_lostOrSackedUpTo = std::max(m_lostOrSackedUpTo, m_firstByteSeq.Get());
+
     if (!m_sentList.empty())
     {
         TcpTxItem* head = m_sentList.front();
@@ -755,6 +892,8 @@ TcpTxBuffer::DiscardUpTo(const SequenceNumber32& seq, const Callback<void, TcpTx
             // when adding Reno dupacks in the count.
             head->m_sacked = false;
             m_sackedOut -= head->m_packet->GetSize();
+            RemoveSackedRange(head->m_startSeq, head->m_startSeq + head->m_packet->GetSize());
+            m_lostOrSackedUpTo = head->m_startSeq;
             NS_LOG_INFO("Moving the SACK flag from the HEAD to another segment");
             AddRenoSack();
             MarkHeadAsLost();
@@ -788,15 +927,21 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
 
     for (auto option_it = list.begin(); option_it != list.end(); ++option_it)
     {
-        auto item_it = m_sentList.begin();
-        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
         if (m_firstByteSeq + m_sentSize < (*option_it).first)
         {
             NS_LOG_INFO("Not updating scoreboard, the option block is outside the sent list");
             return bytesSacked;
         }
 
+        // The items preceding the one containing the start of the block cannot be
+        // mapped over the block, start from that item
+        auto item_it = FindSentItem((*option_it).first);
+        SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq + m_sentSize;
+        if (item_it != m_sentList.end())
+        {
+            beginOfCurrentPacket = (*item_it)->m_startSeq;
+        }
+
         while (item_it != m_sentList.end())
         {
             uint32_t pktSize = (*item_it)->m_packet->GetSize();
@@ -815,6 +960,19 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                     NS_LOG_INFO("Received block " << *option_it << ", checking sentList for block "
                                                   << *(*item_it)
                                                   << ", found in the sackboard already sacked");
+
+                    // Skip the whole run of already SACKed items this item belongs to
+                    const SequenceNumber32 runEnd = GetSackedRangeEnd(beginOfCurrentPacket);
+                    NS_ASSERT(runEnd >= beginOfCurrentPacket + pktSize);
+                    if (runEnd >= (*option_it).second)
+                    {
+                        // The rest of the block is already SACKed
+                        break;
+                    }
+                    item_it = FindSentItem(runEnd);
+                    NS_ASSERT(item_it == m_sentList.end() || (*item_it)->m_startSeq == runEnd);
+                    beginOfCurrentPacket = runEnd;
+                    continue;
                 }
                 else
                 {
@@ -827,6 +985,7 @@ TcpTxBuffer::Update(const TcpOptionSack::SackList& list, const Callback<void, Tc
                     (*item_it)->m_sacked = true;
                     m_sackedOut += (*item_it)->m_packet->GetSize();
                     bytesSacked += (*item_it)->m_packet->GetSize();
+                    AddSackedRange(beginOfCurrentPacket, beginOfCurrentPacket + pktSize);
 
                     if (m_highestSack.first == m_sentList.end() ||
                         m_highestSack.second <= beginOfCurrentPacket + pktSize)
@@ -889,16 +1048,29 @@ TcpTxBuffer::UpdateLostCount()
                                                  << *(*m_highestSack.first));
     }
 
+    // The items below m_lostOrSackedUpTo are already lost or SACKed, no need to walk them
+    const SequenceNumber32 markedUpTo = m_lostOrSackedUpTo;
+
     for (auto it = m_highestSack.first; it != m_sentList.begin(); --it)
     {
         TcpTxItem* item = *it;
         if (item->m_sacked)
         {
             sacked++;
+
+            if (sacked == m_dupAckThresh)
+            {
+                // all the items below this one are going to be lost or SACKed
+                m_lostOrSackedUpTo = std::max(m_lostOrSackedUpTo, item->m_startSeq);
+            }
         }
 
         if (sacked >= m_dupAckThresh)
         {
+            if (item->m_startSeq + item->m_packet->GetSize() <= markedUpTo)
+            {
+                break;
+            }
             if (!item->m_sacked && !item->m_lost)
             {
                 item->m_lost = true;
@@ -926,34 +1098,31 @@ TcpTxBuffer::IsLost(const SequenceNumber32& seq) const
 {
     NS_LOG_FUNCTION(this << seq);
 
-    SequenceNumber32 beginOfCurrentPacket = m_firstByteSeq;
-
     if (seq >= m_highestSack.second)
     {
         return false;
     }
 
-    // In theory, using a map and hints when inserting elements can improve
-    // performance
-    for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
+    // Start from the first item beginning at or after seq
+    auto it = FindSentItem(seq);
+    if (it != m_sentList.end() && (*it)->m_startSeq < seq)
     {
-        // Search for the right iterator before calling IsLost()
-        if (beginOfCurrentPacket >= seq)
-        {
-            if ((*it)->m_lost)
-            {
-                NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
-                return true;
-            }
+        ++it;
+    }
 
-            if ((*it)->m_sacked)
-            {
-                NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
-                return false;
-            }
+    for (; it != m_sentList.end(); ++it)
+    {
+        if ((*it)->m_lost)
+        {
+            NS_LOG_INFO("seq=" << seq << " is lost because of lost flag");
+            return true;
         }
 
-        beginOfCurrentPacket += (*it)->m_packet->GetSize();
+        if ((*it)->m_sacked)
+        {
+            NS_LOG_INFO("seq=" << seq << " is not lost because of sacked flag");
+            return false;
+        }
     }
 
     return false;
@@ -1221,6 +1390,8 @@ TcpTxBuffer::ResetRenoSack()
     }
 
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_sackedRanges.clear();
+    m_lostOrSackedUpTo = m_firstByteSeq;
 }
 
 void
@@ -1250,6 +1421,8 @@ TcpTxBuffer::ResetSentList()
     m_retrans = 0;
     m_sackedOut = 0;
     m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+    m_sackedRanges.clear();
+    m_lostOrSackedUpTo = m_firstByteSeq;
 }
 
 void
@@ -1262,6 +1435,13 @@ TcpTxBuffer::ResetLastSegmentSent()
 
         m_sentList.pop_back();
         m_sentSize -= item->m_packet->GetSize();
+        if (item->m_sacked)
+        {
+            RemoveSackedRange(item->m_startSeq, item->m_startSeq + item->m_packet->GetSize());
+            // the iterator to the highest SACKed item may have been invalidated
+            m_highestSack = FindHighestSacked();
+        }
+        m_lostOrSackedUpTo = std::min(m_lostOrSackedUpTo, item->m_startSeq);
         if (item->m_retrans)
         {
             m_retrans -= item->m_packet->GetSize();
@@ -1282,6 +1462,8 @@ TcpTxBuffer::SetSentListLost(bool resetSack)
         m_sackedOut = 0;
         m_lostOut = m_sentSize;
         m_highestSack = std::make_pair(m_sentList.end(), SequenceNumber32(0));
+        m_sackedRanges.clear();
+        m_lostOrSackedUpTo = m_firstByteSeq;
     }
     else
     {
@@ -1361,6 +1543,9 @@ TcpTxBuffer::MarkHeadAsLost()
         {
             m_sentList.front()->m_sacked = false;
             m_sackedOut -= m_sentList.front()->m_packet->GetSize();
+            RemoveSackedRange(m_sentList.front()->m_startSeq,
+                              m_sentList.front()->m_startSeq +
+                                  m_sentList.front()->m_packet->GetSize());
         }
 
         if (m_sentList.front()->m_retrans)
@@ -1395,12 +1580,13 @@ TcpTxBuffer::AddRenoSack()
     m_renoSack = true;
 
     // We can _never_ SACK the head, so start from the second segment sent
-    auto it = ++m_sentList.begin();
+    PacketList::const_iterator it = std::next(m_sentList.begin());
 
-    // Find the "highest sacked" point, that is SND.UNA + m_sackedOut
-    while (it != m_sentList.end() && (*it)->m_sacked)
+    // Find the "highest sacked" point, that is SND.UNA + m_sackedOut, by skipping
+    // the run of sacked segments following the head
+    if (it != m_sentList.end() && (*it)->m_sacked)
     {
-        ++it;
+        it = FindSentItem(GetSackedRangeEnd((*it)->m_startSeq));
     }
 
     // Add to the sacked size the size of the first "not sacked" segment
@@ -1408,6 +1594,7 @@ TcpTxBuffer::AddRenoSack()
     {
         (*it)->m_sacked = true;
         m_sackedOut += (*it)->m_packet->GetSize();
+        AddSackedRange((*it)->m_startSeq, (*it)->m_startSeq + (*it)->m_packet->GetSize());
         m_highestSack = std::make_pair(it, (*it)->m_startSeq);
         NS_LOG_INFO("Added a Reno SACK, status: " << *this);
     }
@@ -1433,12 +1620,24 @@ TcpTxBuffer::ConsistencyCheck() const
     uint32_t sacked = 0;
     uint32_t lost = 0;
     uint32_t retrans = 0;
+    std::map<SequenceNumber32, SequenceNumber32> sackedRanges;
 
     for (auto it = m_sentList.begin(); it != m_sentList.end(); ++it)
     {
         if ((*it)->m_sacked)
         {
             sacked += (*it)->m_packet->GetSize();
+
+            const SequenceNumber32 end = (*it)->m_startSeq + (*it)->m_packet->GetSize();
+            if (!sackedRanges.empty() &&
+                std::prev(sackedRanges.end())->second == (*it)->m_startSeq)
+            {
+                std::prev(sackedRanges.end())->second = end;
+            }
+            else
+            {
+                sackedRanges.emplace((*it)->m_startSeq, end);
+            }
         }
         if ((*it)->m_lost)
         {
@@ -1448,6 +1647,9 @@ TcpTxBuffer::ConsistencyCheck() const
         {
             retrans += (*it)->m_packet->GetSize();
         }
+        NS_ASSERT_MSG((*it)->m_startSeq + (*it)->m_packet->GetSize() > m_lostOrSackedUpTo ||
+                          (*it)->m_lost || (*it)->m_sacked,
+                      "Item " << *(*it) << " is neither lost nor SACKed");
     }
 
     NS_ASSERT_MSG(sacked == m_sackedOut,
@@ -1455,6 +1657,7 @@ TcpTxBuffer::ConsistencyCheck() const
     NS_ASSERT_MSG(lost == m_lostOut, " Counted lost: " << lost << " stored lost: " << m_lostOut);
     NS_ASSERT_MSG(retrans == m_retrans,
                   " Counted retrans: " << retrans << " stored retrans: " << m_retrans);
+    NS_ASSERT_MSG(sackedRanges == m_sackedRanges, "SACKed ranges out of sync with the sent list");
 }
 
 std::ostream&
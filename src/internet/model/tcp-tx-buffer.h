@@ -28,6 +28,8 @@
 #include "ns3/sequence-number.h"
 #include "ns3/traced-value.h"
 
+#include <map>
+
 namespace ns3
 {
 class Packet;
@@ -602,6 +604,49 @@ class TcpTxBuffer : public Object
      */
     std::pair<TcpTxBuffer::PacketList::const_iterator, SequenceNumber32> FindHighestSacked() const;
 
+    /**
+     * \brief Find the item of the sent list that contains the given sequence number
+     *
+     * The items of the sent list are stored in sequence order and each of them knows
+     * its starting sequence number. Hence, the search starts from the anchor closest
+     * to the given sequence number among the head of the sent list, the highest SACKed
+     * item and the tail of the sent list, so that the lookups for sequence numbers in
+     * the recently sent or SACKed region do not walk the whole list when the window
+     * is large.
+     *
+     * \param seq the sequence number to look for
+     * \return an iterator to the item containing seq or, if no item contains seq, to
+     *         the first item starting after seq (possibly the end of the sent list)
+     */
+    PacketList::const_iterator FindSentItem(const SequenceNumber32& seq) const;
+
+    /**
+     * \brief Record that the given range of bytes of the sent list is SACKed
+     *
+     * The range is merged with the adjacent and overlapping SACKed ranges.
+     *
+     * \param start the first byte of the range
+     * \param end the byte following the last byte of the range
+     */
+    void AddSackedRange(const SequenceNumber32& start, const SequenceNumber32& end);
+
+    /**
+     * \brief Record that the given range of bytes of the sent list is no longer SACKed
+     *
+     * \param start the first byte of the range
+     * \param end the byte following the last byte of the range
+     */
+    void RemoveSackedRange(const SequenceNumber32& start, const SequenceNumber32& end);
+
+    /**
+     * \brief Get the end of the run of SACKed bytes containing the given sequence number
+     *
+     * \param seq the sequence number
+     * \return the byte following the last byte of the SACKed range containing seq, or seq
+     *         itself if seq is not SACKed
+     */
+    SequenceNumber32 GetSackedRangeEnd(const SequenceNumber32& seq) const;
+
     PacketList m_appList;              //!< Buffer for application data
     PacketList m_sentList;             //!< Buffer for sent (but not acked) data
     uint32_t m_maxBuffer;              //!< Max number of data bytes in buffer (SND.WND)
@@ -613,6 +658,19 @@ class TcpTxBuffer : public Object
         m_firstByteSeq; //!< Sequence number of the first byte in data (SND.UNA)
     std::pair<PacketList::const_iterator, SequenceNumber32> m_highestSack; //!< Highest SACK byte
 
+    /**
+     * Disjoint ranges of SACKed bytes of the sent list (first byte and byte following the
+     * last byte of every range), used to skip the runs of already SACKed items when
+     * processing SACK blocks
+     */
+    std::map<SequenceNumber32, SequenceNumber32> m_sackedRanges;
+
+    /**
+     * All the items of the sent list ending at or before this sequence number are
+     * known to be either lost or SACKed, hence UpdateLostCount does not walk them
+     */
+    SequenceNumber32 m_lostOrSackedUpTo{0};
+
     uint32_t m_lostOut{0};   //!< Number of lost bytes
     uint32_t m_sackedOut{0}; //!< Number of sacked bytes
     uint32_t m_retrans{0};   //!< Number of retransmitted bytes
@@ -16,6 +16,7 @@
 #include "ns3/boolean.h"
 #include "ns3/bridge-helper.h"
 #include "ns3/config.h"
+#include "ns3/global-value.h"
 #include "ns3/inet-socket-address.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
@@ -41,6 +42,9 @@
 #include "ns3/udp-socket-factory.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+#include <sstream>
+#include <string>
 #include <vector>
 
 using namespace ns3;
@@ -1311,6 +1315,269 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting incremental update test
+ *
+ * This test verifies that the routes computed by
+ * Ipv4GlobalRoutingHelper::UpdateRoutingTables() after a topology change are
+ * the routes computed by Ipv4GlobalRoutingHelper::RecomputeRoutingTables(),
+ * and that the routes computed on several threads (see the
+ * GlobalRoutingSpfThreads global value) are the routes computed on a single
+ * thread.  The topology is made of two LANs of stations, each served by a
+ * router, and of a transit LAN connecting the two routers to a third router,
+ * which is connected to a server and to the second router by point-to-point
+ * links:
+ *
+ *   stations A --- r0 ---+--- LAN C ---+--- r2 <--------> server
+ *                        |             |     \ 10.1.4.0/30
+ *   stations B --- r1 ---+-------------+      |
+ *                   \_________________________/ 10.1.5.0/30
+ */
+class Ipv4GlobalRoutingUpdateTestCase : public TestCase
+{
+  public:
+    Ipv4GlobalRoutingUpdateTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \brief Get the routes of all the nodes of the test.
+     * \return the routes of every node, printed and sorted
+     */
+    std::vector<std::vector<std::string>> GetRoutes() const;
+
+    /**
+     * \brief Update the routing tables and check that the routes are those of
+     * a full recomputation.
+     * \param step a description of the topology change
+     */
+    void CheckUpdate(const std::string& step);
+
+    NodeContainer m_nodes; //!< Nodes used in the test.
+};
+
+Ipv4GlobalRoutingUpdateTestCase::Ipv4GlobalRoutingUpdateTestCase()
+    : TestCase("Incremental and multi-threaded global routing")
+{
+}
+
+std::vector<std::vector<std::string>>
+Ipv4GlobalRoutingUpdateTestCase::GetRoutes() const
+{
+    std::vector<std::vector<std::string>> routes;
+    for (auto i = m_nodes.Begin(); i != m_nodes.End(); ++i)
+    {
+        Ptr<Ipv4GlobalRouting> globalRouting =
+            (*i)->GetObject<Ipv4>()->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+        std::vector<std::string> nodeRoutes;
+        for (uint32_t j = 0; j < globalRouting->GetNRoutes(); j++)
+        {
+            std::ostringstream oss;
+            oss << *globalRouting->GetRoute(j);
+            nodeRoutes.push_back(oss.str());
+        }
+        std::sort(nodeRoutes.begin(), nodeRoutes.end());
+        routes.push_back(nodeRoutes);
+    }
+    return routes;
+}
+
+void
+Ipv4GlobalRoutingUpdateTestCase::CheckUpdate(const std::string& step)
+{
+    Ipv4GlobalRoutingHelper::UpdateRoutingTables();
+    std::vector<std::vector<std::string>> updated = GetRoutes();
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    std::vector<std::vector<std::string>> recomputed = GetRoutes();
+
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(updated[i].size(),
+                              recomputed[i].size(),
+                              "Wrong number of routes of node " << i << " " << step);
+        for (uint32_t j = 0; j < std::min(updated[i].size(), recomputed[i].size()); j++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(updated[i][j],
+                                  recomputed[i][j],
+                                  "Wrong route of node " << i << " " << step);
+        }
+    }
+}
+
+void
+Ipv4GlobalRoutingUpdateTestCase::DoRun()
+{
+    NodeContainer routers;
+    routers.Create(3);
+    NodeContainer stationsA;
+    stationsA.Create(4);
+    NodeContainer stationsB;
+    stationsB.Create(3);
+    NodeContainer server;
+    server.Create(1);
+    m_nodes.Add(routers);
+    m_nodes.Add(stationsA);
+    m_nodes.Add(stationsB);
+    m_nodes.Add(server);
+
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(m_nodes);
+
+    SimpleNetDeviceHelper simpleHelper;
+    Ptr<SimpleChannel> channelA = CreateObject<SimpleChannel>();
+    NetDeviceContainer devicesA = simpleHelper.Install(routers.Get(0), channelA);
+    devicesA.Add(simpleHelper.Install(stationsA, channelA));
+    Ptr<SimpleChannel> channelB = CreateObject<SimpleChannel>();
+    NetDeviceContainer devicesB = simpleHelper.Install(routers.Get(1), channelB);
+    devicesB.Add(simpleHelper.Install(stationsB, channelB));
+    NetDeviceContainer devicesC = simpleHelper.Install(routers);
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    NetDeviceContainer devicesServer =
+        simpleHelper.Install(NodeContainer(routers.Get(2), server.Get(0)));
+    NetDeviceContainer devicesR1R2 =
+        simpleHelper.Install(NodeContainer(routers.Get(1), routers.Get(2)));
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    ipv4.Assign(devicesA);
+    ipv4.SetBase("10.1.2.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfacesB = ipv4.Assign(devicesB);
+    ipv4.SetBase("10.1.3.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfacesC = ipv4.Assign(devicesC);
+    ipv4.SetBase("10.1.4.0", "255.255.255.252");
+    ipv4.Assign(devicesServer);
+    ipv4.SetBase("10.1.5.0", "255.255.255.252");
+    ipv4.Assign(devicesR1R2);
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    std::vector<std::vector<std::string>> populated = GetRoutes();
+    NS_TEST_ASSERT_MSG_EQ(populated[0].empty(), false, "Error-- no route on router 0");
+
+    // The routes computed on several threads are the routes computed on one thread
+    GlobalValue::Bind("GlobalRoutingSpfThreads", UintegerValue(3));
+    Ipv4GlobalRoutingHelper::RecomputeRoutingTables();
+    std::vector<std::vector<std::string>> threaded = GetRoutes();
+    GlobalValue::Bind("GlobalRoutingSpfThreads", UintegerValue(1));
+    for (uint32_t i = 0; i < m_nodes.GetN(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ((threaded[i] == populated[i]),
+                              true,
+                              "Wrong routes of node " << i << " computed on several threads");
+    }
+
+    CheckUpdate("without topology change");
+
+    // A new station joins the first LAN (change local to the station)
+    Ptr<Node> newStation = CreateObject<Node>();
+    m_nodes.Add(newStation);
+    internet.Install(newStation);
+    ipv4.SetBase("10.1.1.0", "255.255.255.0", "0.0.0.100");
+    simpleHelper.SetNetDevicePointToPointMode(false);
+    ipv4.Assign(simpleHelper.Install(newStation, channelA));
+    CheckUpdate("after adding a station");
+
+    // A station of the second LAN leaves
+    interfacesB.Get(1).first->SetDown(interfacesB.Get(1).second);
+    CheckUpdate("after a station left");
+
+    // The second router leaves the transit LAN
+    interfacesC.Get(1).first->SetDown(interfacesC.Get(1).second);
+    CheckUpdate("after a router left the transit LAN");
+
+    interfacesB.Get(1).first->SetUp(interfacesB.Get(1).second);
+    interfacesC.Get(1).first->SetUp(interfacesC.Get(1).second);
+    CheckUpdate("after the interfaces are up again");
+
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup internet-test
+ *
+ * \brief IPv4 GlobalRouting test with a large LAN
+ *
+ * The given number of stations share a LAN with a router, which is connected
+ * to a server by a point-to-point link.  After the routing tables are
+ * populated, a station joins the LAN and the routing tables are updated: the
+ * new station must get the same number of routes as the other stations.
+ */
+class Ipv4GlobalRoutingLargeLanTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param nStations the number of stations
+     */
+    Ipv4GlobalRoutingLargeLanTestCase(uint32_t nStations);
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_nStations; //!< the number of stations
+};
+
+Ipv4GlobalRoutingLargeLanTestCase::Ipv4GlobalRoutingLargeLanTestCase(uint32_t nStations)
+    : TestCase("Global routing with a LAN of " + std::to_string(nStations) + " stations"),
+      m_nStations(nStations)
+{
+}
+
+void
+Ipv4GlobalRoutingLargeLanTestCase::DoRun()
+{
+    NodeContainer router;
+    router.Create(1);
+    NodeContainer stations;
+    stations.Create(m_nStations);
+    NodeContainer server;
+    server.Create(1);
+
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(NodeContainer(router, stations, server));
+
+    SimpleNetDeviceHelper simpleHelper;
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+    NetDeviceContainer devices = simpleHelper.Install(router.Get(0), channel);
+    devices.Add(simpleHelper.Install(stations, channel));
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    NetDeviceContainer devicesServer =
+        simpleHelper.Install(NodeContainer(router.Get(0), server.Get(0)));
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.0.0.0", "255.255.0.0");
+    ipv4.Assign(devices);
+    ipv4.SetBase("10.1.0.0", "255.255.255.252");
+    ipv4.Assign(devicesServer);
+
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    Ptr<Node> newStation = CreateObject<Node>();
+    internet.Install(newStation);
+    ipv4.SetBase("10.0.0.0", "255.255.0.0", "0.0.255.254");
+    simpleHelper.SetNetDevicePointToPointMode(false);
+    ipv4.Assign(simpleHelper.Install(newStation, channel));
+    Ipv4GlobalRoutingHelper::UpdateRoutingTables();
+
+    Ptr<Ipv4GlobalRouting> globalRouting =
+        newStation->GetObject<Ipv4>()->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+    Ptr<Ipv4GlobalRouting> stationRouting =
+        stations.Get(0)->GetObject<Ipv4>()->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+    NS_TEST_EXPECT_MSG_GT(globalRouting->GetNRoutes(), 0, "Error-- no route on the new station");
+    NS_TEST_EXPECT_MSG_EQ(globalRouting->GetNRoutes(),
+                          stationRouting->GetNRoutes(),
+                          "Error-- the new station has a different number of routes");
+
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1333,6 +1600,9 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite()
     AddTestCase(new TwoBridgeTest, TestCase::QUICK);
     AddTestCase(new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase(new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingUpdateTestCase, TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingLargeLanTestCase(1000), TestCase::QUICK);
+    AddTestCase(new Ipv4GlobalRoutingLargeLanTestCase(10000), TestCase::EXTENSIVE);
 }
 
 static Ipv4GlobalRoutingTestSuite
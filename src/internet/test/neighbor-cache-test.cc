@@ -17,15 +17,19 @@
  * Author: Zhiheng Dong <dzh2077@gmail.com>
  */
 
+#include "ns3/arp-cache.h"
 #include "ns3/icmpv4-l4-protocol.h"
 #include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-header.h"
 #include "ns3/ipv4-l3-protocol.h"
 #include "ns3/ipv4-routing-helper.h"
 #include "ns3/ipv6-address-helper.h"
 #include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6-routing-helper.h"
+#include "ns3/mac48-address.h"
+#include "ns3/ndisc-cache.h"
 #include "ns3/neighbor-cache-helper.h"
 #include "ns3/simple-channel.h"
 #include "ns3/simple-net-device-helper.h"
@@ -1221,6 +1225,79 @@ DynamicPartialTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup internet-test
+ *
+ * \brief Bulk addition of auto-generated neighbor cache entries Test
+ */
+class BulkEntriesTest : public TestCase
+{
+  public:
+    void DoRun() override;
+    BulkEntriesTest();
+};
+
+BulkEntriesTest::BulkEntriesTest()
+    : TestCase("The BulkEntriesTest checks that auto-generated entries are added in bulk to the "
+               "ARP and NDISC caches.")
+{
+}
+
+void
+BulkEntriesTest::DoRun()
+{
+    Mac48Address mac1("00:00:00:00:00:01");
+    Mac48Address mac2("00:00:00:00:00:02");
+    Mac48Address mac3("00:00:00:00:00:03");
+
+    // An entry waiting for a reply is in the cache before the entries are added
+    Ptr<ArpCache> arpCache = CreateObject<ArpCache>();
+    arpCache->Add(Ipv4Address("10.1.1.2"))->MarkWaitReply({Create<Packet>(), Ipv4Header()});
+    arpCache->AddAutoGeneratedEntries({{Ipv4Address("10.1.1.3"), mac3},
+                                       {Ipv4Address("10.1.1.1"), mac1},
+                                       {Ipv4Address("10.1.1.2"), mac1},
+                                       {Ipv4Address("10.1.1.2"), mac2}});
+    for (const auto& [address, mac] : std::vector<std::pair<Ipv4Address, Mac48Address>>{
+             {"10.1.1.1", mac1},
+             {"10.1.1.2", mac2},
+             {"10.1.1.3", mac3}})
+    {
+        ArpCache::Entry* entry = arpCache->Lookup(address);
+        NS_TEST_ASSERT_MSG_NE(entry, nullptr, "No ARP entry for " << address);
+        NS_TEST_EXPECT_MSG_EQ(entry->GetIpv4Address(), address, "Wrong address " << address);
+        NS_TEST_EXPECT_MSG_EQ(Mac48Address::ConvertFrom(entry->GetMacAddress()),
+                              mac,
+                              "Wrong MAC address for " << address);
+        NS_TEST_EXPECT_MSG_EQ(entry->IsAutoGenerated(), true, "Not auto-generated " << address);
+    }
+    arpCache->RemoveAutoGeneratedEntries();
+    NS_TEST_EXPECT_MSG_EQ(arpCache->Lookup(Ipv4Address("10.1.1.2")),
+                          nullptr,
+                          "Auto-generated ARP entries were not removed");
+    arpCache->Dispose();
+
+    Ptr<NdiscCache> ndiscCache = CreateObject<NdiscCache>();
+    ndiscCache->AddAutoGeneratedEntries({{Ipv6Address("2001::3"), mac3},
+                                         {Ipv6Address("fe80::1"), mac1},
+                                         {Ipv6Address("2001::1"), mac1}});
+    ndiscCache->AddAutoGeneratedEntries({{Ipv6Address("2001::3"), mac2}});
+    for (const auto& [address, mac] : std::vector<std::pair<Ipv6Address, Mac48Address>>{
+             {"2001::1", mac1},
+             {"2001::3", mac2},
+             {"fe80::1", mac1}})
+    {
+        NdiscCache::Entry* entry = ndiscCache->Lookup(address);
+        NS_TEST_ASSERT_MSG_NE(entry, nullptr, "No NDISC entry for " << address);
+        NS_TEST_EXPECT_MSG_EQ(entry->GetIpv6Address(), address, "Wrong address " << address);
+        NS_TEST_EXPECT_MSG_EQ(Mac48Address::ConvertFrom(entry->GetMacAddress()),
+                              mac,
+                              "Wrong MAC address for " << address);
+        NS_TEST_EXPECT_MSG_EQ(entry->IsAutoGenerated(), true, "Not auto-generated " << address);
+    }
+    ndiscCache->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup internet-test
  *
@@ -1239,6 +1316,7 @@ class NeighborCacheTestSuite : public TestSuite
         AddTestCase(new FlushTest, TestCase::QUICK);
         AddTestCase(new DuplicateTest, TestCase::QUICK);
         AddTestCase(new DynamicPartialTest, TestCase::QUICK);
+        AddTestCase(new BulkEntriesTest, TestCase::QUICK);
     }
 };
 
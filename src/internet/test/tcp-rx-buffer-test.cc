@@ -293,6 +293,72 @@ TcpRxBufferTestCase::DoTeardown()
 {
 }
 
+/**
+ * \ingroup internet-tests
+ * \ingroup tests
+ *
+ * \brief Reassemble a large window received out of order
+ *
+ * One segment every 100 is lost and retransmitted after the rest of the window has been
+ * received, so that the receive buffer holds many out of order segments when the
+ * segments are added and when the holes are filled.
+ */
+class TcpRxBufferLargeWindowTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param nSegments the number of segments in the window
+     */
+    TcpRxBufferLargeWindowTestCase(uint32_t nSegments);
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_nSegments; //!< the number of segments in the window
+};
+
+TcpRxBufferLargeWindowTestCase::TcpRxBufferLargeWindowTestCase(uint32_t nSegments)
+    : TestCase("Reassemble a window of " + std::to_string(nSegments) + " segments"),
+      m_nSegments(nSegments)
+{
+}
+
+void
+TcpRxBufferLargeWindowTestCase::DoRun()
+{
+    const uint32_t segmentSize = 1000;
+    const uint32_t lossInterval = 100;
+    const SequenceNumber32 head(1);
+
+    TcpRxBuffer rxBuf;
+    rxBuf.SetNextRxSequence(head);
+    rxBuf.SetMaxBufferSize(m_nSegments * segmentSize);
+    auto p = Create<Packet>(segmentSize);
+    TcpHeader h;
+
+    for (const bool retransmission : {false, true})
+    {
+        for (uint32_t i = 0; i < m_nSegments; i++)
+        {
+            if ((i % lossInterval == 0) == retransmission)
+            {
+                h.SetSequenceNumber(head + i * segmentSize);
+                rxBuf.Add(p, h);
+            }
+        }
+    }
+
+    NS_TEST_EXPECT_MSG_EQ(rxBuf.NextRxSequence(),
+                          head + m_nSegments * segmentSize,
+                          "Unexpected RCV.NXT");
+    NS_TEST_EXPECT_MSG_EQ(rxBuf.Available(),
+                          m_nSegments * segmentSize,
+                          "Unexpected number of bytes available");
+    NS_TEST_EXPECT_MSG_EQ(rxBuf.GetSackListSize(), 0, "The SACK list should be empty");
+}
+
 /**
  * \ingroup internet-test
  *
@@ -305,6 +371,10 @@ class TcpRxBufferTestSuite : public TestSuite
         : TestSuite("tcp-rx-buffer", UNIT)
     {
         AddTestCase(new TcpRxBufferTestCase, TestCase::QUICK);
+        for (uint32_t nSegments : {1000, 10000})
+        {
+            AddTestCase(new TcpRxBufferLargeWindowTestCase(nSegments), TestCase::QUICK);
+        }
     }
 };
 
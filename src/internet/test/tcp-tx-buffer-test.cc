@@ -430,6 +430,97 @@ TcpTxBufferTestCase::DoTeardown()
 {
 }
 
+/**
+ * \ingroup internet-tests
+ * \ingroup tests
+ *
+ * \brief Process the SACK blocks of a large window
+ *
+ * A window of segments is sent and one segment every 100 is lost. For every other
+ * segment, the receiver sends an ACK carrying the SACK block that contains the segment
+ * and the three most recently reported SACK blocks, as per RFC 2018. The scoreboard is
+ * updated and the first hole is checked for loss at every ACK, as done by TcpSocketBase.
+ */
+class TcpTxBufferLargeWindowTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param nSegments the number of segments in the window
+     */
+    TcpTxBufferLargeWindowTestCase(uint32_t nSegments);
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_nSegments; //!< the number of segments in the window
+};
+
+TcpTxBufferLargeWindowTestCase::TcpTxBufferLargeWindowTestCase(uint32_t nSegments)
+    : TestCase("Process SACK blocks with a window of " + std::to_string(nSegments) +
+               " segments"),
+      m_nSegments(nSegments)
+{
+}
+
+void
+TcpTxBufferLargeWindowTestCase::DoRun()
+{
+    const uint32_t segmentSize = 1000;
+    const uint32_t lossInterval = 100;
+    const SequenceNumber32 head(1);
+
+    TcpTxBuffer txBuf;
+    txBuf.SetHeadSequence(head);
+    txBuf.SetSegmentSize(segmentSize);
+    txBuf.SetDupAckThresh(3);
+    txBuf.SetMaxBufferSize(m_nSegments * segmentSize);
+    txBuf.Add(Create<Packet>(m_nSegments * segmentSize));
+
+    for (uint32_t i = 0; i < m_nSegments; i++)
+    {
+        txBuf.CopyFromSequence(segmentSize, head + i * segmentSize);
+    }
+
+    TcpOptionSack::SackList blocks; // most recently reported block first
+
+    for (uint32_t i = 1; i < m_nSegments; i++)
+    {
+        if (i % lossInterval == 0)
+        {
+            continue;
+        }
+
+        const SequenceNumber32 seq = head + i * segmentSize;
+        if (i % lossInterval == 1)
+        {
+            blocks.emplace_front(seq, seq + segmentSize);
+            if (blocks.size() > 4)
+            {
+                blocks.pop_back();
+            }
+        }
+        else
+        {
+            blocks.front().second = seq + segmentSize;
+        }
+
+        txBuf.Update(blocks);
+        txBuf.IsLost(head);
+    }
+
+    const uint32_t nLost = (m_nSegments + lossInterval - 1) / lossInterval;
+    NS_TEST_EXPECT_MSG_EQ(txBuf.GetSacked(),
+                          (m_nSegments - nLost) * segmentSize,
+                          "Unexpected number of SACKed bytes");
+    NS_TEST_EXPECT_MSG_EQ(txBuf.GetLost(), nLost * segmentSize, "Unexpected number of lost bytes");
+    NS_TEST_EXPECT_MSG_EQ(txBuf.IsLost(head), true, "The first segment should be lost");
+
+    txBuf.DiscardUpTo(head + m_nSegments * segmentSize);
+    NS_TEST_EXPECT_MSG_EQ(txBuf.Size(), 0, "The buffer should be empty");
+}
+
 /**
  * \ingroup internet-test
  *
@@ -442,6 +533,10 @@ class TcpTxBufferTestSuite : public TestSuite
         : TestSuite("tcp-tx-buffer", UNIT)
     {
         AddTestCase(new TcpTxBufferTestCase, TestCase::QUICK);
+        for (uint32_t nSegments : {1000, 10000})
+        {
+            AddTestCase(new TcpTxBufferLargeWindowTestCase(nSegments), TestCase::QUICK);
+        }
     }
 };
 
@@ -36,6 +36,9 @@ NS_LOG_COMPONENT_DEFINE("PacketMetadata");
 
 bool PacketMetadata::m_enable = false;
 bool PacketMetadata::m_enableChecking = false;
+bool PacketMetadata::m_lean = false;
+// the extra reference prevents the empty buffer from being recycled
+PacketMetadata::Data PacketMetadata::m_emptyData = {1, 0, 0, {}};
 bool PacketMetadata::m_metadataSkipped = false;
 uint32_t PacketMetadata::m_maxSize = 0;
 uint16_t PacketMetadata::m_chunkUid = 0;
@@ -73,6 +76,13 @@ PacketMetadata::EnableChecking()
     m_enableChecking = true;
 }
 
+void
+PacketMetadata::SetLean(bool lean)
+{
+    NS_LOG_FUNCTION(lean);
+    m_lean = lean;
+}
+
 void
 PacketMetadata::ReserveCopy(uint32_t size)
 {
@@ -169,6 +169,17 @@ class PacketMetadata
      * \brief Enable the packet metadata checking
      */
     static void EnableChecking();
+    /**
+     * \brief Enable or disable the lean mode
+     *
+     * In lean mode, packets do not allocate any storage for the metadata
+     * while the packet metadata is disabled: all of them share a buffer
+     * with no room for items, which is replaced by a private buffer if the
+     * packet metadata is enabled later on.
+     *
+     * \param lean whether to enable the lean mode
+     */
+    static void SetLean(bool lean);
 
     /**
      * \brief Constructor
@@ -678,6 +689,8 @@ class PacketMetadata
     static DataFreeList m_freeList; //!< the metadata data storage
     static bool m_enable;           //!< Enable the packet metadata
     static bool m_enableChecking;   //!< Enable the packet metadata checking
+    static bool m_lean;             //!< Enable the lean mode
+    static Data m_emptyData;        //!< the buffer shared by all the packets in lean mode
 
     /**
      * Set to true when adding metadata to a packet is skipped because
@@ -707,13 +720,24 @@ namespace ns3
 {
 
 PacketMetadata::PacketMetadata(uint64_t uid, uint32_t size)
-    : m_data(PacketMetadata::Create(10)),
+    : m_data(nullptr),
       m_head(0xffff),
       m_tail(0xffff),
       m_used(0),
       m_packetUid(uid)
 {
-    memset(m_data->m_data, 0xff, 4);
+    if (m_lean && !m_enable)
+    {
+        // the empty buffer has no room for items, hence it is never written
+        m_data = &m_emptyData;
+        NS_ASSERT(m_data->m_count < std::numeric_limits<uint32_t>::max());
+        m_data->m_count++;
+    }
+    else
+    {
+        m_data = PacketMetadata::Create(10);
+        memset(m_data->m_data, 0xff, 4);
+    }
     if (size > 0)
     {
         DoAddHeader(0, size);
@@ -37,6 +37,26 @@ namespace ns3
 
 NS_LOG_COMPONENT_DEFINE("PacketTagList");
 
+PacketTagList::TagDataFreeList PacketTagList::m_freeList;
+bool PacketTagList::m_lean = false;
+
+PacketTagList::TagDataFreeList::~TagDataFreeList()
+{
+    for (auto tagData : *this)
+    {
+        std::free(tagData);
+    }
+    // the TagData structs released from now on are deallocated
+    PacketTagList::m_lean = false;
+}
+
+void
+PacketTagList::SetLean(bool lean)
+{
+    NS_LOG_FUNCTION(lean);
+    m_lean = lean;
+}
+
 PacketTagList::TagData*
 PacketTagList::CreateTagData(size_t dataSize)
 {
@@ -44,14 +64,38 @@ PacketTagList::CreateTagData(size_t dataSize)
                   "Requested TagData size " << dataSize << " exceeds maximum "
                                             << std::numeric_limits<decltype(TagData::size)>::max());
 
-    void* p = std::malloc(sizeof(TagData) + dataSize - 1);
-    // The matching frees are in RemoveAll and RemoveWriter
+    bool fixedSize = m_lean && dataSize <= LEAN_TAG_DATA_SIZE;
+    void* p = nullptr;
+    if (fixedSize && !m_freeList.empty())
+    {
+        p = m_freeList.back();
+        m_freeList.pop_back();
+    }
+    else
+    {
+        p = std::malloc(sizeof(TagData) + (fixedSize ? LEAN_TAG_DATA_SIZE : dataSize) - 1);
+    }
+    // The matching frees are in DestroyTagData
 
     auto tag = new (p) TagData;
+    tag->fixedSize = fixedSize;
     tag->size = dataSize;
     return tag;
 }
 
+void
+PacketTagList::DestroyTagData(TagData* tagData)
+{
+    bool fixedSize = tagData->fixedSize;
+    tagData->~TagData();
+    if (fixedSize && m_lean && m_freeList.size() < 1000)
+    {
+        m_freeList.push_back(tagData);
+        return;
+    }
+    std::free(tagData);
+}
+
 bool
 PacketTagList::COWTraverse(Tag& tag, PacketTagList::COWWriter Writer)
 {
@@ -195,8 +239,7 @@ PacketTagList::RemoveWriter(Tag& tag,
     if (preMerge)
     {
         // found tid before first merge, so delete cur
-        cur->~TagData();
-        std::free(cur);
+        DestroyTagData(cur);
     }
     else
     {
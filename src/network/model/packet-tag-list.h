@@ -28,6 +28,7 @@
 
 #include <ostream>
 #include <stdint.h>
+#include <vector>
 
 namespace ns3
 {
@@ -144,10 +145,30 @@ class PacketTagList
         TagData* next;   //!< Pointer to next in list
         uint32_t count;  //!< Number of incoming links
         TypeId tid;      //!< Type of the tag serialized into #data
+        bool fixedSize;  //!< Whether #data has room for LEAN_TAG_DATA_SIZE bytes
         uint32_t size;   //!< Size of the \c data buffer
         uint8_t data[1]; //!< Serialization buffer
     };
 
+    /**
+     * Capacity of the serialization buffer of the TagData structs that
+     * are recycled in lean mode.
+     */
+    static constexpr uint32_t LEAN_TAG_DATA_SIZE = 20;
+
+    /**
+     * Enable or disable the lean mode.
+     *
+     * In lean mode, the tags whose serialized size does not exceed
+     * LEAN_TAG_DATA_SIZE are stored in TagData structs of fixed capacity,
+     * which are recycled when the tags are removed rather than being
+     * returned to the heap, so that adding a tag to a packet does not
+     * usually require a memory allocation.
+     *
+     * \param [in] lean Whether to enable the lean mode
+     */
+    static void SetLean(bool lean);
+
     /**
      * Create a new PacketTagList.
      */
@@ -252,6 +273,23 @@ class PacketTagList
      * \returns The newly constructed TagData object.
      */
     static TagData* CreateTagData(size_t dataSize);
+    /**
+     * Destroy and deallocate (or recycle, in lean mode) a TagData struct.
+     *
+     * \param [in] tagData The TagData struct to destroy.
+     */
+    static void DestroyTagData(TagData* tagData);
+
+    /**
+     * Container for the TagData structs of fixed capacity that can be reused.
+     */
+    struct TagDataFreeList : public std::vector<TagData*>
+    {
+        ~TagDataFreeList();
+    };
+
+    static TagDataFreeList m_freeList; //!< TagData structs of fixed capacity that can be reused
+    static bool m_lean;                //!< Whether the lean mode is enabled
 
     /**
      * Typedef of method function pointer for copy-on-write operations
@@ -365,15 +403,13 @@ PacketTagList::RemoveAll()
         }
         if (prev != nullptr)
         {
-            prev->~TagData();
-            std::free(prev);
+            DestroyTagData(prev);
         }
         prev = cur;
     }
     if (prev != nullptr)
     {
-        prev->~TagData();
-        std::free(prev);
+        DestroyTagData(prev);
     }
     m_next = nullptr;
 }
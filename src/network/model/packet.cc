@@ -606,6 +606,22 @@ Packet::EnableChecking()
     PacketMetadata::EnableChecking();
 }
 
+void
+Packet::EnableLeanPackets()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    PacketMetadata::SetLean(true);
+    PacketTagList::SetLean(true);
+}
+
+void
+Packet::DisableLeanPackets()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    PacketMetadata::SetLean(false);
+    PacketTagList::SetLean(false);
+}
+
 uint32_t
 Packet::GetSerializedSize() const
 {
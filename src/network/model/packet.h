@@ -536,6 +536,27 @@ class Packet : public SimpleRefCount<Packet>
      * errors will be detected and will abort the program.
      */
     static void EnableChecking();
+    /**
+     * \brief Enable the lean packets mode.
+     *
+     * This mode reduces the memory footprint and the allocation cost of the
+     * packets in simulations that keep large numbers of packets in flight
+     * (e.g., in queues). In lean packets mode:
+     * - packets do not allocate any storage for the metadata, unless the
+     *   metadata is enabled (see EnablePrinting and EnableChecking);
+     * - packet tags are stored in fixed-capacity slots that are recycled,
+     *   rather than allocated on the heap every time a tag is added.
+     *
+     * The lean packets mode can be enabled or disabled at any time and has
+     * no effect on the behavior of packets.
+     */
+    static void EnableLeanPackets();
+    /**
+     * \brief Disable the lean packets mode.
+     *
+     * \see EnableLeanPackets
+     */
+    static void DisableLeanPackets();
 
     /**
      * \brief Returns number of bytes required for packet
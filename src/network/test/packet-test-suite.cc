@@ -520,10 +520,17 @@ struct Expected
 class PacketTest : public TestCase
 {
   public:
-    PacketTest();
+    /**
+     * Constructor
+     * \param lean Whether to run the test in lean packets mode
+     */
+    PacketTest(bool lean);
+    void DoSetup() override;
     void DoRun() override;
+    void DoTeardown() override;
 
   private:
+    bool m_lean; //!< whether to run the test in lean packets mode
     /**
      * Checks the packet
      * \param p The packet
@@ -540,9 +547,28 @@ class PacketTest : public TestCase
     void DoCheckData(Ptr<const Packet> p, uint32_t n, ...);
 };
 
-PacketTest::PacketTest()
-    : TestCase("Packet")
+PacketTest::PacketTest(bool lean)
+    : TestCase(lean ? "Packet (lean)" : "Packet"),
+      m_lean(lean)
+{
+}
+
+void
+PacketTest::DoSetup()
+{
+    if (m_lean)
+    {
+        Packet::EnableLeanPackets();
+    }
+}
+
+void
+PacketTest::DoTeardown()
 {
+    if (m_lean)
+    {
+        Packet::DisableLeanPackets();
+    }
 }
 
 void
@@ -967,11 +993,17 @@ PacketTest::DoRun()
 class PacketTagListTest : public TestCase
 {
   public:
-    PacketTagListTest();
+    /**
+     * Constructor
+     * \param lean Whether to run the test in lean packets mode
+     */
+    PacketTagListTest(bool lean);
     ~PacketTagListTest() override;
 
   private:
+    void DoSetup() override;
     void DoRun() override;
+    void DoTeardown() override;
     /**
      * Checks against a reference PacketTagList
      * \param ref Reference
@@ -1003,11 +1035,32 @@ class PacketTagListTest : public TestCase
      * \return the ticks to remove the tags.
      */
     int AddRemoveTime(const bool verbose = false);
+
+    bool m_lean; //!< whether to run the test in lean packets mode
 };
 
-PacketTagListTest::PacketTagListTest()
-    : TestCase("PacketTagListTest: ")
+PacketTagListTest::PacketTagListTest(bool lean)
+    : TestCase(lean ? "PacketTagListTest (lean): " : "PacketTagListTest: "),
+      m_lean(lean)
+{
+}
+
+void
+PacketTagListTest::DoSetup()
 {
+    if (m_lean)
+    {
+        Packet::EnableLeanPackets();
+    }
+}
+
+void
+PacketTagListTest::DoTeardown()
+{
+    if (m_lean)
+    {
+        Packet::DisableLeanPackets();
+    }
 }
 
 PacketTagListTest::~PacketTagListTest()
@@ -1283,8 +1336,10 @@ class PacketTestSuite : public TestSuite
 PacketTestSuite::PacketTestSuite()
     : TestSuite("packet", UNIT)
 {
-    AddTestCase(new PacketTest, TestCase::QUICK);
-    AddTestCase(new PacketTagListTest, TestCase::QUICK);
+    AddTestCase(new PacketTest(false), TestCase::QUICK);
+    AddTestCase(new PacketTagListTest(false), TestCase::QUICK);
+    AddTestCase(new PacketTest(true), TestCase::QUICK);
+    AddTestCase(new PacketTagListTest(true), TestCase::QUICK);
 }
 
 static PacketTestSuite g_packetTestSuite; //!< Static variable for test initialization
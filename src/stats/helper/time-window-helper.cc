@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "time-window-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/config.h"
+#include "ns3/double.h"
+#include "ns3/log.h"
+
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimeWindowHelper");
+
+TimeWindowHelper::TimeWindowHelper(FileAggregator::FileType fileType)
+    : m_fileType(fileType),
+      m_probeCount(0)
+{
+    NS_LOG_FUNCTION(this << fileType);
+    m_aggregatorFactory.SetTypeId(TimeWindowAggregator::GetTypeId());
+}
+
+TimeWindowHelper::~TimeWindowHelper()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TimeWindowHelper::SetAggregatorAttribute(const std::string& name, const AttributeValue& value)
+{
+    NS_LOG_FUNCTION(this << name);
+    m_aggregatorFactory.Set(name, value);
+}
+
+Ptr<TimeWindowAggregator>
+TimeWindowHelper::WriteProbe(const std::string& typeId,
+                             const std::string& path,
+                             const std::string& probeTraceSource,
+                             const std::string& outputFileNameWithoutExtension)
+{
+    NS_LOG_FUNCTION(this << typeId << path << probeTraceSource << outputFileNameWithoutExtension);
+
+    // There is a problem if there are no matching config paths.
+    const auto lastSlash = path.find_last_of('/');
+    if (Config::LookupMatches(path.substr(0, lastSlash)).GetN() == 0)
+    {
+        NS_FATAL_ERROR("Lookup of " << path << " got no matches");
+    }
+
+    // Create the probe and connect it to all the matching trace sources.
+    m_probeFactory.SetTypeId(typeId);
+    Ptr<Probe> probe = m_probeFactory.Create()->GetObject<Probe>();
+    if (!probe)
+    {
+        NS_ABORT_MSG("The requested type is not a probe");
+    }
+    std::ostringstream probeName;
+    probeName << "TimeWindowProbe-" << ++m_probeCount;
+    probe->SetName(probeName.str());
+    probe->ConnectByPath(path);
+    probe->Enable();
+
+    // Connect the probe to the adaptor.
+    auto adaptor = CreateObject<TimeSeriesAdaptor>();
+    bool connected;
+    if (typeId == "ns3::DoubleProbe" || typeId == "ns3::TimeProbe")
+    {
+        connected = probe->TraceConnectWithoutContext(
+            probeTraceSource,
+            MakeCallback(&TimeSeriesAdaptor::TraceSinkDouble, adaptor));
+    }
+    else if (typeId == "ns3::BooleanProbe")
+    {
+        connected = probe->TraceConnectWithoutContext(
+            probeTraceSource,
+            MakeCallback(&TimeSeriesAdaptor::TraceSinkBoolean, adaptor));
+    }
+    else if (typeId == "ns3::Uinteger8Probe")
+    {
+        connected = probe->TraceConnectWithoutContext(
+            probeTraceSource,
+            MakeCallback(&TimeSeriesAdaptor::TraceSinkUinteger8, adaptor));
+    }
+    else if (typeId == "ns3::Uinteger16Probe")
+    {
+        connected = probe->TraceConnectWithoutContext(
+            probeTraceSource,
+            MakeCallback(&TimeSeriesAdaptor::TraceSinkUinteger16, adaptor));
+    }
+    else if (typeId == "ns3::Uinteger32Probe" || typeId == "ns3::PacketProbe" ||
+             typeId == "ns3::ApplicationPacketProbe" || typeId == "ns3::Ipv4PacketProbe" ||
+             typeId == "ns3::Ipv6PacketProbe")
+    {
+        connected = probe->TraceConnectWithoutContext(
+            probeTraceSource,
+            MakeCallback(&TimeSeriesAdaptor::TraceSinkUinteger32, adaptor));
+    }
+    else
+    {
+        NS_FATAL_ERROR("Unknown probe type " << typeId
+                                             << "; need to add support in the helper for this");
+    }
+    NS_ABORT_MSG_UNLESS(connected,
+                        "Cannot connect to the " << probeTraceSource << " trace source of a "
+                                                 << typeId);
+
+    // Connect the adaptor to the time window aggregator.
+    auto aggregator = m_aggregatorFactory.Create<TimeWindowAggregator>();
+    adaptor->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&TimeWindowAggregator::TraceSinkTimeSeries, aggregator));
+
+    // Connect the time window aggregator to the file aggregator.
+    auto fileAggregator =
+        CreateObject<FileAggregator>(outputFileNameWithoutExtension + ".txt", m_fileType);
+    std::ostringstream heading;
+    heading << "# start count sum min mean max";
+    for (const auto quantile : {"Quantile1", "Quantile2", "Quantile3"})
+    {
+        DoubleValue p;
+        aggregator->GetAttribute(quantile, p);
+        heading << " q" << p.Get();
+    }
+    fileAggregator->SetHeading(heading.str());
+    aggregator->TraceConnect("Output",
+                             probeName.str(),
+                             MakeCallback(&FileAggregator::Write9d, fileAggregator));
+
+    // Keep the objects in memory after this function ends.
+    m_probes.push_back(probe);
+    m_adaptors.push_back(adaptor);
+    m_aggregators.push_back(aggregator);
+    m_fileAggregators.push_back(fileAggregator);
+
+    return aggregator;
+}
+
+} // namespace ns3
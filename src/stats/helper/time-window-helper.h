@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TIME_WINDOW_HELPER_H
+#define TIME_WINDOW_HELPER_H
+
+#include "ns3/file-aggregator.h"
+#include "ns3/object-factory.h"
+#include "ns3/probe.h"
+#include "ns3/ptr.h"
+#include "ns3/time-series-adaptor.h"
+#include "ns3/time-window-aggregator.h"
+
+#include <string>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup aggregator
+ * \brief Helper class used to write per-window statistics of probed values to files.
+ *
+ * For every probed path, this helper creates a chain made of a probe, a
+ * TimeSeriesAdaptor, a TimeWindowAggregator and a FileAggregator, so that one line
+ * with the statistics of the probed values is written for every time window, instead
+ * of one line per value.
+ *
+ * The objects are owned by the helper, which must not be destroyed before the simulation
+ * ends.
+ */
+class TimeWindowHelper
+{
+  public:
+    /**
+     * \param fileType type of the files to write.
+     *
+     * Constructs a time window helper whose files have values printed as specified by
+     * fileType. The default file type is space-separated.
+     */
+    TimeWindowHelper(FileAggregator::FileType fileType = FileAggregator::SPACE_SEPARATED);
+
+    virtual ~TimeWindowHelper();
+
+    /**
+     * Set an attribute of the TimeWindowAggregator objects created by subsequent calls to
+     * WriteProbe (e.g., WindowSize).
+     *
+     * \param name the name of the attribute to set
+     * \param value the value of the attribute to set
+     */
+    void SetAggregatorAttribute(const std::string& name, const AttributeValue& value);
+
+    /**
+     * \param typeId the type ID for the probe used when it is created.
+     * \param path Config path for underlying trace source to be probed
+     * \param probeTraceSource the probe trace source to access.
+     * \param outputFileNameWithoutExtension name of output file to write with no extension
+     * \return the TimeWindowAggregator summarizing the probed values
+     *
+     * Creates a probe of the given type connected to the given path and writes the
+     * statistics of the values output by its probeTraceSource over every time window to
+     * a file named outputFileNameWithoutExtension plus ".txt". If the path contains
+     * wildcards, the values of all the matching trace sources are aggregated in the same
+     * windows (e.g., the bytes received by all the matching devices).
+     */
+    Ptr<TimeWindowAggregator> WriteProbe(const std::string& typeId,
+                                         const std::string& path,
+                                         const std::string& probeTraceSource,
+                                         const std::string& outputFileNameWithoutExtension);
+
+  private:
+    /// Used to create the probes.
+    ObjectFactory m_probeFactory;
+
+    /// Used to create the time window aggregators.
+    ObjectFactory m_aggregatorFactory;
+
+    /// Determines the kind of files written by the file aggregators.
+    FileAggregator::FileType m_fileType;
+
+    /// Number of probes that have been created.
+    uint32_t m_probeCount;
+
+    std::vector<Ptr<Probe>> m_probes;                     //!< the probes
+    std::vector<Ptr<TimeSeriesAdaptor>> m_adaptors;       //!< the time series adaptors
+    std::vector<Ptr<TimeWindowAggregator>> m_aggregators; //!< the time window aggregators
+    std::vector<Ptr<FileAggregator>> m_fileAggregators;   //!< the file aggregators
+};
+
+} // namespace ns3
+
+#endif // TIME_WINDOW_HELPER_H
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "quantile-estimator.h"
+
+#include "ns3/abort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace ns3
+{
+
+QuantileEstimator::QuantileEstimator(double p)
+    : m_p(p)
+{
+    NS_ABORT_MSG_IF(p < 0 || p > 1, "Invalid quantile probability " << p);
+    m_increment = {0, p / 2, p, (1 + p) / 2, 1};
+    Reset();
+}
+
+void
+QuantileEstimator::Reset()
+{
+    m_count = 0;
+}
+
+double
+QuantileEstimator::GetProbability() const
+{
+    return m_p;
+}
+
+uint64_t
+QuantileEstimator::GetCount() const
+{
+    return m_count;
+}
+
+void
+QuantileEstimator::Update(double x)
+{
+    if (m_count < BUFFER_SIZE)
+    {
+        m_buffer[m_count++] = x;
+        if (m_count == BUFFER_SIZE)
+        {
+            InitMarkers();
+        }
+        return;
+    }
+    ++m_count;
+
+    // find the cell containing the value, adjusting the extreme markers if needed
+    std::size_t k;
+    if (x < m_height[0])
+    {
+        m_height[0] = x;
+        k = 0;
+    }
+    else if (x >= m_height[4])
+    {
+        m_height[4] = x;
+        k = 3;
+    }
+    else
+    {
+        k = std::upper_bound(m_height.cbegin() + 1, m_height.cend(), x) - m_height.cbegin() - 1;
+    }
+
+    for (std::size_t i = k + 1; i < 5; ++i)
+    {
+        ++m_pos[i];
+    }
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        m_desired[i] += m_increment[i];
+    }
+
+    // adjust the heights of the middle markers if they are off their desired positions
+    for (std::size_t i = 1; i < 4; ++i)
+    {
+        const auto delta = m_desired[i] - m_pos[i];
+        if ((delta >= 1 && m_pos[i + 1] - m_pos[i] > 1) ||
+            (delta <= -1 && m_pos[i - 1] - m_pos[i] < -1))
+        {
+            const int64_t d = (delta > 0 ? 1 : -1);
+            const auto np = static_cast<double>(m_pos[i + 1]);
+            const auto n = static_cast<double>(m_pos[i]);
+            const auto nm = static_cast<double>(m_pos[i - 1]);
+            // piecewise-parabolic prediction
+            auto height = m_height[i] + d / (np - nm) *
+                                            ((n - nm + d) * (m_height[i + 1] - m_height[i]) /
+                                                 (np - n) +
+                                             (np - n - d) * (m_height[i] - m_height[i - 1]) /
+                                                 (n - nm));
+            if (height <= m_height[i - 1] || height >= m_height[i + 1])
+            {
+                // linear prediction
+                const std::size_t j = (d > 0 ? i + 1 : i - 1);
+                height = m_height[i] + d * (m_height[j] - m_height[i]) / (m_pos[j] - m_pos[i]);
+            }
+            m_height[i] = height;
+            m_pos[i] += d;
+        }
+    }
+}
+
+void
+QuantileEstimator::InitMarkers()
+{
+    std::sort(m_buffer.begin(), m_buffer.end());
+
+    // place the markers at the ranks closest to their desired positions, keeping them at
+    // distinct ranks
+    const auto n = static_cast<int64_t>(BUFFER_SIZE);
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        m_desired[i] = 1 + (n - 1) * m_increment[i];
+        m_pos[i] = std::llround(m_desired[i]);
+        if (i > 0)
+        {
+            m_pos[i] = std::clamp<int64_t>(m_pos[i], m_pos[i - 1] + 1, n - 4 + i);
+        }
+        m_height[i] = m_buffer[m_pos[i] - 1];
+    }
+}
+
+double
+QuantileEstimator::GetQuantile() const
+{
+    if (m_count == 0)
+    {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (m_count <= BUFFER_SIZE)
+    {
+        // exact quantile, interpolating between the closest ranks
+        auto values = m_buffer;
+        std::sort(values.begin(), values.begin() + m_count);
+        const auto rank = m_p * (m_count - 1);
+        const auto low = static_cast<std::size_t>(std::floor(rank));
+        const auto high = static_cast<std::size_t>(std::ceil(rank));
+        return values[low] + (rank - low) * (values[high] - values[low]);
+    }
+    return m_height[2];
+}
+
+} // namespace ns3
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef QUANTILE_ESTIMATOR_H
+#define QUANTILE_ESTIMATOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace ns3
+{
+
+/**
+ * \ingroup stats
+ *
+ * \brief Estimates a quantile of a sequence of values in constant memory
+ *
+ * The quantile is estimated by means of the P-square algorithm (R. Jain and I. Chlamtac,
+ * "The P2 algorithm for dynamic calculation of quantiles and histograms without storing
+ * observations", Communications of the ACM, 1985), which keeps five markers whose heights
+ * approximate the minimum, the p/2, p and (1+p)/2 quantiles and the maximum of the values
+ * observed so far. The markers are adjusted by means of a piecewise-parabolic
+ * interpolation every time a value is observed, hence the memory and the time required to
+ * process a value are constant. The first values are stored in a buffer of fixed size,
+ * so that the quantile is exact until the buffer is full (the P-square estimates are
+ * inaccurate with few values, especially for extreme quantiles); the markers are then
+ * initialized from the sorted buffer.
+ */
+class QuantileEstimator
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param p the probability of the quantile to estimate (between 0 and 1)
+     */
+    QuantileEstimator(double p = 0.5);
+
+    /**
+     * Reset the estimator, forgetting all the values observed so far.
+     */
+    void Reset();
+
+    /**
+     * Observe a value.
+     *
+     * \param x the observed value
+     */
+    void Update(double x);
+
+    /**
+     * \return the probability of the quantile being estimated
+     */
+    double GetProbability() const;
+
+    /**
+     * \return the number of values observed since the last reset
+     */
+    uint64_t GetCount() const;
+
+    /**
+     * \return the estimated quantile (NaN if no value has been observed)
+     */
+    double GetQuantile() const;
+
+    /// The number of values stored before switching to the P-square algorithm
+    static constexpr std::size_t BUFFER_SIZE = 64;
+
+  private:
+    /**
+     * Initialize the markers from the (full) buffer of observed values.
+     */
+    void InitMarkers();
+
+    double m_p;                               //!< the probability of the quantile
+    uint64_t m_count;                         //!< the number of observed values
+    std::array<double, 5> m_height;           //!< the heights of the markers
+    std::array<int64_t, 5> m_pos;             //!< the positions of the markers
+    std::array<double, 5> m_desired;          //!< the desired positions of the markers
+    std::array<double, 5> m_increment;        //!< the increments of the desired positions
+    std::array<double, BUFFER_SIZE> m_buffer; //!< the first observed values
+};
+
+} // namespace ns3
+
+#endif /* QUANTILE_ESTIMATOR_H */
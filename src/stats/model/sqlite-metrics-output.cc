@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "sqlite-metrics-output.h"
+
+#include "sqlite-output.h"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/log.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <set>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("SqliteMetricsOutput");
+
+NS_OBJECT_ENSURE_REGISTERED(SqliteMetricsOutput);
+
+/**
+ * \param name an SQL identifier
+ * \return the given identifier enclosed in double quotes
+ */
+static std::string
+Quote(const std::string& name)
+{
+    std::string quoted = "\"";
+    for (const auto c : name)
+    {
+        quoted += c;
+        if (c == '"')
+        {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+/**
+ * \param name an SQL identifier
+ * \return the given identifier converted to lower case, given that SQL identifiers are
+ *         case-insensitive
+ */
+static std::string
+ToLower(std::string name)
+{
+    std::transform(name.begin(), name.end(), name.begin(), [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    });
+    return name;
+}
+
+/**
+ * \param type the index of the type of the values of a column
+ * \return the SQL type of the column
+ */
+static std::string
+GetSqlType(std::size_t type)
+{
+    switch (type)
+    {
+    case 1:
+        return "INTEGER";
+    case 2:
+        return "REAL";
+    case 3:
+        return "TEXT";
+    default:
+        NS_ABORT_MSG("Unexpected column type " << type);
+    }
+    return "";
+}
+
+TypeId
+SqliteMetricsOutput::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::SqliteMetricsOutput")
+            .SetParent<Object>()
+            .SetGroupName("Stats")
+            .AddConstructor<SqliteMetricsOutput>()
+            .AddAttribute("FileName",
+                          "The name of the SQLite database file the metrics are written to.",
+                          StringValue("metrics.db"),
+                          MakeStringAccessor(&SqliteMetricsOutput::m_fileName),
+                          MakeStringChecker())
+            .AddAttribute("RunLabel",
+                          "The label stored in the run column of every table. If empty, the "
+                          "value of the RngRun global value is used.",
+                          StringValue(""),
+                          MakeStringAccessor(&SqliteMetricsOutput::m_runLabel),
+                          MakeStringChecker())
+            .AddAttribute("JournalInMemory",
+                          "Whether the SQLite journal is stored in memory, which speeds up "
+                          "writing but may lead to data losses in case of unexpected exits.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&SqliteMetricsOutput::m_journalInMemory),
+                          MakeBooleanChecker());
+    return tid;
+}
+
+SqliteMetricsOutput::SqliteMetricsOutput()
+{
+    NS_LOG_FUNCTION(this);
+    m_runs.name = "Runs";
+    m_stations.name = "Stations";
+    m_stations.keyColumn = "sta";
+    m_flows.name = "Flows";
+    m_flows.keyColumn = "flow";
+}
+
+SqliteMetricsOutput::~SqliteMetricsOutput()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+SqliteMetricsOutput::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    // the event holds a reference to this object, so that the metrics are written even if
+    // the user does not keep a pointer to this object
+    Simulator::ScheduleDestroy(&SqliteMetricsOutput::Write, Ptr<SqliteMetricsOutput>(this));
+    Object::NotifyConstructionCompleted();
+}
+
+void
+SqliteMetricsOutput::SetValue(Table& table,
+                              uint32_t key,
+                              const std::string& column,
+                              Value&& value)
+{
+    NS_LOG_FUNCTION(this << table.name << key << column);
+
+    auto [rowIt, newRow] = table.rows.try_emplace(key, table.keys.size());
+    if (newRow)
+    {
+        table.keys.push_back(key);
+        for (auto& col : table.columns)
+        {
+            col.values.emplace_back();
+        }
+    }
+
+    auto [colIt, newCol] = table.columnIndex.try_emplace(column, table.columns.size());
+    if (newCol)
+    {
+        NS_ABORT_MSG_IF(ToLower(column) == "run" || ToLower(column) == ToLower(table.keyColumn),
+                        "Column name " << column << " is reserved in table " << table.name);
+        table.columns.push_back({column, value.index(), {}});
+        table.columns.back().values.resize(table.keys.size());
+    }
+
+    auto& col = table.columns[colIt->second];
+    NS_ABORT_MSG_IF(col.type != value.index(),
+                    "Column " << column << " of table " << table.name
+                              << " has a different type than the given value");
+    col.values[rowIt->second] = std::move(value);
+}
+
+void
+SqliteMetricsOutput::Write()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (m_runs.keys.empty() && m_stations.keys.empty() && m_flows.keys.empty())
+    {
+        return;
+    }
+
+    auto run = m_runLabel.empty() ? std::to_string(RngSeedManager::GetRun()) : m_runLabel;
+
+    auto db = Create<SQLiteOutput>(m_fileName);
+    if (m_journalInMemory)
+    {
+        db->SetJournalInMemory();
+    }
+
+    // acquire the write lock upfront, so that concurrent runs writing to the same database
+    // do not deadlock when upgrading their locks
+    bool res = db->SpinExec("BEGIN IMMEDIATE");
+    NS_ABORT_MSG_UNLESS(res, "Failed to begin the transaction on " << m_fileName);
+
+    for (auto table : {&m_runs, &m_stations, &m_flows})
+    {
+        WriteTable(db, *table, run);
+        table->keys.clear();
+        table->rows.clear();
+        table->columns.clear();
+        table->columnIndex.clear();
+    }
+
+    res = db->SpinExec("COMMIT");
+    NS_ABORT_MSG_UNLESS(res, "Failed to commit the transaction on " << m_fileName);
+}
+
+void
+SqliteMetricsOutput::WriteTable(const Ptr<SQLiteOutput>& db,
+                                const Table& table,
+                                const std::string& run)
+{
+    NS_LOG_FUNCTION(this << db << table.name << run);
+
+    if (table.keys.empty())
+    {
+        return;
+    }
+
+    std::ostringstream cmd;
+    cmd << "CREATE TABLE IF NOT EXISTS " << Quote(table.name) << " (run TEXT";
+    if (!table.keyColumn.empty())
+    {
+        cmd << ", " << table.keyColumn << " INTEGER";
+    }
+    for (const auto& col : table.columns)
+    {
+        cmd << ", " << Quote(col.name) << " " << GetSqlType(col.type);
+    }
+    cmd << ")";
+    bool res = db->SpinExec(cmd.str());
+    NS_ABORT_MSG_UNLESS(res, "Failed to create table " << table.name);
+
+    // the table may have been created by a run that set different metrics
+    sqlite3_stmt* stmt;
+    res = db->SpinPrepare(&stmt, "PRAGMA table_info(" + Quote(table.name) + ")");
+    NS_ABORT_MSG_UNLESS(res, "Failed to get the columns of table " << table.name);
+    std::set<std::string> existing;
+    while (SQLiteOutput::SpinStep(stmt) == SQLITE_ROW)
+    {
+        existing.emplace(ToLower(reinterpret_cast<const char*>(sqlite3_column_text(stmt, 1))));
+    }
+    SQLiteOutput::SpinFinalize(stmt);
+
+    for (const auto& col : table.columns)
+    {
+        if (existing.count(ToLower(col.name)) == 0)
+        {
+            res = db->SpinExec("ALTER TABLE " + Quote(table.name) + " ADD COLUMN " +
+                               Quote(col.name) + " " + GetSqlType(col.type));
+            NS_ABORT_MSG_UNLESS(res, "Failed to add column " << col.name << " to " << table.name);
+        }
+    }
+
+    cmd.str("");
+    cmd << "INSERT INTO " << Quote(table.name) << " (run";
+    std::string params = "?";
+    if (!table.keyColumn.empty())
+    {
+        cmd << ", " << table.keyColumn;
+        params += ", ?";
+    }
+    for (const auto& col : table.columns)
+    {
+        cmd << ", " << Quote(col.name);
+        params += ", ?";
+    }
+    cmd << ") VALUES (" << params << ")";
+    res = db->SpinPrepare(&stmt, cmd.str());
+    NS_ABORT_MSG_UNLESS(res, "Failed to prepare the insertion into " << table.name);
+
+    db->Bind(stmt, 1, run);
+    for (std::size_t row = 0; row < table.keys.size(); ++row)
+    {
+        SQLiteOutput::SpinReset(stmt);
+        int pos = 2;
+        if (!table.keyColumn.empty())
+        {
+            sqlite3_bind_int64(stmt, pos++, table.keys[row]);
+        }
+        for (const auto& col : table.columns)
+        {
+            const auto& value = col.values[row];
+            if (const auto intValue = std::get_if<int64_t>(&value))
+            {
+                sqlite3_bind_int64(stmt, pos, *intValue);
+            }
+            else if (const auto doubleValue = std::get_if<double>(&value))
+            {
+                db->Bind(stmt, pos, *doubleValue);
+            }
+            else if (const auto stringValue = std::get_if<std::string>(&value))
+            {
+                db->Bind(stmt, pos, *stringValue);
+            }
+            else
+            {
+                sqlite3_bind_null(stmt, pos);
+            }
+            ++pos;
+        }
+        NS_ABORT_MSG_UNLESS(SQLiteOutput::SpinStep(stmt) == SQLITE_DONE,
+                            "Failed to insert a row into " << table.name);
+    }
+    SQLiteOutput::SpinFinalize(stmt);
+}
+
+} // namespace ns3
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef SQLITE_METRICS_OUTPUT_H
+#define SQLITE_METRICS_OUTPUT_H
+
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace ns3
+{
+
+class SQLiteOutput;
+
+/**
+ * \ingroup dataoutput
+ * \class SqliteMetricsOutput
+ * \brief Collects the metrics of a simulation run in typed tables and writes them to an
+ * SQLite database in a single transaction
+ *
+ * The metrics are organized in three tables: the Runs table, which has one row per
+ * simulation run, the Stations table, which has one row per station (identified by an
+ * integer set by the user, e.g., the node ID or the AID) and the Flows table, which has
+ * one row per flow (identified by an integer set by the user, e.g., the FlowMonitor flow
+ * ID). Every table has a "run" column storing the run label; the Stations and Flows tables
+ * also have a "sta" and a "flow" column, respectively, storing the row identifier.
+ *
+ * The other columns are created the first time a value is set for them. The type of a
+ * column (INTEGER, REAL or TEXT) is determined by the type of the values it is set to:
+ * integers and booleans are stored as INTEGER, floating point values and Time values
+ * (in seconds) as REAL and strings as TEXT. Cells that are never set are NULL.
+ *
+ * The values are buffered in memory column by column while the simulation runs and are
+ * written when Simulator::Destroy is called (or when Write is called explicitly) by
+ * means of one prepared statement per table, within a single transaction. Tables (and
+ * columns) that do not exist in the database are created, hence multiple runs (possibly
+ * setting different metrics) can append their results to the same database file.
+ */
+class SqliteMetricsOutput : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * \return The TypeId.
+     */
+    static TypeId GetTypeId();
+
+    SqliteMetricsOutput();
+    ~SqliteMetricsOutput() override;
+
+    /**
+     * Set the value of a metric of this run.
+     *
+     * \tparam T the type of the value (integral, floating point, Time or string)
+     * \param column the name of the metric
+     * \param value the value of the metric
+     */
+    template <typename T>
+    void SetRunValue(const std::string& column, const T& value);
+
+    /**
+     * Set the value of a metric of the given station.
+     *
+     * \tparam T the type of the value (integral, floating point, Time or string)
+     * \param sta the identifier of the station
+     * \param column the name of the metric
+     * \param value the value of the metric
+     */
+    template <typename T>
+    void SetStaValue(uint32_t sta, const std::string& column, const T& value);
+
+    /**
+     * Set the value of a metric of the given flow.
+     *
+     * \tparam T the type of the value (integral, floating point, Time or string)
+     * \param flow the identifier of the flow
+     * \param column the name of the metric
+     * \param value the value of the metric
+     */
+    template <typename T>
+    void SetFlowValue(uint32_t flow, const std::string& column, const T& value);
+
+    /**
+     * Write the buffered metrics to the database in a single transaction and clear the
+     * buffers. This function is automatically called when Simulator::Destroy is called.
+     */
+    void Write();
+
+  protected:
+    void NotifyConstructionCompleted() override;
+
+  private:
+    /// The value of a cell (std::monostate is used for NULL cells)
+    using Value = std::variant<std::monostate, int64_t, double, std::string>;
+
+    /// A column of a table
+    struct Column
+    {
+        std::string name;          //!< the name of the column
+        std::size_t type{0};       //!< the index of the type of the values in a Value
+        std::vector<Value> values; //!< the values of the column, one per row
+    };
+
+    /// A table
+    struct Table
+    {
+        std::string name;                               //!< the name of the table
+        std::string keyColumn;                          //!< the name of the key column, if any
+        std::vector<uint32_t> keys;                     //!< the key of every row
+        std::map<uint32_t, std::size_t> rows;           //!< the row index for every key
+        std::vector<Column> columns;                    //!< the columns of the table
+        std::map<std::string, std::size_t> columnIndex; //!< the column index for every name
+    };
+
+    /**
+     * \tparam T the type of the given value
+     * \param value the given value
+     * \return the cell value corresponding to the given value
+     */
+    template <typename T>
+    static Value ToValue(const T& value);
+
+    /**
+     * Set the value of a cell of the given table, adding a row and/or a column if needed.
+     *
+     * \param table the given table
+     * \param key the key of the row
+     * \param column the name of the column
+     * \param value the value of the cell
+     */
+    void SetValue(Table& table, uint32_t key, const std::string& column, Value&& value);
+
+    /**
+     * Create the given table in the database (or add the missing columns to it) and insert
+     * the buffered rows.
+     *
+     * \param db the database
+     * \param table the table to write
+     * \param run the run label
+     */
+    void WriteTable(const Ptr<SQLiteOutput>& db, const Table& table, const std::string& run);
+
+    std::string m_fileName; //!< the name of the database file
+    std::string m_runLabel; //!< the label identifying this run
+    bool m_journalInMemory; //!< whether the SQLite journal is stored in memory
+    Table m_runs;           //!< the Runs table
+    Table m_stations;       //!< the Stations table
+    Table m_flows;          //!< the Flows table
+};
+
+template <typename T>
+SqliteMetricsOutput::Value
+SqliteMetricsOutput::ToValue(const T& value)
+{
+    if constexpr (std::is_integral_v<T>)
+    {
+        return static_cast<int64_t>(value);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        return static_cast<double>(value);
+    }
+    else if constexpr (std::is_same_v<T, Time>)
+    {
+        return value.GetSeconds();
+    }
+    else
+    {
+        return std::string(value);
+    }
+}
+
+template <typename T>
+void
+SqliteMetricsOutput::SetRunValue(const std::string& column, const T& value)
+{
+    SetValue(m_runs, 0, column, ToValue(value));
+}
+
+template <typename T>
+void
+SqliteMetricsOutput::SetStaValue(uint32_t sta, const std::string& column, const T& value)
+{
+    SetValue(m_stations, sta, column, ToValue(value));
+}
+
+template <typename T>
+void
+SqliteMetricsOutput::SetFlowValue(uint32_t flow, const std::string& column, const T& value)
+{
+    SetValue(m_flows, flow, column, ToValue(value));
+}
+
+} // namespace ns3
+
+#endif /* SQLITE_METRICS_OUTPUT_H */
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "time-window-aggregator.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TimeWindowAggregator");
+
+NS_OBJECT_ENSURE_REGISTERED(TimeWindowAggregator);
+
+TypeId
+TimeWindowAggregator::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TimeWindowAggregator")
+            .SetParent<DataCollectionObject>()
+            .SetGroupName("Stats")
+            .AddConstructor<TimeWindowAggregator>()
+            .AddAttribute("WindowSize",
+                          "The duration of the time windows.",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&TimeWindowAggregator::m_windowSize),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("Quantile1",
+                          "The probability of the first quantile estimated in every window.",
+                          DoubleValue(0.5),
+                          MakeDoubleAccessor(&TimeWindowAggregator::m_quantile1),
+                          MakeDoubleChecker<double>(0, 1))
+            .AddAttribute("Quantile2",
+                          "The probability of the second quantile estimated in every window.",
+                          DoubleValue(0.9),
+                          MakeDoubleAccessor(&TimeWindowAggregator::m_quantile2),
+                          MakeDoubleChecker<double>(0, 1))
+            .AddAttribute("Quantile3",
+                          "The probability of the third quantile estimated in every window.",
+                          DoubleValue(0.99),
+                          MakeDoubleAccessor(&TimeWindowAggregator::m_quantile3),
+                          MakeDoubleChecker<double>(0, 1))
+            .AddTraceSource("Output",
+                            "The start time of a window versus the count, sum, minimum, "
+                            "mean, maximum and quantiles of the values in the window",
+                            MakeTraceSourceAccessor(&TimeWindowAggregator::m_output),
+                            "ns3::TimeWindowAggregator::OutputTracedCallback");
+    return tid;
+}
+
+TimeWindowAggregator::TimeWindowAggregator()
+    : m_window(0),
+      m_count(0),
+      m_sum(0),
+      m_min(std::numeric_limits<double>::infinity()),
+      m_max(-std::numeric_limits<double>::infinity())
+{
+    NS_LOG_FUNCTION(this);
+}
+
+TimeWindowAggregator::~TimeWindowAggregator()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+TimeWindowAggregator::NotifyConstructionCompleted()
+{
+    NS_LOG_FUNCTION(this);
+    ResetEstimators();
+    // the event holds a reference to this object, so that the last window is output even
+    // if the user does not keep a pointer to this object
+    Simulator::ScheduleDestroy(&TimeWindowAggregator::Flush, Ptr<TimeWindowAggregator>(this));
+    DataCollectionObject::NotifyConstructionCompleted();
+}
+
+void
+TimeWindowAggregator::TraceSinkTimeSeries(double now, double value)
+{
+    NS_LOG_FUNCTION(this << now << value);
+
+    // Don't do anything if the aggregator is not enabled.
+    if (!IsEnabled())
+    {
+        NS_LOG_DEBUG("Time window aggregator not enabled");
+        return;
+    }
+
+    // use the integer time to identify the window, which is not affected by rounding errors
+    AdvanceTo(Simulator::Now().GetTimeStep() / m_windowSize.GetTimeStep());
+
+    ++m_count;
+    m_sum += value;
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+    for (auto& estimator : m_estimators)
+    {
+        estimator.Update(value);
+    }
+}
+
+void
+TimeWindowAggregator::Flush()
+{
+    NS_LOG_FUNCTION(this);
+
+    const auto now = Simulator::Now().GetTimeStep();
+    const auto window = now / m_windowSize.GetTimeStep();
+    AdvanceTo(window);
+    if (m_window == window && (m_count > 0 || now > window * m_windowSize.GetTimeStep()))
+    {
+        EndWindow();
+    }
+}
+
+void
+TimeWindowAggregator::AdvanceTo(int64_t window)
+{
+    NS_LOG_FUNCTION(this << window);
+    while (m_window < window)
+    {
+        EndWindow();
+    }
+}
+
+void
+TimeWindowAggregator::EndWindow()
+{
+    NS_LOG_FUNCTION(this);
+
+    const auto start = (m_windowSize * m_window).GetSeconds();
+    if (m_count > 0)
+    {
+        m_output(start,
+                 static_cast<double>(m_count),
+                 m_sum,
+                 m_min,
+                 m_sum / static_cast<double>(m_count),
+                 m_max,
+                 m_estimators[0].GetQuantile(),
+                 m_estimators[1].GetQuantile(),
+                 m_estimators[2].GetQuantile());
+    }
+    else
+    {
+        const auto nan = std::numeric_limits<double>::quiet_NaN();
+        m_output(start, 0, 0, nan, nan, nan, nan, nan, nan);
+    }
+
+    ++m_window;
+    m_count = 0;
+    m_sum = 0;
+    m_min = std::numeric_limits<double>::infinity();
+    m_max = -std::numeric_limits<double>::infinity();
+    ResetEstimators();
+}
+
+void
+TimeWindowAggregator::ResetEstimators()
+{
+    NS_LOG_FUNCTION(this);
+    m_estimators = {QuantileEstimator(m_quantile1),
+                    QuantileEstimator(m_quantile2),
+                    QuantileEstimator(m_quantile3)};
+}
+
+} // namespace ns3
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TIME_WINDOW_AGGREGATOR_H
+#define TIME_WINDOW_AGGREGATOR_H
+
+#include "data-collection-object.h"
+#include "quantile-estimator.h"
+
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+
+#include <array>
+
+namespace ns3
+{
+
+/**
+ * \ingroup aggregator
+ *
+ * \brief Summarizes the values of a time series over consecutive time windows
+ *
+ * The TimeWindowAggregator receives the (time, value) pairs emitted by a
+ * TimeSeriesAdaptor (which is in turn fed by a Probe) and divides the simulation time in
+ * consecutive windows of the duration set by the WindowSize attribute, starting at time
+ * zero. For every window, it computes the number of values, their sum (i.e., the number
+ * of bytes, if the probe outputs packet sizes), their minimum, mean and maximum and an
+ * estimate of three quantiles (set by the Quantile1, Quantile2 and Quantile3 attributes).
+ * The quantiles are estimated by QuantileEstimator objects, hence the memory required by
+ * the aggregator does not depend on the number of values.
+ *
+ * When a window ends, the aggregator fires the Output trace source with the start time
+ * of the window (in seconds) and the nine statistics, which can be connected, e.g., to the
+ * FileAggregator::Write9d trace sink to obtain one line per window. A window is output
+ * when the first value following the window is received; windows without values are
+ * output with a zero count and sum and NaN statistics. The window that is in progress
+ * when Simulator::Destroy is called is output at that time, hence the rows cover the
+ * whole simulation.
+ */
+class TimeWindowAggregator : public DataCollectionObject
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TimeWindowAggregator();
+    ~TimeWindowAggregator() override;
+
+    /**
+     * \brief Trace sink for receiving data from a TimeSeriesAdaptor.
+     * \param now the current time, in seconds.
+     * \param value the value.
+     *
+     * This method serves as a trace sink to the Output trace source of a
+     * TimeSeriesAdaptor. The value is accounted in the window containing the current
+     * simulation time.
+     */
+    void TraceSinkTimeSeries(double now, double value);
+
+    /**
+     * Output all the windows up to the one containing the current time (unless such a
+     * window starts at the current time and has no value). This method is automatically
+     * called when Simulator::Destroy is called.
+     */
+    void Flush();
+
+    /**
+     * TracedCallback signature for output trace.
+     *
+     * \param [in] start The start time of the window, in seconds.
+     * \param [in] count The number of values in the window.
+     * \param [in] sum The sum of the values in the window.
+     * \param [in] min The minimum value in the window.
+     * \param [in] mean The mean value in the window.
+     * \param [in] max The maximum value in the window.
+     * \param [in] q1 The estimated Quantile1 quantile of the values in the window.
+     * \param [in] q2 The estimated Quantile2 quantile of the values in the window.
+     * \param [in] q3 The estimated Quantile3 quantile of the values in the window.
+     */
+    typedef void (*OutputTracedCallback)(const double start,
+                                         const double count,
+                                         const double sum,
+                                         const double min,
+                                         const double mean,
+                                         const double max,
+                                         const double q1,
+                                         const double q2,
+                                         const double q3);
+
+  protected:
+    void NotifyConstructionCompleted() override;
+
+  private:
+    /**
+     * Output the statistics of the current window and start the next window.
+     */
+    void EndWindow();
+
+    /**
+     * Output all the windows preceding the given window.
+     *
+     * \param window the index of the given window
+     */
+    void AdvanceTo(int64_t window);
+
+    /**
+     * Reset the quantile estimators, using the probabilities set by the attributes.
+     */
+    void ResetEstimators();
+
+    Time m_windowSize;                             //!< the duration of a window
+    double m_quantile1;                            //!< the probability of the first quantile
+    double m_quantile2;                            //!< the probability of the second quantile
+    double m_quantile3;                            //!< the probability of the third quantile
+    int64_t m_window;                              //!< the index of the current window
+    uint64_t m_count;                              //!< the number of values in the window
+    double m_sum;                                  //!< the sum of the values in the window
+    double m_min;                                  //!< the minimum value in the window
+    double m_max;                                  //!< the maximum value in the window
+    std::array<QuantileEstimator, 3> m_estimators; //!< the quantile estimators
+
+    /// output trace
+    TracedCallback<double, double, double, double, double, double, double, double, double>
+        m_output;
+};
+
+} // namespace ns3
+
+#endif // TIME_WINDOW_AGGREGATOR_H
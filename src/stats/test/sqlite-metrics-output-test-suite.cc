@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/simulator.h"
+#include "ns3/sqlite-metrics-output.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+
+#include <sqlite3.h>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief SqliteMetricsOutput test case
+ *
+ * Two runs set the metrics of the run, of some stations and of some flows and write them
+ * to the same database when the simulator is destroyed. This test verifies that the
+ * tables contain one row per run, station and flow, that the columns have the type of the
+ * values they are set to, that the cells that are not set are NULL and that the metrics
+ * only set by the second run are added as new columns.
+ */
+class SqliteMetricsOutputTestCase : public TestCase
+{
+  public:
+    SqliteMetricsOutputTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Execute a query returning a single row and return the columns of the row as text.
+     *
+     * \param query the query
+     * \return the columns of the row returned by the query
+     */
+    std::vector<std::string> Query(const std::string& query);
+
+    std::string m_fileName; //!< the name of the database file
+};
+
+SqliteMetricsOutputTestCase::SqliteMetricsOutputTestCase()
+    : TestCase("Check the metrics written by the SqliteMetricsOutput")
+{
+}
+
+std::vector<std::string>
+SqliteMetricsOutputTestCase::Query(const std::string& query)
+{
+    std::vector<std::string> result;
+    sqlite3* db;
+    NS_TEST_EXPECT_MSG_EQ(sqlite3_open(m_fileName.c_str(), &db), SQLITE_OK, "Cannot open DB");
+    sqlite3_stmt* stmt;
+    NS_TEST_EXPECT_MSG_EQ(sqlite3_prepare_v2(db, query.c_str(), -1, &stmt, nullptr),
+                          SQLITE_OK,
+                          "Cannot prepare " << query);
+    if (stmt && sqlite3_step(stmt) == SQLITE_ROW)
+    {
+        for (int i = 0; i < sqlite3_column_count(stmt); ++i)
+        {
+            auto text = sqlite3_column_text(stmt, i);
+            result.emplace_back(text ? reinterpret_cast<const char*>(text) : "NULL");
+        }
+    }
+    sqlite3_finalize(stmt);
+    sqlite3_close(db);
+    return result;
+}
+
+void
+SqliteMetricsOutputTestCase::DoRun()
+{
+    m_fileName = CreateTempDirFilename("metrics.db");
+
+    // first run
+    auto metrics = CreateObjectWithAttributes<SqliteMetricsOutput>("FileName",
+                                                                   StringValue(m_fileName),
+                                                                   "RunLabel",
+                                                                   StringValue("first"));
+    metrics->SetRunValue("nStations", 3);
+    metrics->SetRunValue("scenario", "twt");
+    metrics->SetRunValue("duration", Seconds(10));
+    for (uint32_t sta = 1; sta <= 3; ++sta)
+    {
+        metrics->SetStaValue(sta, "throughputMbps", 1.5 * sta);
+        metrics->SetStaValue(sta, "txPackets", 100 * sta);
+    }
+    metrics->SetStaValue(2, "awake", true);
+    metrics->SetFlowValue(7, "lostPackets", 4);
+    metrics = nullptr; // the metrics are written even if no pointer is kept
+
+    NS_TEST_EXPECT_MSG_EQ(Query("SELECT count(*) FROM sqlite_master").at(0),
+                          "0",
+                          "Metrics should not be written before Simulator::Destroy");
+    Simulator::Destroy();
+
+    auto row = Query("SELECT run, nStations, typeof(nStations), scenario, duration FROM Runs");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 5, "Unexpected Runs row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "first", "Unexpected run label");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "3", "Unexpected number of stations");
+    NS_TEST_EXPECT_MSG_EQ(row[2], "integer", "Unexpected type of an integer column");
+    NS_TEST_EXPECT_MSG_EQ(row[3], "twt", "Unexpected text value");
+    NS_TEST_EXPECT_MSG_EQ(row[4], "10.0", "Unexpected Time value");
+
+    row = Query("SELECT count(*), sum(throughputMbps), typeof(throughputMbps), sum(txPackets), "
+                "count(awake) FROM Stations");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 5, "Unexpected Stations row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "3", "Unexpected number of stations");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "9.0", "Unexpected sum of the throughput");
+    NS_TEST_EXPECT_MSG_EQ(row[2], "real", "Unexpected type of a floating point column");
+    NS_TEST_EXPECT_MSG_EQ(row[3], "600", "Unexpected sum of the transmitted packets");
+    NS_TEST_EXPECT_MSG_EQ(row[4], "1", "Only one station should have a non-NULL value");
+
+    row = Query("SELECT awake FROM Stations WHERE sta = 2");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 1, "Unexpected Stations row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "1", "Unexpected boolean value");
+
+    row = Query("SELECT run, flow, lostPackets FROM Flows");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 3, "Unexpected Flows row");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "7", "Unexpected flow identifier");
+    NS_TEST_EXPECT_MSG_EQ(row[2], "4", "Unexpected number of lost packets");
+
+    // second run, setting a metric that the first run did not set
+    metrics = CreateObjectWithAttributes<SqliteMetricsOutput>("FileName",
+                                                              StringValue(m_fileName),
+                                                              "RunLabel",
+                                                              StringValue("second"));
+    metrics->SetStaValue(1, "throughputMbps", 2.0);
+    metrics->SetStaValue(1, "mode", "active");
+    metrics->SetStaValue(1, "throughputMbps", 3.0);
+    // SQL identifiers are case-insensitive, hence this is the existing lostPackets column
+    metrics->SetFlowValue(7, "LostPackets", 5);
+    Simulator::Destroy();
+
+    row = Query("SELECT count(*), count(mode) FROM Stations");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 2, "Unexpected Stations row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "4", "Unexpected number of stations");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "1", "Only one station should have a non-NULL mode");
+
+    row = Query("SELECT throughputMbps, mode FROM Stations WHERE run = 'second'");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 2, "Unexpected Stations row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "3.0", "The last value set should be written");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "active", "Unexpected text value");
+
+    row = Query("SELECT count(*), sum(lostPackets) FROM Flows");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 2, "Unexpected Flows row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "2", "Unexpected number of flows");
+    NS_TEST_EXPECT_MSG_EQ(row[1], "9", "Unexpected sum of the lost packets");
+
+    row = Query("SELECT count(*) FROM Runs");
+    NS_TEST_ASSERT_MSG_EQ(row.size(), 1, "Unexpected Runs row");
+    NS_TEST_EXPECT_MSG_EQ(row[0], "1", "The second run did not set any run metric");
+}
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief SqliteMetricsOutput TestSuite
+ */
+class SqliteMetricsOutputTestSuite : public TestSuite
+{
+  public:
+    SqliteMetricsOutputTestSuite();
+};
+
+SqliteMetricsOutputTestSuite::SqliteMetricsOutputTestSuite()
+    : TestSuite("sqlite-metrics-output", UNIT)
+{
+    AddTestCase(new SqliteMetricsOutputTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static SqliteMetricsOutputTestSuite g_sqliteMetricsOutputTestSuite;
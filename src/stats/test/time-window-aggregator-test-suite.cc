@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/double-probe.h"
+#include "ns3/quantile-estimator.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/time-series-adaptor.h"
+#include "ns3/time-window-aggregator.h"
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief QuantileEstimator test case
+ *
+ * This test verifies that the quantiles are exact while the first values are buffered
+ * and that the quantiles of uniformly distributed values are estimated accurately.
+ */
+class QuantileEstimatorTestCase : public TestCase
+{
+  public:
+    QuantileEstimatorTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+QuantileEstimatorTestCase::QuantileEstimatorTestCase()
+    : TestCase("Check the quantiles estimated by the QuantileEstimator")
+{
+}
+
+void
+QuantileEstimatorTestCase::DoRun()
+{
+    QuantileEstimator median;
+    NS_TEST_EXPECT_MSG_EQ(std::isnan(median.GetQuantile()), true, "Expected NaN with no value");
+    for (const auto x : {3.0, 1.0, 2.0})
+    {
+        median.Update(x);
+    }
+    NS_TEST_EXPECT_MSG_EQ(median.GetQuantile(), 2, "Unexpected median of three values");
+    median.Update(4);
+    NS_TEST_EXPECT_MSG_EQ(median.GetQuantile(), 2.5, "Unexpected median of four values");
+    median.Reset();
+    NS_TEST_EXPECT_MSG_EQ(median.GetCount(), 0, "Unexpected count after reset");
+
+    auto rng = CreateObject<UniformRandomVariable>();
+    rng->SetStream(1);
+    std::array<QuantileEstimator, 3> estimators{QuantileEstimator(0.5),
+                                                QuantileEstimator(0.9),
+                                                QuantileEstimator(0.99)};
+    for (uint32_t i = 0; i < 100000; ++i)
+    {
+        const auto x = rng->GetValue(0, 100);
+        for (auto& estimator : estimators)
+        {
+            estimator.Update(x);
+        }
+    }
+    for (const auto& estimator : estimators)
+    {
+        NS_TEST_EXPECT_MSG_EQ(estimator.GetCount(), 100000, "Unexpected count");
+        NS_TEST_EXPECT_MSG_EQ_TOL(estimator.GetQuantile(),
+                                  100 * estimator.GetProbability(),
+                                  1,
+                                  "Unexpected quantile " << estimator.GetProbability());
+    }
+}
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief TimeWindowAggregator test case
+ *
+ * A DoubleProbe feeds a TimeWindowAggregator through a TimeSeriesAdaptor. This test
+ * verifies that the aggregator outputs one row per window, including the windows without
+ * values and the window in progress when the simulator is destroyed, and that the rows
+ * carry the expected statistics.
+ */
+class TimeWindowAggregatorTestCase : public TestCase
+{
+  public:
+    TimeWindowAggregatorTestCase();
+
+  private:
+    void DoRun() override;
+
+    /// A row output by the aggregator
+    using Row = std::array<double, 9>;
+    std::vector<Row> m_rows; //!< the rows output by the aggregator
+};
+
+TimeWindowAggregatorTestCase::TimeWindowAggregatorTestCase()
+    : TestCase("Check the rows output by the TimeWindowAggregator")
+{
+}
+
+void
+TimeWindowAggregatorTestCase::DoRun()
+{
+    auto probe = CreateObject<DoubleProbe>();
+    auto adaptor = CreateObject<TimeSeriesAdaptor>();
+    auto aggregator = CreateObject<TimeWindowAggregator>();
+    aggregator->SetAttribute("WindowSize", TimeValue(MilliSeconds(100)));
+
+    probe->TraceConnectWithoutContext("Output",
+                                      MakeCallback(&TimeSeriesAdaptor::TraceSinkDouble, adaptor));
+    adaptor->TraceConnectWithoutContext(
+        "Output",
+        MakeCallback(&TimeWindowAggregator::TraceSinkTimeSeries, aggregator));
+    aggregator->TraceConnectWithoutContext(
+        "Output",
+        Callback<void, double, double, double, double, double, double, double, double, double>(
+            [this](double start,
+                   double count,
+                   double sum,
+                   double min,
+                   double mean,
+                   double max,
+                   double q1,
+                   double q2,
+                   double q3) {
+                m_rows.push_back({start, count, sum, min, mean, max, q1, q2, q3});
+            }));
+
+    // three values in the first window, none in the second one, one in the third one
+    const std::vector<std::pair<int64_t, double>> values{{10, 10}, {50, 30}, {99, 20}, {250, 5}};
+    for (const auto& [ms, value] : values)
+    {
+        Simulator::Schedule(MilliSeconds(ms), &DoubleProbe::SetValue, probe, value);
+    }
+
+    Simulator::Stop(MilliSeconds(320));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_rows.size(), 2, "Only the windows preceding the last value");
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(m_rows.size(), 4, "Unexpected number of windows");
+    for (std::size_t i = 0; i < m_rows.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_rows[i][0], 0.1 * i, 1e-9, "Unexpected window start");
+    }
+    const Row first{0, 3, 60, 10, 20, 30, 20, 28, 29.8};
+    for (std::size_t j = 1; j < first.size(); ++j)
+    {
+        NS_TEST_EXPECT_MSG_EQ_TOL(m_rows[0][j], first[j], 1e-9, "Unexpected column " << j);
+    }
+    for (const auto i : {1, 3})
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_rows[i][1], 0, "Unexpected count in empty window " << i);
+        NS_TEST_EXPECT_MSG_EQ(m_rows[i][2], 0, "Unexpected sum in empty window " << i);
+        NS_TEST_EXPECT_MSG_EQ(std::isnan(m_rows[i][4]), true, "Expected NaN mean " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ(m_rows[2][1], 1, "Unexpected count in the third window");
+    NS_TEST_EXPECT_MSG_EQ(m_rows[2][5], 5, "Unexpected maximum in the third window");
+}
+
+/**
+ * \ingroup stats-tests
+ *
+ * \brief TimeWindowAggregator TestSuite
+ */
+class TimeWindowAggregatorTestSuite : public TestSuite
+{
+  public:
+    TimeWindowAggregatorTestSuite();
+};
+
+TimeWindowAggregatorTestSuite::TimeWindowAggregatorTestSuite()
+    : TestSuite("time-window-aggregator", UNIT)
+{
+    AddTestCase(new QuantileEstimatorTestCase, TestCase::QUICK);
+    AddTestCase(new TimeWindowAggregatorTestCase, TestCase::QUICK);
+}
+
+/// Static variable for test initialization
+static TimeWindowAggregatorTestSuite g_timeWindowAggregatorTestSuite;
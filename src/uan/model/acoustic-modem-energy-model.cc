@@ -248,6 +248,9 @@ AcousticModemEnergyModel::ChangeState(int newState)
     {
         // update current state & last update time stamp
         SetMicroModemState(newState);
+
+        // notify energy source of the new current draw
+        m_source->HandleCurrentChanged();
     }
 
     // some debug message
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "wifi-time-window-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/application-container.h"
+#include "ns3/log.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node.h"
+
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("WifiTimeWindowHelper");
+
+WifiTimeWindowHelper::WifiTimeWindowHelper()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+WifiTimeWindowHelper::SetAggregatorAttribute(const std::string& name,
+                                             const AttributeValue& value)
+{
+    m_helper.SetAggregatorAttribute(name, value);
+}
+
+void
+WifiTimeWindowHelper::EnableMac(const std::string& prefix,
+                                Ptr<NetDevice> nd,
+                                const std::string& traceSource)
+{
+    NS_LOG_FUNCTION(this << prefix << nd << traceSource);
+
+    const auto nodeId = nd->GetNode()->GetId();
+    const auto deviceId = nd->GetIfIndex();
+
+    std::ostringstream path;
+    path << "/NodeList/" << nodeId << "/DeviceList/" << deviceId << "/$ns3::WifiNetDevice/Mac/"
+         << traceSource;
+    std::ostringstream fileName;
+    fileName << prefix << "-" << nodeId << "-" << deviceId;
+
+    m_helper.WriteProbe("ns3::PacketProbe", path.str(), "OutputBytes", fileName.str());
+}
+
+void
+WifiTimeWindowHelper::EnableMacTx(const std::string& prefix, Ptr<NetDevice> nd)
+{
+    EnableMac(prefix, nd, "MacTx");
+}
+
+void
+WifiTimeWindowHelper::EnableMacTx(const std::string& prefix, const NetDeviceContainer& d)
+{
+    for (auto i = d.Begin(); i != d.End(); ++i)
+    {
+        EnableMac(prefix, *i, "MacTx");
+    }
+}
+
+void
+WifiTimeWindowHelper::EnableMacRx(const std::string& prefix, Ptr<NetDevice> nd)
+{
+    EnableMac(prefix, nd, "MacRx");
+}
+
+void
+WifiTimeWindowHelper::EnableMacRx(const std::string& prefix, const NetDeviceContainer& d)
+{
+    for (auto i = d.Begin(); i != d.End(); ++i)
+    {
+        EnableMac(prefix, *i, "MacRx");
+    }
+}
+
+void
+WifiTimeWindowHelper::EnablePacketSinkRx(const std::string& prefix, Ptr<Application> app)
+{
+    NS_LOG_FUNCTION(this << prefix << app);
+
+    auto node = app->GetNode();
+    uint32_t appId = 0;
+    while (appId < node->GetNApplications() && node->GetApplication(appId) != app)
+    {
+        ++appId;
+    }
+    NS_ABORT_MSG_IF(appId == node->GetNApplications(), "Application not installed on its node");
+
+    std::ostringstream path;
+    path << "/NodeList/" << node->GetId() << "/ApplicationList/" << appId
+         << "/$ns3::PacketSink/Rx";
+    std::ostringstream fileName;
+    fileName << prefix << "-" << node->GetId() << "-" << appId;
+
+    m_helper.WriteProbe("ns3::ApplicationPacketProbe", path.str(), "OutputBytes", fileName.str());
+}
+
+void
+WifiTimeWindowHelper::EnablePacketSinkRx(const std::string& prefix,
+                                         const ApplicationContainer& apps)
+{
+    for (auto i = apps.Begin(); i != apps.End(); ++i)
+    {
+        EnablePacketSinkRx(prefix, *i);
+    }
+}
+
+} // namespace ns3
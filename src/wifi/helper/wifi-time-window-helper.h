@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_TIME_WINDOW_HELPER_H
+#define WIFI_TIME_WINDOW_HELPER_H
+
+#include "ns3/time-window-helper.h"
+
+#include <string>
+
+namespace ns3
+{
+
+class Application;
+class ApplicationContainer;
+class NetDevice;
+class NetDeviceContainer;
+
+/**
+ * \ingroup wifi
+ *
+ * \brief Write per-window statistics of the packets transmitted and received by wifi
+ * devices and of the packets received by PacketSink applications
+ *
+ * For every enabled wifi device or PacketSink application, a file is written with one
+ * line per time window (see TimeWindowAggregator) reporting the number of packets, the
+ * number of bytes and the minimum, mean, maximum and quantiles of the packet sizes
+ * observed in the window, e.g., to plot the throughput versus time without logging
+ * every packet. The traced packets are those passed to the MacTx and MacRx trace sources
+ * of the WifiMac and to the Rx trace source of the PacketSink. The file names are made of
+ * the given prefix, the node ID and the device (or application) index.
+ *
+ * The helper must not be destroyed before the simulation ends. Enabling PacketSink
+ * applications requires the applications module.
+ */
+class WifiTimeWindowHelper
+{
+  public:
+    WifiTimeWindowHelper();
+
+    /**
+     * Set an attribute of the TimeWindowAggregator objects created by subsequent calls to
+     * the Enable methods (e.g., WindowSize).
+     *
+     * \param name the name of the attribute to set
+     * \param value the value of the attribute to set
+     */
+    void SetAggregatorAttribute(const std::string& name, const AttributeValue& value);
+
+    /**
+     * Enable the statistics of the packets passed to the MAC layer for transmission.
+     *
+     * \param prefix the prefix of the file names
+     * \param nd the wifi device
+     */
+    void EnableMacTx(const std::string& prefix, Ptr<NetDevice> nd);
+
+    /**
+     * Enable the statistics of the packets passed to the MAC layer for transmission.
+     *
+     * \param prefix the prefix of the file names
+     * \param d the wifi devices
+     */
+    void EnableMacTx(const std::string& prefix, const NetDeviceContainer& d);
+
+    /**
+     * Enable the statistics of the packets forwarded up by the MAC layer.
+     *
+     * \param prefix the prefix of the file names
+     * \param nd the wifi device
+     */
+    void EnableMacRx(const std::string& prefix, Ptr<NetDevice> nd);
+
+    /**
+     * Enable the statistics of the packets forwarded up by the MAC layer.
+     *
+     * \param prefix the prefix of the file names
+     * \param d the wifi devices
+     */
+    void EnableMacRx(const std::string& prefix, const NetDeviceContainer& d);
+
+    /**
+     * Enable the statistics of the packets received by a PacketSink application.
+     *
+     * \param prefix the prefix of the file names
+     * \param app the PacketSink application
+     */
+    void EnablePacketSinkRx(const std::string& prefix, Ptr<Application> app);
+
+    /**
+     * Enable the statistics of the packets received by PacketSink applications.
+     *
+     * \param prefix the prefix of the file names
+     * \param apps the PacketSink applications
+     */
+    void EnablePacketSinkRx(const std::string& prefix, const ApplicationContainer& apps);
+
+  private:
+    /**
+     * Enable the statistics of the packets passed to the given trace source of the MAC
+     * layer of the given device.
+     *
+     * \param prefix the prefix of the file names
+     * \param nd the wifi device
+     * \param traceSource the name of the trace source
+     */
+    void EnableMac(const std::string& prefix, Ptr<NetDevice> nd, const std::string& traceSource);
+
+    TimeWindowHelper m_helper; ///< the helper creating the probes and the aggregators
+};
+
+} // namespace ns3
+
+#endif /* WIFI_TIME_WINDOW_HELPER_H */
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "analytical-edca-bss.h"
+
+#include "qos-txop.h"
+#include "wifi-mac-trailer.h"
+#include "wifi-mac.h"
+#include "wifi-net-device.h"
+#include "wifi-phy.h"
+#include "wifi-psdu.h"
+#include "wifi-utils.h"
+
+#include "ns3/double.h"
+#include "ns3/log.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("AnalyticalEdcaBss");
+
+NS_OBJECT_ENSURE_REGISTERED(AnalyticalEdcaBss);
+
+TypeId
+AnalyticalEdcaBss::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::AnalyticalEdcaBss")
+            .SetParent<Object>()
+            .SetGroupName("Wifi")
+            .AddConstructor<AnalyticalEdcaBss>()
+            .AddAttribute("StartTime",
+                          "Time at which the generation of the channel activity starts.",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&AnalyticalEdcaBss::m_startTime),
+                          MakeTimeChecker())
+            .AddAttribute("StopTime",
+                          "Time at which the generation of the channel activity stops.",
+                          TimeValue(Time::Max()),
+                          MakeTimeAccessor(&AnalyticalEdcaBss::m_stopTime),
+                          MakeTimeChecker())
+            .AddAttribute("OfferedLoad",
+                          "The number of packets per second offered to every station.",
+                          DoubleValue(100),
+                          MakeDoubleAccessor(&AnalyticalEdcaBss::m_offeredLoad),
+                          MakeDoubleChecker<double>(0))
+            .AddAttribute("PacketSize",
+                          "The size in bytes of the MSDUs carried by the data frames.",
+                          UintegerValue(1500),
+                          MakeUintegerAccessor(&AnalyticalEdcaBss::m_packetSize),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("DataMode",
+                          "The transmission mode used for the data frames.",
+                          StringValue("OfdmRate54Mbps"),
+                          MakeWifiModeAccessor(&AnalyticalEdcaBss::m_dataMode),
+                          MakeWifiModeChecker())
+            .AddAttribute("AckMode",
+                          "The transmission mode used for the Ack frames.",
+                          StringValue("OfdmRate24Mbps"),
+                          MakeWifiModeAccessor(&AnalyticalEdcaBss::m_ackMode),
+                          MakeWifiModeChecker())
+            .AddAttribute("BssColor",
+                          "The BSS color carried by the HE PPDUs.",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&AnalyticalEdcaBss::m_bssColor),
+                          MakeUintegerChecker<uint8_t>(0, 63))
+            .AddAttribute("MaxIterations",
+                          "The maximum number of iterations to solve the analytical model.",
+                          UintegerValue(100),
+                          MakeUintegerAccessor(&AnalyticalEdcaBss::m_maxIterations),
+                          MakeUintegerChecker<uint32_t>(1));
+    return tid;
+}
+
+AnalyticalEdcaBss::AnalyticalEdcaBss()
+    : m_rng(CreateObject<UniformRandomVariable>())
+{
+    NS_LOG_FUNCTION(this);
+}
+
+AnalyticalEdcaBss::~AnalyticalEdcaBss()
+{
+    NS_LOG_FUNCTION_NOARGS();
+}
+
+void
+AnalyticalEdcaBss::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_event.Cancel();
+    m_ackEvent.Cancel();
+    m_stations.clear();
+    m_rng = nullptr;
+    Object::DoDispose();
+}
+
+int64_t
+AnalyticalEdcaBss::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    m_rng->SetStream(stream);
+    return 1;
+}
+
+double
+AnalyticalEdcaBss::GetTransmissionProbability() const
+{
+    return m_tau;
+}
+
+double
+AnalyticalEdcaBss::GetCollisionProbability() const
+{
+    return m_p;
+}
+
+double
+AnalyticalEdcaBss::GetStationUtilization() const
+{
+    return m_rho;
+}
+
+double
+AnalyticalEdcaBss::GetChannelOccupancy() const
+{
+    if (m_busyProbability == 0)
+    {
+        return 0;
+    }
+    const auto successTime = m_dataDuration + m_sifs + m_ackDuration;
+    const auto idle = (1 - m_busyProbability) * m_slot.GetSeconds();
+    const auto success = m_busyProbability * m_successProbability;
+    const auto collision = m_busyProbability * (1 - m_successProbability);
+    const auto busy =
+        success * successTime.GetSeconds() + collision * m_dataDuration.GetSeconds();
+    return busy / (idle + busy + m_busyProbability * m_aifs.GetSeconds());
+}
+
+void
+AnalyticalEdcaBss::Install(const NetDeviceContainer& devices, AcIndex ac)
+{
+    NS_LOG_FUNCTION(this << devices.GetN() << ac);
+    NS_ABORT_MSG_IF(devices.GetN() == 0, "No device provided");
+    NS_ABORT_MSG_IF(!m_stations.empty(), "Devices have been already installed");
+
+    uint32_t cwMin = 0;
+    uint32_t cwMax = 0;
+    uint8_t aifsn = 0;
+
+    for (auto it = devices.Begin(); it != devices.End(); ++it)
+    {
+        auto device = DynamicCast<WifiNetDevice>(*it);
+        NS_ABORT_MSG_IF(!device, "Not a wifi device");
+        m_stations.push_back({device->GetPhy(), Mac48Address::Allocate()});
+
+        if (it == devices.Begin())
+        {
+            // the EDCA parameters and the TX vectors are determined by the AP
+            auto mac = device->GetMac();
+            Ptr<Txop> txop = mac->GetTxop();
+            if (mac->GetQosSupported())
+            {
+                txop = mac->GetQosTxop(ac);
+            }
+            NS_ABORT_MSG_IF(!txop, "No Txop for the given Access Category");
+            cwMin = txop->GetMinCw();
+            cwMax = txop->GetMaxCw();
+            aifsn = txop->GetAifsn();
+        }
+    }
+
+    const auto phy = m_stations.front().phy;
+    m_slot = phy->GetSlot();
+    m_sifs = phy->GetSifs();
+    m_aifs = m_sifs + aifsn * m_slot;
+    m_cwMin = cwMin;
+
+    m_dataTxVector.SetMode(m_dataMode);
+    m_dataTxVector.SetPreambleType(
+        GetPreambleForTransmission(m_dataMode.GetModulationClass(), false));
+    m_dataTxVector.SetChannelWidth(phy->GetTxBandwidth(m_dataMode));
+    m_dataTxVector.SetGuardInterval(800);
+    m_dataTxVector.SetBssColor(m_bssColor);
+
+    m_ackTxVector.SetMode(m_ackMode);
+    m_ackTxVector.SetPreambleType(
+        GetPreambleForTransmission(m_ackMode.GetModulationClass(), false));
+    m_ackTxVector.SetChannelWidth(phy->GetTxBandwidth(m_ackMode));
+
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    const auto dataSize = m_packetSize + hdr.GetSize() + WIFI_MAC_FCS_LENGTH;
+    m_dataDuration = WifiPhy::CalculateTxDuration(dataSize, m_dataTxVector, phy->GetPhyBand());
+    m_ackDuration = WifiPhy::CalculateTxDuration(GetAckSize(), m_ackTxVector, phy->GetPhyBand());
+
+    SolveModel(cwMin, cwMax);
+
+    NS_LOG_DEBUG("Stations=" << m_stations.size() << " tau=" << m_tau << " p=" << m_p
+                             << " rho=" << m_rho << " occupancy=" << GetChannelOccupancy());
+
+    if (m_busyProbability > 0 && m_startTime < m_stopTime)
+    {
+        m_event = Simulator::Schedule(std::max(m_startTime - Simulator::Now(), Time()),
+                                      &AnalyticalEdcaBss::ScheduleNextTransmission,
+                                      this,
+                                      Time());
+    }
+}
+
+double
+AnalyticalEdcaBss::GetSaturatedTau(double p) const
+{
+    // Bianchi's model: tau = 2 / (1 + W + p W sum_{k=0}^{m-1} (2p)^k), where W is the
+    // minimum contention window plus one and m is the number of backoff stages. This form
+    // does not have a singularity at p = 0.5.
+    const auto w = static_cast<double>(m_cwMin + 1);
+    double sum = 0;
+    double term = 1;
+    for (uint32_t k = 0; k < m_backoffStages; ++k)
+    {
+        sum += term;
+        term *= 2 * p;
+    }
+    return 2 / (1 + w + p * w * sum);
+}
+
+void
+AnalyticalEdcaBss::SolveModel(uint32_t cwMin, uint32_t cwMax)
+{
+    NS_LOG_FUNCTION(this << cwMin << cwMax);
+
+    m_backoffStages = 0;
+    for (uint64_t cw = cwMin + 1; cw < static_cast<uint64_t>(cwMax) + 1; cw *= 2)
+    {
+        ++m_backoffStages;
+    }
+
+    const auto n = m_stations.size();
+    const auto slot = m_slot.GetSeconds();
+    const auto successTime = (m_dataDuration + m_sifs + m_ackDuration + m_aifs).GetSeconds();
+    const auto collisionTime = (m_dataDuration + m_aifs).GetSeconds();
+
+    m_rho = (m_offeredLoad > 0 ? 1 : 0);
+
+    for (uint32_t iter = 0; iter < m_maxIterations; ++iter)
+    {
+        // given the fraction of served load, find the collision probability p such that
+        // p = 1 - (1 - rho * tau(p))^(n-1) by bisection (the right hand side is
+        // decreasing in p, hence there is a unique solution)
+        double lo = 0;
+        double hi = 1;
+        for (uint8_t i = 0; i < 60; ++i)
+        {
+            const auto p = (lo + hi) / 2;
+            const auto rhs = 1 - std::pow(1 - m_rho * GetSaturatedTau(p), n - 1);
+            (rhs > p ? lo : hi) = p;
+        }
+        m_p = (lo + hi) / 2;
+        const auto tauSat = GetSaturatedTau(m_p);
+        m_tau = m_rho * tauSat;
+
+        m_busyProbability = 1 - std::pow(1 - m_tau, n);
+        m_successProbability =
+            (m_busyProbability > 0 ? n * m_tau * std::pow(1 - m_tau, n - 1) / m_busyProbability
+                                   : 1);
+
+        if (m_offeredLoad == 0)
+        {
+            break;
+        }
+
+        // the mean duration of a virtual slot and the mean service time of a packet,
+        // i.e., the time it would take to transmit a packet if the station were saturated
+        const auto meanSlot = (1 - m_busyProbability) * slot +
+                              m_busyProbability * m_successProbability * successTime +
+                              m_busyProbability * (1 - m_successProbability) * collisionTime;
+        const auto serviceTime = meanSlot / (tauSat * (1 - m_p));
+        const auto rho = std::min(1.0, m_offeredLoad * serviceTime);
+
+        if (std::abs(rho - m_rho) < 1e-9)
+        {
+            break;
+        }
+        // damped update to help convergence
+        m_rho = (m_rho + rho) / 2;
+    }
+}
+
+void
+AnalyticalEdcaBss::ScheduleNextTransmission(Time busyTime)
+{
+    NS_LOG_FUNCTION(this << busyTime);
+
+    // number of idle slots before the next transmission (geometric distribution)
+    uint64_t idleSlots = 0;
+    if (m_busyProbability < 1)
+    {
+        idleSlots = static_cast<uint64_t>(
+            std::floor(std::log(1 - m_rng->GetValue(0, 1)) / std::log(1 - m_busyProbability)));
+    }
+
+    const auto delay = busyTime + idleSlots * m_slot;
+    if (Simulator::Now() + delay >= m_stopTime)
+    {
+        return;
+    }
+
+    const auto success = (m_rng->GetValue(0, 1) < m_successProbability);
+    m_event = Simulator::Schedule(delay, &AnalyticalEdcaBss::StartTransmission, this, success);
+}
+
+void
+AnalyticalEdcaBss::StartTransmission(bool success)
+{
+    NS_LOG_FUNCTION(this << success);
+
+    const auto n = static_cast<uint32_t>(m_stations.size());
+    const std::size_t from = m_rng->GetInteger(0, n - 1);
+    std::size_t other = 0;
+
+    if (from == 0 && n > 1)
+    {
+        // the AP transmits to a random station
+        other = m_rng->GetInteger(1, n - 1);
+    }
+    else if (!success)
+    {
+        // a random station other than the transmitter transmits simultaneously
+        other = (from + m_rng->GetInteger(1, n - 1)) % n;
+    }
+
+    // defer the transmission if the PHY of a transmitting station is not idle, e.g.,
+    // because the channel is occupied by the BSS under study
+    for (const auto i : {from, other})
+    {
+        if (const auto& phy = m_stations[i].phy; !phy->IsStateIdle())
+        {
+            const auto backoff = m_rng->GetInteger(0, m_cwMin) * m_slot;
+            const auto delay = phy->GetDelayUntilIdle() + m_aifs + backoff;
+            NS_LOG_DEBUG("Station " << i << " is not idle, defer by " << delay.As(Time::US));
+            m_event =
+                Simulator::Schedule(delay, &AnalyticalEdcaBss::StartTransmission, this, success);
+            return;
+        }
+        if (success)
+        {
+            break;
+        }
+    }
+
+    if (success)
+    {
+        SendData(from, other, m_sifs + m_ackDuration);
+        if (n > 1)
+        {
+            m_ackEvent = Simulator::Schedule(m_dataDuration + m_sifs,
+                                             &AnalyticalEdcaBss::SendAck,
+                                             this,
+                                             other,
+                                             from);
+        }
+        ScheduleNextTransmission(m_dataDuration + m_sifs + m_ackDuration + m_aifs);
+        return;
+    }
+
+    SendData(from, other, Time());
+    SendData(other, from, Time());
+    ScheduleNextTransmission(m_dataDuration + m_aifs);
+}
+
+void
+AnalyticalEdcaBss::SendData(std::size_t from, std::size_t to, Time duration)
+{
+    NS_LOG_FUNCTION(this << from << to << duration);
+
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    hdr.SetAddr1(m_stations[to].address);
+    hdr.SetAddr2(m_stations[from].address);
+    hdr.SetAddr3(m_stations.front().address);
+    hdr.SetDsNotFrom();
+    hdr.SetDsNotTo();
+    hdr.SetQosTid(0);
+    hdr.SetDuration(duration);
+
+    m_stations[from].phy->Send(Create<WifiPsdu>(Create<Packet>(m_packetSize), hdr),
+                               m_dataTxVector);
+}
+
+void
+AnalyticalEdcaBss::SendAck(std::size_t from, std::size_t to)
+{
+    NS_LOG_FUNCTION(this << from << to);
+
+    const auto& phy = m_stations[from].phy;
+    if (!phy->IsStateIdle() && !phy->IsStateCcaBusy() && !phy->IsStateRx())
+    {
+        NS_LOG_DEBUG("Station " << from << " cannot transmit the Ack");
+        return;
+    }
+
+    WifiMacHeader hdr(WIFI_MAC_CTL_ACK);
+    hdr.SetAddr1(m_stations[to].address);
+    hdr.SetDuration(Time());
+
+    phy->Send(Create<WifiPsdu>(Create<Packet>(), hdr), m_ackTxVector);
+}
+
+} // namespace ns3
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef ANALYTICAL_EDCA_BSS_H
+#define ANALYTICAL_EDCA_BSS_H
+
+#include "qos-utils.h"
+#include "wifi-mode.h"
+#include "wifi-tx-vector.h"
+
+#include "ns3/event-id.h"
+#include "ns3/mac48-address.h"
+#include "ns3/net-device-container.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+class UniformRandomVariable;
+class WifiPhy;
+
+/**
+ * \ingroup wifi
+ *
+ * AnalyticalEdcaBss models the channel activity of a background BSS by means of an
+ * analytical model of the EDCA channel access, instead of simulating the MAC layer
+ * and the traffic of its stations frame by frame.
+ *
+ * The stations of the background BSS are wifi devices installed with a MAC that does not
+ * generate traffic (e.g., AdhocWifiMac). Given the EDCA parameters of the selected Access
+ * Category (read from the MAC of the devices), the slot and SIFS durations (read from the
+ * PHY of the devices), the offered load and the size and TX mode of the frames, the
+ * extension of the Bianchi model to non-saturated conditions is solved to obtain the
+ * probability that a station transmits in a generic slot and the conditional collision
+ * probability.
+ *
+ * The channel activity is then generated as a sequence of virtual slots: the number of
+ * idle slots preceding each transmission is drawn from a geometric distribution and each
+ * transmission is either a successful one (a data frame sent by a random station,
+ * followed by an Ack sent after a SIFS by the AP or, if the AP is the transmitter, by a
+ * random station) or a collision (data frames sent simultaneously by two random
+ * stations). The frames are transmitted by the PHY of the selected devices, hence they
+ * are received by all the other devices (including those of the BSS under study, which
+ * are fully simulated) with the correct received power, occupy the channel and cause
+ * interference. The frames carry addresses that do not belong to any device, so they are
+ * discarded by all MAC layers (NAV aside). A transmission is deferred if the PHY of the
+ * transmitting station is not idle, e.g., because the channel is occupied by the BSS
+ * under study.
+ *
+ * Only the PHYs of the background stations process the frames (and only as receivers of
+ * the signals), while no MAC, network or application layer processing takes place for
+ * the background BSS.
+ */
+class AnalyticalEdcaBss : public Object
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    AnalyticalEdcaBss();
+    ~AnalyticalEdcaBss() override;
+
+    /**
+     * Use the given devices as the stations of the background BSS and start generating
+     * the channel activity at the time specified by the StartTime attribute. The first
+     * device is the AP. The devices must have been already installed.
+     *
+     * \param devices the wifi devices of the background BSS
+     * \param ac the Access Category whose EDCA parameters are used
+     */
+    void Install(const NetDeviceContainer& devices, AcIndex ac = AC_BE);
+
+    /**
+     * Assign a fixed random variable stream number to the random variables used by this
+     * model. Return the number of streams (possibly zero) that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this model
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * \return the probability that a station transmits in a generic slot
+     */
+    double GetTransmissionProbability() const;
+
+    /**
+     * \return the probability that a frame transmitted by a station collides
+     */
+    double GetCollisionProbability() const;
+
+    /**
+     * \return the probability that a station has a packet to transmit (one if the stations
+     *         are saturated)
+     */
+    double GetStationUtilization() const;
+
+    /**
+     * \return the expected fraction of time the channel is occupied by the background BSS
+     */
+    double GetChannelOccupancy() const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// Information about a station of the background BSS
+    struct Station
+    {
+        Ptr<WifiPhy> phy;     ///< the PHY of the station
+        Mac48Address address; ///< the (fictitious) address used by the station
+    };
+
+    /**
+     * Solve the analytical model given the EDCA parameters, the slot duration and the
+     * duration of successful transmissions and collisions.
+     *
+     * \param cwMin the minimum contention window
+     * \param cwMax the maximum contention window
+     */
+    void SolveModel(uint32_t cwMin, uint32_t cwMax);
+
+    /**
+     * \param p the conditional collision probability
+     * \return the probability that a saturated station transmits in a generic slot
+     */
+    double GetSaturatedTau(double p) const;
+
+    /**
+     * Schedule the next transmission after the given busy time and a random number of
+     * idle slots.
+     *
+     * \param busyTime the time the channel is busy because of the current transmission
+     */
+    void ScheduleNextTransmission(Time busyTime);
+
+    /**
+     * Start a transmission, unless the PHY of a transmitting station is not idle, in
+     * which case the transmission is deferred.
+     *
+     * \param success whether the transmission is successful
+     */
+    void StartTransmission(bool success);
+
+    /**
+     * Transmit a data frame from the given station to the given station.
+     *
+     * \param from the index of the station transmitting the data frame
+     * \param to the index of the station the data frame is addressed to
+     * \param duration the value of the Duration/ID field
+     */
+    void SendData(std::size_t from, std::size_t to, Time duration);
+
+    /**
+     * Transmit an Ack from the given station to the given station.
+     *
+     * \param from the index of the station transmitting the Ack
+     * \param to the index of the station the Ack is addressed to
+     */
+    void SendAck(std::size_t from, std::size_t to);
+
+    Time m_startTime;         //!< time to start generating the channel activity
+    Time m_stopTime;          //!< time to stop generating the channel activity
+    double m_offeredLoad;     //!< packets per second offered to every station
+    uint32_t m_packetSize;    //!< size of the MSDUs in bytes
+    WifiMode m_dataMode;      //!< TX mode of the data frames
+    WifiMode m_ackMode;       //!< TX mode of the Ack frames
+    uint8_t m_bssColor;       //!< BSS color of the HE PPDUs
+    uint32_t m_maxIterations; //!< max number of iterations to solve the model
+
+    std::vector<Station> m_stations;  //!< the stations of the background BSS
+    WifiTxVector m_dataTxVector;      //!< TX vector of the data frames
+    WifiTxVector m_ackTxVector;       //!< TX vector of the Ack frames
+    Time m_slot;                      //!< slot duration
+    Time m_sifs;                      //!< SIFS duration
+    Time m_aifs;                      //!< AIFS duration
+    Time m_dataDuration;              //!< duration of a data frame
+    Time m_ackDuration;               //!< duration of an Ack frame
+    uint32_t m_cwMin{0};              //!< minimum contention window
+    uint32_t m_backoffStages{0};      //!< number of backoff stages
+    double m_tau{0};                  //!< transmission probability in a slot
+    double m_p{0};                    //!< conditional collision probability
+    double m_rho{0};                  //!< probability that a station has a packet to send
+    double m_busyProbability{0};      //!< probability that a slot is not idle
+    double m_successProbability{0};   //!< probability that a transmission succeeds
+    Ptr<UniformRandomVariable> m_rng; //!< random variable
+    EventId m_event;                  //!< next transmission event
+    EventId m_ackEvent;               //!< next Ack transmission event
+};
+
+} // namespace ns3
+
+#endif /* ANALYTICAL_EDCA_BSS_H */
@@ -131,7 +131,7 @@ BlockAckManager::CreateOriginatorAgreement(const MgtAddBaRequestHeader& reqHdr,
                       "Existing agreement must be in RESET state");
     }
     m_originatorAgreements.insert_or_assign({recipient, tid},
-                                            std::make_pair(std::move(agreement), PacketQueue{}));
+                                            std::make_pair(std::move(agreement), InFlightMpdus{}));
     m_blockPackets(recipient, tid);
 }
 
@@ -256,29 +256,11 @@ BlockAckManager::StorePacket(Ptr<WifiMpdu> mpdu)
         return;
     }
 
-    // store the packet and keep the list sorted in increasing order of sequence number
-    // with respect to the starting sequence number
-    auto it = agreementIt->second.second.rbegin();
-    while (it != agreementIt->second.second.rend())
+    if (!agreementIt->second.second.Insert(mpdu))
     {
-        if (mpdu->GetHeader().GetSequenceControl() == (*it)->GetHeader().GetSequenceControl())
-        {
-            NS_LOG_DEBUG("Packet already in the queue of the BA agreement");
-            return;
-        }
-
-        uint16_t dist =
-            agreementIt->second.first.GetDistance((*it)->GetHeader().GetSequenceNumber());
-
-        if (mpduDist > dist || (mpduDist == dist && mpdu->GetHeader().GetFragmentNumber() >
-                                                        (*it)->GetHeader().GetFragmentNumber()))
-        {
-            break;
-        }
-
-        it++;
+        NS_LOG_DEBUG("Packet already in the queue of the BA agreement");
+        return;
     }
-    agreementIt->second.second.insert(it.base(), mpdu);
     agreementIt->second.first.NotifyTransmittedMpdu(mpdu);
 }
 
@@ -291,7 +273,7 @@ BlockAckManager::GetNBufferedPackets(const Mac48Address& recipient, uint8_t tid)
     {
         return 0;
     }
-    return it->second.second.size();
+    return it->second.second.GetSize();
 }
 
 void
@@ -301,31 +283,34 @@ BlockAckManager::SetBlockAckThreshold(uint8_t nPackets)
     m_blockAckThreshold = nPackets;
 }
 
-BlockAckManager::PacketQueueI
+bool
 BlockAckManager::HandleInFlightMpdu(uint8_t linkId,
-                                    PacketQueueI mpduIt,
+                                    Ptr<WifiMpdu> mpdu,
                                     MpduStatus status,
                                     const OriginatorAgreementsI& it,
                                     const Time& now)
 {
-    NS_LOG_FUNCTION(this << linkId << **mpduIt << +static_cast<uint8_t>(status));
+    NS_LOG_FUNCTION(this << linkId << *mpdu << +static_cast<uint8_t>(status));
 
-    if (!(*mpduIt)->IsQueued())
+    const WifiMacHeader& hdr = mpdu->GetHeader();
+    auto& inFlight = it->second.second;
+
+    if (!mpdu->IsQueued())
     {
         // MPDU is not in the EDCA queue (e.g., its lifetime expired and it was
         // removed by another method), remove from the queue of in flight MPDUs
         NS_LOG_DEBUG("MPDU is not stored in the EDCA queue, drop MPDU");
-        return it->second.second.erase(mpduIt);
+        inFlight.Erase(hdr.GetSequenceNumber());
+        return false;
     }
 
     if (status == ACKNOWLEDGED)
     {
         // the MPDU has to be dequeued from the EDCA queue
-        return it->second.second.erase(mpduIt);
+        inFlight.Erase(hdr.GetSequenceNumber());
+        return false;
     }
 
-    const WifiMacHeader& hdr = (*mpduIt)->GetHeader();
-
     NS_ASSERT(hdr.GetAddr1() == it->first.first);
     NS_ASSERT(hdr.IsQosData() && hdr.GetQosTid() == it->first.second);
 
@@ -334,38 +319,38 @@ BlockAckManager::HandleInFlightMpdu(uint8_t linkId,
         NS_LOG_DEBUG("Old packet. Remove from the EDCA queue, too");
         if (!m_droppedOldMpduCallback.IsNull())
         {
-            m_droppedOldMpduCallback(*mpduIt);
+            m_droppedOldMpduCallback(mpdu);
         }
-        m_queue->Remove(*mpduIt);
-        return it->second.second.erase(mpduIt);
-    }
-
-    std::optional<PacketQueueI> prevIt;
-    if (mpduIt != it->second.second.begin())
-    {
-        prevIt = std::prev(mpduIt);
+        m_queue->Remove(mpdu);
+        inFlight.Erase(hdr.GetSequenceNumber());
+        return false;
     }
 
-    if (m_queue->TtlExceeded(*mpduIt, now))
+    if (m_queue->TtlExceeded(mpdu, now))
     {
         // WifiMacQueue::TtlExceeded() has removed the MPDU from the EDCA queue
         // and fired the Expired trace source, which called NotifyDiscardedMpdu,
         // which removed this MPDU (and possibly others) from the in flight queue as well
         NS_LOG_DEBUG("MSDU lifetime expired, drop MPDU");
-        return (prevIt.has_value() ? std::next(prevIt.value()) : it->second.second.begin());
+        if (inFlight.Find(hdr.GetSequenceNumber()) == mpdu)
+        {
+            inFlight.Erase(hdr.GetSequenceNumber());
+        }
+        return false;
     }
 
     if (status == STAY_INFLIGHT)
     {
         // the MPDU has to stay in flight, do nothing
-        return ++mpduIt;
+        return true;
     }
 
     NS_ASSERT(status == TO_RETRANSMIT);
-    (*mpduIt)->GetHeader().SetRetry();
-    (*mpduIt)->ResetInFlight(linkId); // no longer in flight; will be if retransmitted
+    mpdu->GetHeader().SetRetry();
+    mpdu->ResetInFlight(linkId); // no longer in flight; will be if retransmitted
 
-    return it->second.second.erase(mpduIt);
+    inFlight.Erase(hdr.GetSequenceNumber());
+    return false;
 }
 
 void
@@ -384,14 +369,10 @@ BlockAckManager::NotifyGotAck(uint8_t linkId, Ptr<const WifiMpdu> mpdu)
     it->second.first.NotifyAckedMpdu(mpdu);
 
     // remove the acknowledged frame from the queue of outstanding packets
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end(); ++queueIt)
+    if (auto inFlightMpdu = it->second.second.Find(mpdu->GetHeader().GetSequenceNumber()))
     {
-        if ((*queueIt)->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
-        {
-            m_queue->DequeueIfQueued({*queueIt});
-            HandleInFlightMpdu(linkId, queueIt, ACKNOWLEDGED, it, Simulator::Now());
-            break;
-        }
+        m_queue->DequeueIfQueued({inFlightMpdu});
+        HandleInFlightMpdu(linkId, inFlightMpdu, ACKNOWLEDGED, it, Simulator::Now());
     }
 }
 
@@ -410,13 +391,9 @@ BlockAckManager::NotifyMissedAck(uint8_t linkId, Ptr<WifiMpdu> mpdu)
 
     // remove the frame from the queue of outstanding packets (it will be re-inserted
     // if retransmitted)
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end(); ++queueIt)
+    if (auto inFlightMpdu = it->second.second.Find(mpdu->GetHeader().GetSequenceNumber()))
     {
-        if ((*queueIt)->GetHeader().GetSequenceNumber() == mpdu->GetHeader().GetSequenceNumber())
-        {
-            HandleInFlightMpdu(linkId, queueIt, TO_RETRANSMIT, it, Simulator::Now());
-            break;
-        }
+        HandleInFlightMpdu(linkId, inFlightMpdu, TO_RETRANSMIT, it, Simulator::Now());
     }
 }
 
@@ -455,7 +432,7 @@ BlockAckManager::NotifyGotBlockAck(uint8_t linkId,
         /* Upon reception of a BlockAck frame, the inactivity timer at the
             originator must be reset.
             For more details see section 11.5.3 in IEEE802.11e standard */
-        it->second.first.m_inactivityEvent.Cancel();
+        it->second.first.m_inactivityEvent.Remove();
         Time timeout = MicroSeconds(1024 * it->second.first.GetTimeout());
         it->second.first.m_inactivityEvent =
             Simulator::Schedule(timeout, &BlockAckManager::InactivityTimeout, this, recipient, tid);
@@ -464,25 +441,27 @@ BlockAckManager::NotifyGotBlockAck(uint8_t linkId,
     NS_ASSERT(blockAck.IsCompressed() || blockAck.IsExtendedCompressed() || blockAck.IsMultiSta());
     Time now = Simulator::Now();
     std::list<Ptr<const WifiMpdu>> acked;
+    std::vector<Ptr<WifiMpdu>> notAcked;
+    auto& inFlight = it->second.second;
 
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end();)
+    for (const auto& mpdu : inFlight.GetMpdus())
     {
-        uint16_t currentSeq = (*queueIt)->GetHeader().GetSequenceNumber();
+        uint16_t currentSeq = mpdu->GetHeader().GetSequenceNumber();
         NS_LOG_DEBUG("Current seq=" << currentSeq);
         if (blockAck.IsPacketReceived(currentSeq, index))
         {
-            it->second.first.NotifyAckedMpdu(*queueIt);
+            it->second.first.NotifyAckedMpdu(mpdu);
             nSuccessfulMpdus++;
             if (!m_txOkCallback.IsNull())
             {
-                m_txOkCallback(*queueIt);
+                m_txOkCallback(mpdu);
             }
-            acked.emplace_back(*queueIt);
-            queueIt = HandleInFlightMpdu(linkId, queueIt, ACKNOWLEDGED, it, now);
+            acked.emplace_back(mpdu);
+            HandleInFlightMpdu(linkId, mpdu, ACKNOWLEDGED, it, now);
         }
         else
         {
-            ++queueIt;
+            notAcked.emplace_back(mpdu);
         }
     }
 
@@ -490,24 +469,30 @@ BlockAckManager::NotifyGotBlockAck(uint8_t linkId,
     m_queue->DequeueIfQueued(acked);
 
     // Remaining outstanding MPDUs have not been acknowledged
-    for (auto queueIt = it->second.second.begin(); queueIt != it->second.second.end();)
+    for (const auto& mpdu : notAcked)
     {
+        if (inFlight.Find(mpdu->GetHeader().GetSequenceNumber()) != mpdu)
+        {
+            // removed while handling another MPDU (e.g., because its lifetime expired)
+            continue;
+        }
+
         // transmission actually failed if the MPDU is inflight only on the same link on
         // which we received the BlockAck frame
-        auto linkIds = (*queueIt)->GetInFlightLinkIds();
+        auto linkIds = mpdu->GetInFlightLinkIds();
 
         if (linkIds.size() == 1 && *linkIds.begin() == linkId)
         {
             nFailedMpdus++;
             if (!m_txFailedCallback.IsNull())
             {
-                m_txFailedCallback(*queueIt);
+                m_txFailedCallback(mpdu);
             }
-            queueIt = HandleInFlightMpdu(linkId, queueIt, TO_RETRANSMIT, it, now);
+            HandleInFlightMpdu(linkId, mpdu, TO_RETRANSMIT, it, now);
             continue;
         }
 
-        queueIt = HandleInFlightMpdu(linkId, queueIt, STAY_INFLIGHT, it, now);
+        HandleInFlightMpdu(linkId, mpdu, STAY_INFLIGHT, it, now);
     }
 
     return {nSuccessfulMpdus, nFailedMpdus};
@@ -528,16 +513,21 @@ BlockAckManager::NotifyMissedBlockAck(uint8_t linkId, const Mac48Address& recipi
 
     // remove all packets from the queue of outstanding packets (they will be
     // re-inserted if retransmitted)
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    for (const auto& mpdu : it->second.second.GetMpdus())
     {
+        if (it->second.second.Find(mpdu->GetHeader().GetSequenceNumber()) != mpdu)
+        {
+            // removed while handling another MPDU (e.g., because its lifetime expired)
+            continue;
+        }
         // MPDUs that were transmitted on another link shall stay inflight
-        auto linkIds = (*mpduIt)->GetInFlightLinkIds();
+        auto linkIds = mpdu->GetInFlightLinkIds();
         if (linkIds.count(linkId) == 0)
         {
-            mpduIt = HandleInFlightMpdu(linkId, mpduIt, STAY_INFLIGHT, it, now);
+            HandleInFlightMpdu(linkId, mpdu, STAY_INFLIGHT, it, now);
             continue;
         }
-        mpduIt = HandleInFlightMpdu(linkId, mpduIt, TO_RETRANSMIT, it, now);
+        HandleInFlightMpdu(linkId, mpdu, TO_RETRANSMIT, it, now);
     }
 }
 
@@ -579,23 +569,21 @@ BlockAckManager::NotifyDiscardedMpdu(Ptr<const WifiMpdu> mpdu)
 
     // remove old MPDUs from the EDCA queue and from the in flight queue
     // (including the given MPDU which became old after advancing the transmit window)
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    // (MPDUs are in increasing order of sequence number in the in flight queue)
+    while (auto front = it->second.second.Front())
     {
-        if (it->second.first.GetDistance((*mpduIt)->GetHeader().GetSequenceNumber()) >=
+        if (it->second.first.GetDistance(front->GetHeader().GetSequenceNumber()) <
             SEQNO_SPACE_HALF_SIZE)
         {
-            NS_LOG_DEBUG("Dropping old MPDU: " << **mpduIt);
-            m_queue->DequeueIfQueued({*mpduIt});
-            if (!m_droppedOldMpduCallback.IsNull())
-            {
-                m_droppedOldMpduCallback(*mpduIt);
-            }
-            mpduIt = it->second.second.erase(mpduIt);
+            break;
         }
-        else
+        NS_LOG_DEBUG("Dropping old MPDU: " << *front);
+        m_queue->DequeueIfQueued({front});
+        if (!m_droppedOldMpduCallback.IsNull())
         {
-            break; // MPDUs are in increasing order of sequence number in the in flight queue
+            m_droppedOldMpduCallback(front);
         }
+        it->second.second.Erase(front->GetHeader().GetSequenceNumber());
     }
 
     // schedule a BlockAckRequest
@@ -813,12 +801,10 @@ BlockAckManager::NeedBarRetransmission(uint8_t tid, const Mac48Address& recipien
     Time now = Simulator::Now();
 
     // A BAR needs to be retransmitted if there is at least a non-expired in flight MPDU
-    for (auto mpduIt = it->second.second.begin(); mpduIt != it->second.second.end();)
+    while (auto mpdu = it->second.second.Front())
     {
         // remove MPDU if old or with expired lifetime
-        mpduIt = HandleInFlightMpdu(SINGLE_LINK_OP_ID, mpduIt, STAY_INFLIGHT, it, now);
-
-        if (mpduIt != it->second.second.begin())
+        if (HandleInFlightMpdu(SINGLE_LINK_OP_ID, mpdu, STAY_INFLIGHT, it, now))
         {
             // the MPDU has not been removed
             return true;
@@ -891,4 +877,155 @@ BlockAckManager::GetOriginatorStartingSequence(const Mac48Address& recipient, ui
     return seqNum;
 }
 
+std::size_t
+BlockAckManager::AgreementKeyHash::operator()(const AgreementKey& key) const
+{
+    uint8_t buffer[6];
+    key.first.CopyTo(buffer);
+    uint64_t value = key.second;
+    for (const auto byte : buffer)
+    {
+        value = (value << 8) | byte;
+    }
+    return std::hash<uint64_t>{}(value);
+}
+
+bool
+BlockAckManager::InFlightMpdus::Insert(Ptr<WifiMpdu> mpdu)
+{
+    const uint16_t seqNumber = mpdu->GetHeader().GetSequenceNumber();
+
+    if (m_size == 0)
+    {
+        Reserve(1);
+        m_head = seqNumber;
+        m_span = 1;
+    }
+    else
+    {
+        // the span needed to cover the given sequence number if it follows (resp. precedes)
+        // the stored ones
+        const uint16_t distance = (seqNumber - m_head + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE;
+        const uint16_t spanIfAfter = std::max<uint16_t>(m_span, distance + 1);
+        const uint16_t spanIfBefore = m_span + SEQNO_SPACE_SIZE - distance;
+
+        if (distance < m_span || spanIfAfter <= spanIfBefore)
+        {
+            Reserve(spanIfAfter);
+            m_span = spanIfAfter;
+        }
+        else
+        {
+            NS_ASSERT(spanIfBefore <= SEQNO_SPACE_SIZE);
+            Reserve(spanIfBefore);
+            m_head = seqNumber;
+            m_span = spanIfBefore;
+        }
+    }
+
+    auto& slot = m_slots[seqNumber & (m_slots.size() - 1)];
+    if (slot)
+    {
+        return false;
+    }
+    slot = mpdu;
+    ++m_size;
+    return true;
+}
+
+Ptr<WifiMpdu>
+BlockAckManager::InFlightMpdus::Find(uint16_t seqNumber) const
+{
+    if ((seqNumber - m_head + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE >= m_span)
+    {
+        return nullptr;
+    }
+    return m_slots[seqNumber & (m_slots.size() - 1)];
+}
+
+void
+BlockAckManager::InFlightMpdus::Erase(uint16_t seqNumber)
+{
+    if ((seqNumber - m_head + SEQNO_SPACE_SIZE) % SEQNO_SPACE_SIZE >= m_span)
+    {
+        return;
+    }
+    const auto mask = m_slots.size() - 1;
+    auto& slot = m_slots[seqNumber & mask];
+    if (!slot)
+    {
+        return;
+    }
+    slot = nullptr;
+
+    if (--m_size == 0)
+    {
+        m_span = 0;
+        return;
+    }
+    // shrink the covered range of sequence numbers to the stored MPDUs
+    while (!m_slots[m_head & mask])
+    {
+        m_head = (m_head + 1) % SEQNO_SPACE_SIZE;
+        --m_span;
+    }
+    while (!m_slots[(m_head + m_span - 1) & mask])
+    {
+        --m_span;
+    }
+}
+
+Ptr<WifiMpdu>
+BlockAckManager::InFlightMpdus::Front() const
+{
+    return m_size == 0 ? nullptr : m_slots[m_head & (m_slots.size() - 1)];
+}
+
+std::vector<Ptr<WifiMpdu>>
+BlockAckManager::InFlightMpdus::GetMpdus() const
+{
+    std::vector<Ptr<WifiMpdu>> mpdus;
+    mpdus.reserve(m_size);
+    const auto mask = m_slots.size() - 1;
+    for (uint16_t i = 0; i < m_span; ++i)
+    {
+        if (const auto& mpdu = m_slots[(m_head + i) & mask])
+        {
+            mpdus.push_back(mpdu);
+        }
+    }
+    return mpdus;
+}
+
+std::size_t
+BlockAckManager::InFlightMpdus::GetSize() const
+{
+    return m_size;
+}
+
+void
+BlockAckManager::InFlightMpdus::Reserve(uint16_t span)
+{
+    if (span <= m_slots.size())
+    {
+        return;
+    }
+
+    std::size_t size = std::max<std::size_t>(m_slots.size(), 64);
+    while (size < span)
+    {
+        size *= 2;
+    }
+    NS_ASSERT(size <= SEQNO_SPACE_SIZE);
+
+    std::vector<Ptr<WifiMpdu>> slots(size);
+    const auto oldMask = m_slots.size() - 1;
+    for (uint16_t i = 0; i < m_span; ++i)
+    {
+        const uint16_t seqNumber = (m_head + i) % SEQNO_SPACE_SIZE;
+        slots[seqNumber & (size - 1)] = std::move(m_slots[seqNumber & oldMask]);
+    }
+    m_slots = std::move(slots);
+}
+
 } // namespace ns3
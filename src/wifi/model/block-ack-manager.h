@@ -31,8 +31,9 @@
 #include "ns3/object.h"
 #include "ns3/traced-callback.h"
 
-#include <map>
 #include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -456,22 +457,84 @@ class BlockAckManager : public Object
     void InactivityTimeout(const Mac48Address& recipient, uint8_t tid);
 
     /**
-     * typedef for a list of WifiMpdu.
+     * The MPDUs in flight for an originator block ack agreement, stored in a ring indexed
+     * by sequence number. The ring covers the sequence numbers from that of the oldest
+     * MPDU in flight to that of the most recent MPDU in flight, hence MPDUs can be looked
+     * up by sequence number in constant time and are visited in increasing order of
+     * sequence number. The ring doubles its size when the covered range of sequence
+     * numbers exceeds its size. At most one MPDU per sequence number is stored, because
+     * fragments are not transmitted under a block ack agreement.
      */
-    typedef std::list<Ptr<WifiMpdu>> PacketQueue;
-    /**
-     * typedef for an iterator for PacketQueue.
-     */
-    typedef std::list<Ptr<WifiMpdu>>::iterator PacketQueueI;
+    class InFlightMpdus
+    {
+      public:
+        /**
+         * Store the given MPDU, unless an MPDU with the same sequence number is already
+         * stored.
+         *
+         * \param mpdu the given MPDU
+         * \return whether the given MPDU has been stored
+         */
+        bool Insert(Ptr<WifiMpdu> mpdu);
+        /**
+         * \param seqNumber the given sequence number
+         * \return the MPDU with the given sequence number, if any, or a null pointer
+         */
+        Ptr<WifiMpdu> Find(uint16_t seqNumber) const;
+        /**
+         * Remove the MPDU with the given sequence number, if any.
+         *
+         * \param seqNumber the given sequence number
+         */
+        void Erase(uint16_t seqNumber);
+        /**
+         * \return the MPDU with the lowest sequence number, or a null pointer if empty
+         */
+        Ptr<WifiMpdu> Front() const;
+        /**
+         * \return the stored MPDUs in increasing order of sequence number
+         */
+        std::vector<Ptr<WifiMpdu>> GetMpdus() const;
+        /**
+         * \return the number of stored MPDUs
+         */
+        std::size_t GetSize() const;
+
+      private:
+        /**
+         * Resize the ring so that it holds at least the given number of slots.
+         *
+         * \param span the number of sequence numbers the ring has to cover
+         */
+        void Reserve(uint16_t span);
+
+        std::vector<Ptr<WifiMpdu>> m_slots; //!< slots (a power of two) indexed by seqno
+        uint16_t m_head{0};                 //!< sequence number of the oldest MPDU
+        uint16_t m_span{0};                 //!< number of sequence numbers covered
+        std::size_t m_size{0};              //!< number of stored MPDUs
+    };
+
+    /// Hash function for the agreement keys
+    struct AgreementKeyHash
+    {
+        /**
+         * \param key the agreement key
+         * \return the hash of the agreement key
+         */
+        std::size_t operator()(const AgreementKey& key) const;
+    };
 
-    /// AgreementKey-indexed map of originator block ack agreements
+    /// AgreementKey-indexed hash table of originator block ack agreements
     using OriginatorAgreements =
-        std::map<AgreementKey, std::pair<OriginatorBlockAckAgreement, PacketQueue>>;
+        std::unordered_map<AgreementKey,
+                           std::pair<OriginatorBlockAckAgreement, InFlightMpdus>,
+                           AgreementKeyHash>;
     /// typedef for an iterator for Agreements
     using OriginatorAgreementsI = OriginatorAgreements::iterator;
 
-    /// AgreementKey-indexed map of recipient block ack agreements
-    using RecipientAgreements = std::map<AgreementKey, RecipientBlockAckAgreement>;
+    /// AgreementKey-indexed hash table of recipient block ack agreements
+    using RecipientAgreements =
+        std::unordered_map<AgreementKey, RecipientBlockAckAgreement, AgreementKeyHash>;
 
     /**
      * Handle the given in flight MPDU based on its given status. If the status is
@@ -482,17 +545,17 @@ class BlockAckManager : public Object
      * queue, is an old packet or its lifetime expired.
      *
      * \param linkId the ID of the link on which the MPDU has been transmitted
-     * \param mpduIt an iterator pointing to the MPDU in the queue of in flight MPDUs
+     * \param mpdu the MPDU in the queue of in flight MPDUs
      * \param status the status of the in flight MPDU
      * \param it iterator pointing to the Block Ack agreement
      * \param now the current time
-     * \return an iterator pointing to the next MPDU in the queue of in flight MPDUs
+     * \return whether the MPDU is still in the queue of in flight MPDUs
      */
-    PacketQueueI HandleInFlightMpdu(uint8_t linkId,
-                                    PacketQueueI mpduIt,
-                                    MpduStatus status,
-                                    const OriginatorAgreementsI& it,
-                                    const Time& now);
+    bool HandleInFlightMpdu(uint8_t linkId,
+                            Ptr<WifiMpdu> mpdu,
+                            MpduStatus status,
+                            const OriginatorAgreementsI& it,
+                            const Time& now);
 
     /**
      * This data structure contains, for each originator block ack agreement (recipient, TID),
@@ -23,13 +23,55 @@
 
 #include "ns3/log.h"
 
+#include <algorithm>
+#include <bit>
+
 namespace ns3
 {
 
 NS_LOG_COMPONENT_DEFINE("BlockAckWindow");
 
+/// Number of bits in a word of the window
+static constexpr std::size_t WORD_BITS = 64;
+
+/**
+ * \param count the number of bits (at most 64)
+ * \return a word whose count least significant bits are set
+ */
+static constexpr uint64_t
+LowBitsMask(std::size_t count)
+{
+    return (count >= WORD_BITS) ? ~uint64_t{0} : ((uint64_t{1} << count) - 1);
+}
+
+BlockAckWindow::Reference::Reference(uint64_t& word, uint64_t mask)
+    : m_word(word),
+      m_mask(mask)
+{
+}
+
+BlockAckWindow::Reference&
+BlockAckWindow::Reference::operator=(bool value)
+{
+    if (value)
+    {
+        m_word |= m_mask;
+    }
+    else
+    {
+        m_word &= ~m_mask;
+    }
+    return *this;
+}
+
+BlockAckWindow::Reference::operator bool() const
+{
+    return (m_word & m_mask) != 0;
+}
+
 BlockAckWindow::BlockAckWindow()
     : m_winStart(0),
+      m_winSize(0),
       m_head(0)
 {
 }
@@ -39,14 +81,15 @@ BlockAckWindow::Init(uint16_t winStart, uint16_t winSize)
 {
     NS_LOG_FUNCTION(this << winStart << winSize);
     m_winStart = winStart;
-    m_window.assign(winSize, false);
+    m_winSize = winSize;
+    m_window.assign((winSize + WORD_BITS - 1) / WORD_BITS, 0);
     m_head = 0;
 }
 
 void
 BlockAckWindow::Reset(uint16_t winStart)
 {
-    Init(winStart, m_window.size());
+    Init(winStart, m_winSize);
 }
 
 uint16_t
@@ -58,29 +101,85 @@ BlockAckWindow::GetWinStart() const
 uint16_t
 BlockAckWindow::GetWinEnd() const
 {
-    return (m_winStart + m_window.size() - 1) % SEQNO_SPACE_SIZE;
+    return (m_winStart + m_winSize - 1) % SEQNO_SPACE_SIZE;
 }
 
 std::size_t
 BlockAckWindow::GetWinSize() const
 {
-    return m_window.size();
+    return m_winSize;
 }
 
-std::vector<bool>::reference
+BlockAckWindow::Reference
 BlockAckWindow::At(std::size_t distance)
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
 
-    return m_window.at((m_head + distance) % m_window.size());
+    auto pos = (m_head + distance) % m_winSize;
+    return Reference(m_window[pos / WORD_BITS], uint64_t{1} << (pos % WORD_BITS));
 }
 
-std::vector<bool>::const_reference
+bool
 BlockAckWindow::At(std::size_t distance) const
 {
-    NS_ASSERT(distance < m_window.size());
+    NS_ASSERT(distance < m_winSize);
+
+    auto pos = (m_head + distance) % m_winSize;
+    return (m_window[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1;
+}
+
+void
+BlockAckWindow::Fill(std::size_t distance, std::size_t count, bool value)
+{
+    NS_LOG_FUNCTION(this << distance << count << value);
+    NS_ASSERT(distance + count <= m_winSize);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    auto pos = (m_head + distance) % m_winSize;
+    // the elements may wrap around the end of the array
+    auto first = std::min(count, m_winSize - pos);
+    FillArrayBits(pos, first, value);
+    FillArrayBits(0, count - first, value);
+}
+
+std::size_t
+BlockAckWindow::FindFirstUnset() const
+{
+    for (std::size_t distance = 0; distance < m_winSize; distance += WORD_BITS)
+    {
+        auto count = std::min(WORD_BITS, m_winSize - distance);
+        auto ones = static_cast<std::size_t>(std::countr_one(GetBits(distance, count)));
 
-    return m_window.at((m_head + distance) % m_window.size());
+        if (ones < count)
+        {
+            return distance + ones;
+        }
+    }
+    return m_winSize;
+}
+
+void
+BlockAckWindow::CopyTo(std::vector<uint8_t>& bitmap) const
+{
+    auto nBits = std::min(bitmap.size() * 8, m_winSize);
+    std::size_t distance = 0;
+
+    for (; distance < nBits; distance += WORD_BITS)
+    {
+        auto word = GetBits(distance, std::min(WORD_BITS, nBits - distance));
+
+        for (std::size_t i = distance / 8; i < std::min(bitmap.size(), (distance + WORD_BITS) / 8);
+             ++i, word >>= 8)
+        {
+            bitmap[i] = static_cast<uint8_t>(word);
+        }
+    }
+    // clear the bytes corresponding to elements beyond the window size
+    std::fill(bitmap.begin() + std::min(bitmap.size(), distance / 8), bitmap.end(), 0);
 }
 
 void
@@ -88,18 +187,75 @@ BlockAckWindow::Advance(std::size_t count)
 {
     NS_LOG_FUNCTION(this << count);
 
-    if (count >= m_window.size())
+    if (count >= m_winSize)
     {
         Reset((m_winStart + count) % SEQNO_SPACE_SIZE);
         return;
     }
 
-    for (std::size_t i = 0; i < count; i++)
+    // clear the elements that become part of the tail of the window
+    Fill(0, count, false);
+    m_head = (m_head + count) % m_winSize;
+    m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
+}
+
+uint64_t
+BlockAckWindow::GetBits(std::size_t distance, std::size_t count) const
+{
+    NS_ASSERT(count <= WORD_BITS && distance + count <= m_winSize);
+
+    auto pos = (m_head + distance) % m_winSize;
+    // the elements may wrap around the end of the array
+    auto first = std::min(count, m_winSize - pos);
+    auto bits = GetArrayBits(pos, first);
+
+    if (first < count)
     {
-        m_window[m_head] = false;
-        m_head = (m_head + 1) % m_window.size();
+        bits |= GetArrayBits(0, count - first) << first;
+    }
+    return bits;
+}
+
+uint64_t
+BlockAckWindow::GetArrayBits(std::size_t pos, std::size_t count) const
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    auto index = pos / WORD_BITS;
+    auto offset = pos % WORD_BITS;
+    auto bits = m_window[index] >> offset;
+
+    if (offset + count > WORD_BITS)
+    {
+        bits |= m_window[index + 1] << (WORD_BITS - offset);
+    }
+    return bits & LowBitsMask(count);
+}
+
+void
+BlockAckWindow::FillArrayBits(std::size_t pos, std::size_t count, bool value)
+{
+    while (count > 0)
+    {
+        auto index = pos / WORD_BITS;
+        auto offset = pos % WORD_BITS;
+        auto n = std::min(count, WORD_BITS - offset);
+        auto mask = LowBitsMask(n) << offset;
+
+        if (value)
+        {
+            m_window[index] |= mask;
+        }
+        else
+        {
+            m_window[index] &= ~mask;
+        }
+        pos += n;
+        count -= n;
     }
-    m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
 }
 
 } // namespace ns3
@@ -35,10 +35,14 @@ namespace ns3
  * a given number of positions. This class can be used to implement both
  * an originator's window and a recipient's window.
  *
- * The window is implemented as a vector of bool and managed as a circular
- * queue. The window is moved forward by advancing the head of the queue and
+ * The window is implemented as an array of 64-bit words and managed as a circular
+ * queue of bits. The window is moved forward by advancing the head of the queue and
  * clearing the elements that become part of the tail of the queue. Hence,
  * no element is required to be shifted when the window moves forward.
+ * Operations involving ranges of elements (clearing the elements when the window
+ * moves forward, finding the first element that is not set, exporting the bitmap)
+ * process 64 elements at a time, so that their cost hardly depends on the window
+ * size, even for the 1024-MPDU windows of EHT.
  *
  * Example:
  *
@@ -57,6 +61,39 @@ namespace ns3
 class BlockAckWindow
 {
   public:
+    /**
+     * Proxy class returned to access an element of the window.
+     */
+    class Reference
+    {
+      public:
+        /**
+         * Set the value of the element.
+         *
+         * \param value the value of the element
+         * \return a reference to this object
+         */
+        Reference& operator=(bool value);
+        /**
+         * \return the value of the element
+         */
+        operator bool() const;
+
+      private:
+        friend class BlockAckWindow;
+
+        /**
+         * Constructor
+         *
+         * \param word the word storing the element
+         * \param mask the mask selecting the element in the word
+         */
+        Reference(uint64_t& word, uint64_t mask);
+
+        uint64_t& m_word; ///< the word storing the element
+        uint64_t m_mask;  ///< the mask selecting the element in the word
+    };
+
     /**
      * Constructor
      */
@@ -102,17 +139,41 @@ class BlockAckWindow
      * \return a reference to the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::reference At(std::size_t distance);
+    Reference At(std::size_t distance);
     /**
-     * Get a const reference to the element in the window having the given distance from
+     * Get the value of the element in the window having the given distance from
      * the current winStart. Note that the given distance must be less than the
      * window size.
      *
      * \param distance the given distance
-     * \return a const reference to the element in the window having the given distance
+     * \return the value of the element in the window having the given distance
      *         from the current winStart
      */
-    std::vector<bool>::const_reference At(std::size_t distance) const;
+    bool At(std::size_t distance) const;
+    /**
+     * Set the given number of consecutive elements, starting from the element having
+     * the given distance from the current winStart, to the given value. Note that the
+     * elements must all be in the window.
+     *
+     * \param distance the distance from the current winStart of the first element
+     * \param count the number of elements
+     * \param value the value of the elements
+     */
+    void Fill(std::size_t distance, std::size_t count, bool value);
+    /**
+     * \return the distance from the current winStart of the first element that is not
+     *         set, or the window size if all the elements are set
+     */
+    std::size_t FindFirstUnset() const;
+    /**
+     * Copy the window to the given bitmap: the element having distance i from the current
+     * winStart is copied to bit (i % 8) of byte (i / 8) of the bitmap, which is the format
+     * of the BlockAck bitmap. Bits corresponding to elements beyond the window size are
+     * cleared and elements beyond the size of the bitmap are not copied.
+     *
+     * \param bitmap the given bitmap
+     */
+    void CopyTo(std::vector<uint8_t>& bitmap) const;
     /**
      * Advance the current winStart by the given number of positions.
      *
@@ -121,9 +182,40 @@ class BlockAckWindow
     void Advance(std::size_t count);
 
   private:
-    uint16_t m_winStart;        ///< window start (sequence number)
-    std::vector<bool> m_window; ///< window
-    std::size_t m_head;         ///< index of winStart in the vector
+    /**
+     * Get the given number of consecutive elements, starting from the element having the
+     * given distance from the current winStart.
+     *
+     * \param distance the distance from the current winStart of the first element
+     * \param count the number of elements (at most 64); the elements must be in the window
+     * \return a word in which bit i is the element having distance (distance + i) from
+     *         the current winStart and bits beyond count are cleared
+     */
+    uint64_t GetBits(std::size_t distance, std::size_t count) const;
+    /**
+     * Get the given number of consecutive bits, starting from the given position in the
+     * array of words.
+     *
+     * \param pos the position of the first bit
+     * \param count the number of bits (at most 64)
+     * \return a word in which bit i is the bit at position (pos + i) and bits beyond
+     *         count are cleared
+     */
+    uint64_t GetArrayBits(std::size_t pos, std::size_t count) const;
+    /**
+     * Set the given number of consecutive bits, starting from the given position in the
+     * array of words, to the given value.
+     *
+     * \param pos the position of the first bit
+     * \param count the number of bits
+     * \param value the value of the bits
+     */
+    void FillArrayBits(std::size_t pos, std::size_t count, bool value);
+
+    uint16_t m_winStart;            ///< window start (sequence number)
+    std::size_t m_winSize;          ///< window size
+    std::vector<uint64_t> m_window; ///< window
+    std::size_t m_head;             ///< index of winStart in the array of bits
 };
 
 } // namespace ns3
@@ -723,7 +723,9 @@ ChannelAccessManager::DoRestartAccessTimeoutIfNeeded()
         if (m_accessTimeout.IsRunning() &&
             Simulator::GetDelayLeft(m_accessTimeout) > expectedBackoffDelay)
         {
-            m_accessTimeout.Cancel();
+            // remove the event rather than cancelling it, so that the event queue
+            // does not fill up with cancelled access timeouts
+            m_accessTimeout.Remove();
         }
         if (m_accessTimeout.IsExpired())
         {
@@ -952,7 +954,7 @@ ChannelAccessManager::ResetState()
     // Cancel timeout
     if (m_accessTimeout.IsRunning())
     {
-        m_accessTimeout.Cancel();
+        m_accessTimeout.Remove();
     }
 }
 
@@ -979,7 +981,7 @@ ChannelAccessManager::NotifySleepNow()
     // Cancel timeout
     if (m_accessTimeout.IsRunning())
     {
-        m_accessTimeout.Cancel();
+        m_accessTimeout.Remove();
     }
 
     // Reset backoffs
@@ -997,7 +999,7 @@ ChannelAccessManager::NotifyOffNow()
     // Cancel timeout
     if (m_accessTimeout.IsRunning())
     {
-        m_accessTimeout.Cancel();
+        m_accessTimeout.Remove();
     }
 
     // Reset backoffs
@@ -1100,7 +1102,7 @@ ChannelAccessManager::NotifyStartUsingOtherEmlsrLink()
     // Cancel timeout
     if (m_accessTimeout.IsRunning())
     {
-        m_accessTimeout.Cancel();
+        m_accessTimeout.Remove();
     }
     m_usingOtherEmlsrLink = true;
     UpdateLastIdlePeriod();
@@ -1092,6 +1092,17 @@ CtrlBAckResponseHeader::GetBitmap(std::size_t index) const
     return m_baInfo[index].m_bitmap;
 }
 
+void
+CtrlBAckResponseHeader::SetBitmap(const std::vector<uint8_t>& bitmap, std::size_t index)
+{
+    NS_ASSERT_MSG(m_baType.m_variant == BlockAckType::MULTI_STA || index == 0,
+                  "index can only be non null for Multi-STA Block Ack");
+    NS_ASSERT(index < m_baInfo.size());
+    NS_ASSERT(bitmap.size() == m_baType.m_bitmapLen[index]);
+
+    m_baInfo[index].m_bitmap = bitmap;
+}
+
 void
 CtrlBAckResponseHeader::ResetBitmap(std::size_t index)
 {
@@ -1708,6 +1719,15 @@ CtrlTriggerHeader::CtrlTriggerHeader(TriggerFrameType type, const WifiTxVector&
     for (auto& userInfo : txVector.GetHeMuUserInfoMap())
     {
         CtrlTriggerUserInfoField& ui = AddUserInfoField();
+        if (IsRaRuStaId(userInfo.first))
+        {
+            // every RA-RU in the TXVECTOR is allocated by a distinct User Info field
+            ui.SetAid12(0);
+            ui.SetRuAllocation(userInfo.second.ru);
+            ui.SetUlMcs(userInfo.second.mcs);
+            ui.SetRaRuInformation(1, false);
+            continue;
+        }
         ui.SetAid12(userInfo.first);
         ui.SetRuAllocation(userInfo.second.ru);
         ui.SetUlMcs(userInfo.second.mcs);
@@ -1999,17 +2019,26 @@ CtrlTriggerHeader::GetHeTbTxVector(uint16_t staId) const
 {
     NS_ABORT_MSG_IF(m_triggerType == TriggerFrameType::MU_RTS_TRIGGER,
                     "GetHeTbTxVector() cannot be used for MU-RTS");
-    auto userInfoIt = FindUserInfoWithAid(staId);
-    NS_ASSERT(userInfoIt != end());
+    ConstIterator userInfoIt;
+    HeRu::RuSpec ru;
+
+    if (IsRaRuStaId(staId))
+    {
+        std::tie(userInfoIt, ru) = GetRaRuAssociated(staId - RA_RU_STA_ID_BASE);
+    }
+    else
+    {
+        userInfoIt = FindUserInfoWithAid(staId);
+        NS_ASSERT(userInfoIt != end());
+        ru = userInfoIt->GetRuAllocation();
+    }
 
     WifiTxVector v;
     v.SetPreambleType(userInfoIt->GetPreambleType());
     v.SetChannelWidth(GetUlBandwidth());
     v.SetGuardInterval(GetGuardInterval());
     v.SetLength(GetUlLength());
-    v.SetHeMuUserInfo(
-        staId,
-        {userInfoIt->GetRuAllocation(), userInfoIt->GetUlMcs(), userInfoIt->GetNss()});
+    v.SetHeMuUserInfo(staId, {ru, userInfoIt->GetUlMcs(), userInfoIt->GetNss()});
     return v;
 }
 
@@ -2262,6 +2291,36 @@ CtrlTriggerHeader::FindUserInfoWithRaRuUnassociated() const
     return FindUserInfoWithAid(2045);
 }
 
+std::size_t
+CtrlTriggerHeader::GetNRaRusAssociated() const
+{
+    std::size_t nRaRus = 0;
+    for (auto it = FindUserInfoWithRaRuAssociated(); it != end();
+         it = FindUserInfoWithRaRuAssociated(std::next(it)))
+    {
+        nRaRus += it->GetNRaRus();
+    }
+    return nRaRus;
+}
+
+std::pair<CtrlTriggerHeader::ConstIterator, HeRu::RuSpec>
+CtrlTriggerHeader::GetRaRuAssociated(std::size_t index) const
+{
+    for (auto it = FindUserInfoWithRaRuAssociated(); it != end();
+         it = FindUserInfoWithRaRuAssociated(std::next(it)))
+    {
+        if (index < it->GetNRaRus())
+        {
+            // the RA-RUs allocated by a User Info field are contiguous and of the same size
+            auto ru = it->GetRuAllocation();
+            return {it, HeRu::RuSpec(ru.GetRuType(), ru.GetIndex() + index, ru.GetPrimary80MHz())};
+        }
+        index -= it->GetNRaRus();
+    }
+    NS_ABORT_MSG("RA-RU for associated stations not found");
+    return {end(), HeRu::RuSpec()};
+}
+
 bool
 CtrlTriggerHeader::IsValid() const
 {
@@ -450,6 +450,15 @@ class CtrlBAckResponseHeader : public Header
      * \return a const reference to the bitmap from the BlockAck response header
      */
     const std::vector<uint8_t>& GetBitmap(std::size_t index = 0) const;
+    /**
+     * Set the bitmap of the BlockAck response header. For Multi-STA Block Acks, set
+     * the bitmap included in the Per AID TID Info subfield identified by <i>index</i>.
+     * The size of the given bitmap must match the size of the bitmap of the header.
+     *
+     * \param bitmap the given bitmap
+     * \param index the index of the Per AID TID Info subfield (Multi-STA Block Ack only)
+     */
+    void SetBitmap(const std::vector<uint8_t>& bitmap, std::size_t index = 0);
 
     /**
      * Reset the bitmap to 0. For Multi-STA Block Acks, reset the bitmap included
@@ -1093,7 +1102,8 @@ class CtrlTriggerHeader : public Header
     /**
      * Get the TX vector that the station with the given STA-ID will use to send
      * the HE TB PPDU solicited by this Trigger Frame. Note that the TX power
-     * level is not set by this method.
+     * level is not set by this method. The given STA-ID may also identify a Random
+     * Access RU for associated stations (see RA_RU_STA_ID_BASE).
      *
      * \param staId the STA-ID of a station addressed by this Trigger Frame
      * \return the TX vector of the solicited HE TB PPDU
@@ -1312,6 +1322,24 @@ class CtrlTriggerHeader : public Header
      * criterion, if any, or an iterator indicating past-the-last User Info field.
      */
     ConstIterator FindUserInfoWithRaRuUnassociated() const;
+    /**
+     * \brief Get the number of Random Access RUs for associated stations allocated by
+     * this Trigger Frame.
+     *
+     * \return the number of RA-RUs for associated stations
+     */
+    std::size_t GetNRaRusAssociated() const;
+    /**
+     * Get the Random Access RU for associated stations identified by the given index
+     * (starting from 0) among all the RA-RUs for associated stations allocated by this
+     * Trigger Frame. A User Info field allocating N contiguous RA-RUs accounts for N
+     * consecutive indices.
+     *
+     * \param index the index of the RA-RU for associated stations
+     * \return a const iterator pointing to the User Info field allocating the given RA-RU
+     *         and the given RA-RU
+     */
+    std::pair<ConstIterator, HeRu::RuSpec> GetRaRuAssociated(std::size_t index) const;
     /**
      * Check the validity of this Trigger frame.
      * TODO Implement the checks listed in Section 27.5.3.2.3 of 802.11ax amendment
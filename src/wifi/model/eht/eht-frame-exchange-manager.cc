@@ -803,7 +803,8 @@ EhtFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
         if (hdr.GetAddr1() != m_self &&
             (!hdr.GetAddr1().IsBroadcast() || !m_staMac->IsAssociated() ||
              hdr.GetAddr2() != m_bssid // not sent by the AP this STA is associated with
-             || trigger.FindUserInfoWithAid(m_staMac->GetAssociationId()) == trigger.end()))
+             || (trigger.FindUserInfoWithAid(m_staMac->GetAssociationId()) == trigger.end() &&
+                 (!trigger.IsBasic() || trigger.GetNRaRusAssociated() == 0))))
         {
             return; // not addressed to us
         }
@@ -27,9 +27,11 @@
 #include "ns3/ap-wifi-mac.h"
 #include "ns3/erp-ofdm-phy.h"
 #include "ns3/log.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/recipient-block-ack-agreement.h"
 #include "ns3/snr-tag.h"
 #include "ns3/sta-wifi-mac.h"
+#include "ns3/uinteger.h"
 #include "ns3/wifi-mac-queue.h"
 #include "ns3/wifi-mac-trailer.h"
 
@@ -68,13 +70,42 @@ HeFrameExchangeManager::GetTypeId()
     static TypeId tid = TypeId("ns3::HeFrameExchangeManager")
                             .SetParent<VhtFrameExchangeManager>()
                             .AddConstructor<HeFrameExchangeManager>()
-                            .SetGroupName("Wifi");
+                            .SetGroupName("Wifi")
+                            .AddAttribute("OcwMin",
+                                          "The minimum OFDMA contention window used by a non-AP "
+                                          "STA to contend for Random Access RUs.",
+                                          UintegerValue(7),
+                                          MakeUintegerAccessor(&HeFrameExchangeManager::m_ocwMin),
+                                          MakeUintegerChecker<uint32_t>())
+                            .AddAttribute("OcwMax",
+                                          "The maximum OFDMA contention window used by a non-AP "
+                                          "STA to contend for Random Access RUs.",
+                                          UintegerValue(31),
+                                          MakeUintegerAccessor(&HeFrameExchangeManager::m_ocwMax),
+                                          MakeUintegerChecker<uint32_t>())
+                            .AddTraceSource("Obo",
+                                            "The OFDMA random access backoff counter of a non-AP "
+                                            "STA.",
+                                            MakeTraceSourceAccessor(&HeFrameExchangeManager::m_obo),
+                                            "ns3::TracedValueCallback::Uint32")
+                            .AddTraceSource("RaRuTx",
+                                            "A non-AP STA transmits a TB PPDU on a Random "
+                                            "Access RU.",
+                                            MakeTraceSourceAccessor(
+                                                &HeFrameExchangeManager::m_raRuTxTrace),
+                                            "ns3::HeFrameExchangeManager::RaRuTracedCallback")
+                            .AddTraceSource("RaRuRx",
+                                            "An AP receives a TB PPDU on a Random Access RU.",
+                                            MakeTraceSourceAccessor(
+                                                &HeFrameExchangeManager::m_raRuRxTrace),
+                                            "ns3::HeFrameExchangeManager::RaRuTracedCallback");
     return tid;
 }
 
 HeFrameExchangeManager::HeFrameExchangeManager()
     : m_intraBssNavEnd(0),
-      m_triggerFrameInAmpdu(false)
+      m_triggerFrameInAmpdu(false),
+      m_obo(0)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -123,9 +154,30 @@ HeFrameExchangeManager::DoDispose()
     m_txParams.Clear();
     m_muScheduler = nullptr;
     m_multiStaBaEvent.Cancel();
+    m_oboRng = nullptr;
     VhtFrameExchangeManager::DoDispose();
 }
 
+int64_t
+HeFrameExchangeManager::AssignStreams(int64_t stream)
+{
+    NS_LOG_FUNCTION(this << stream);
+    GetOboRng()->SetStream(stream);
+    return 1;
+}
+
+Ptr<UniformRandomVariable>
+HeFrameExchangeManager::GetOboRng()
+{
+    // the random variable is only created if needed, so as not to change the streams
+    // automatically assigned to the random variables of other objects
+    if (!m_oboRng)
+    {
+        m_oboRng = CreateObject<UniformRandomVariable>();
+    }
+    return m_oboRng;
+}
+
 void
 HeFrameExchangeManager::SetMultiUserScheduler(const Ptr<MultiUserScheduler> muScheduler)
 {
@@ -741,6 +793,16 @@ HeFrameExchangeManager::SendPsduMap()
         timerType = WifiTxTimer::WAIT_TB_PPDU_AFTER_BASIC_TF;
         responseTxVector = &acknowledgment->tbPpduTxVector;
         m_trigVector = GetTrigVector(m_muScheduler->GetUlMuInfo(m_linkId).trigger);
+
+        // record the set of RA-RUs allocated by this Trigger Frame
+        m_raRusToRespond.clear();
+        for (const auto& [staId, userInfo] : m_trigVector.GetHeMuUserInfoMap())
+        {
+            if (IsRaRuStaId(staId))
+            {
+                m_raRusToRespond.insert(userInfo.ru);
+            }
+        }
     }
     /*
      * BSRP Trigger Frame
@@ -764,6 +826,7 @@ HeFrameExchangeManager::SendPsduMap()
         txVector = trigger.GetHeTbTxVector(trigger.begin()->GetAid12());
         responseTxVector = &txVector;
         m_trigVector = GetTrigVector(m_muScheduler->GetUlMuInfo(m_linkId).trigger);
+        m_raRusToRespond.clear();
     }
     /*
      * TB PPDU solicited by a Basic Trigger Frame
@@ -1263,8 +1326,11 @@ HeFrameExchangeManager::GetTxDuration(uint32_t ppduPayloadSize,
             MpduAggregator::GetSizeIfAggregated(info->second.muBarSize, ppduPayloadSize);
     }
 
-    uint16_t staId = (txParams.m_txVector.IsDlMu() ? m_apMac->GetAssociationId(receiver, m_linkId)
-                                                   : m_staMac->GetAssociationId());
+    // the TXVECTOR of a TB PPDU only includes the user info of this station, which is
+    // identified by its AID or by the STA-ID of the Random Access RU it selected
+    uint16_t staId = (txParams.m_txVector.IsDlMu()
+                          ? m_apMac->GetAssociationId(receiver, m_linkId)
+                          : txParams.m_txVector.GetHeMuUserInfoMap().begin()->first);
     Time psduDuration = m_phy->CalculateTxDuration(ppduPayloadSize,
                                                    txParams.m_txVector,
                                                    m_phy->GetPhyBand(),
@@ -1282,13 +1348,14 @@ HeFrameExchangeManager::TbPpduTimeout(WifiPsduMap* psduMap, std::size_t nSolicit
     NS_ASSERT(psduMap);
     NS_ASSERT(IsTrigger(*psduMap));
 
-    // This method is called if some station(s) did not send a TB PPDU
-    NS_ASSERT(!staMissedTbPpduFrom.empty());
+    // This method is called if some station(s) did not send a TB PPDU or if no TB PPDU
+    // was received on some Random Access RU(s)
+    NS_ASSERT(!staMissedTbPpduFrom.empty() || !m_raRusToRespond.empty());
     NS_ASSERT(m_edca);
 
-    if (staMissedTbPpduFrom.size() == nSolicitedStations)
+    if (staMissedTbPpduFrom.size() == nSolicitedStations && !m_multiStaBaEvent.IsRunning())
     {
-        // no station replied, the transmission failed
+        // no station replied (not even on a RA-RU), the transmission failed
         m_edca->UpdateFailedCw(m_linkId);
 
         TransmissionFailed();
@@ -1386,6 +1453,12 @@ HeFrameExchangeManager::BlockAckAfterTbPpduTimeout(Ptr<WifiPsdu> psdu, const Wif
 
     MissedBlockAck(psdu, m_txParams.m_txVector, resetCw);
 
+    if (!m_psduMap.empty() && IsRaRuStaId(m_psduMap.begin()->first))
+    {
+        // failed transmission on a Random Access RU
+        UpdateOcw(false);
+    }
+
     // This is a PSDU sent in a TB PPDU. An HE STA resumes the EDCA backoff procedure
     // without modifying CW or the backoff counter for the associated EDCAF, after
     // transmission of an MPDU in a TB PPDU regardless of whether the STA has received
@@ -1452,10 +1525,22 @@ HeFrameExchangeManager::GetTrigVector(const CtrlTriggerHeader& trigger) const
     v.SetLength(trigger.GetUlLength());
     for (const auto& userInfoField : trigger)
     {
+        if (userInfoField.GetAid12() == 0 || userInfoField.GetAid12() == 2045)
+        {
+            // Random Access RUs are added below
+            continue;
+        }
         v.SetHeMuUserInfo(
             userInfoField.GetAid12(),
             {userInfoField.GetRuAllocation(), userInfoField.GetUlMcs(), userInfoField.GetNss()});
     }
+    const auto nRaRus = trigger.GetNRaRusAssociated();
+    NS_ABORT_MSG_IF(nRaRus > MAX_N_RA_RU_STA_IDS, "Too many RA-RUs: " << nRaRus);
+    for (std::size_t i = 0; i < nRaRus; ++i)
+    {
+        const auto [userInfoIt, ru] = trigger.GetRaRuAssociated(i);
+        v.SetHeMuUserInfo(RA_RU_STA_ID_BASE + i, {ru, userInfoIt->GetUlMcs(), 1});
+    }
     return v;
 }
 
@@ -1556,6 +1641,12 @@ HeFrameExchangeManager::SetTargetRssi(CtrlTriggerHeader& trigger) const
         m_phy->GetPowerDbm(GetWifiRemoteStationManager()->GetDefaultTxPowerLevel())));
     for (auto& userInfo : trigger)
     {
+        if (userInfo.GetAid12() == 0 || userInfo.GetAid12() == 2045)
+        {
+            // the stations transmitting on Random Access RUs are not known in advance
+            userInfo.SetUlTargetRssiMaxTxPower();
+            continue;
+        }
         const auto staList = m_apMac->GetStaList(m_linkId);
         auto itAidAddr = staList.find(userInfo.GetAid12());
         NS_ASSERT(itAidAddr != staList.end());
@@ -1740,9 +1831,10 @@ HeFrameExchangeManager::SendMultiStaBlockAck(const WifiTxParameters& txParams, T
 
 void
 HeFrameExchangeManager::ReceiveBasicTrigger(const CtrlTriggerHeader& trigger,
-                                            const WifiMacHeader& hdr)
+                                            const WifiMacHeader& hdr,
+                                            uint16_t staId)
 {
-    NS_LOG_FUNCTION(this << trigger << hdr);
+    NS_LOG_FUNCTION(this << trigger << hdr << staId);
     NS_ASSERT(trigger.IsBasic());
     NS_ASSERT(m_staMac && m_staMac->IsAssociated());
 
@@ -1760,8 +1852,8 @@ HeFrameExchangeManager::ReceiveBasicTrigger(const CtrlTriggerHeader& trigger,
 
     // create the sequence of TIDs to check
     std::vector<uint8_t> tids;
-    uint16_t staId = m_staMac->GetAssociationId();
-    AcIndex preferredAc = trigger.FindUserInfoWithAid(staId)->GetPreferredAc();
+    const uint16_t aid = m_staMac->GetAssociationId();
+    AcIndex preferredAc = trigger.FindUserInfoWithAid(aid)->GetPreferredAc();
     auto acIt = wifiAcList.find(preferredAc);
     for (uint8_t i = 0; i < 4; i++)
     {
@@ -1779,6 +1871,14 @@ HeFrameExchangeManager::ReceiveBasicTrigger(const CtrlTriggerHeader& trigger,
     Ptr<WifiPsdu> psdu;
     WifiTxParameters txParams;
     WifiTxVector tbTxVector = GetHeTbTxVector(trigger, hdr.GetAddr2());
+    if (staId != aid)
+    {
+        // the TB PPDU is sent on a Random Access RU, which is identified by the given STA-ID
+        auto& userInfoMap = tbTxVector.GetHeMuUserInfoMap();
+        auto node = userInfoMap.extract(aid);
+        node.key() = staId;
+        userInfoMap.insert(std::move(node));
+    }
     Time ppduDuration = HePhy::ConvertLSigLengthToHeTbPpduDuration(trigger.GetUlLength(),
                                                                    tbTxVector,
                                                                    m_phy->GetPhyBand());
@@ -1826,15 +1926,103 @@ HeFrameExchangeManager::ReceiveBasicTrigger(const CtrlTriggerHeader& trigger,
     if (psdu)
     {
         psdu->SetDuration(hdr.GetDuration() - m_phy->GetSifs() - ppduDuration);
+        if (staId != aid)
+        {
+            m_raRuTxTrace(m_self, tbTxVector.GetHeMuUserInfo(staId).ru);
+        }
         SendPsduMapWithProtection(WifiPsduMap{{staId, psdu}}, txParams);
     }
-    else
+    else if (staId == aid)
     {
-        // send QoS Null frames
+        // send QoS Null frames (but not on a Random Access RU)
         SendQosNullFramesInTbPpdu(trigger, hdr);
     }
 }
 
+void
+HeFrameExchangeManager::ReceiveBasicTriggerWithRaRus(const CtrlTriggerHeader& trigger,
+                                                     const WifiMacHeader& hdr)
+{
+    NS_LOG_FUNCTION(this << trigger << hdr);
+    NS_ASSERT(trigger.IsBasic());
+    NS_ASSERT(m_staMac && m_staMac->IsAssociated());
+
+    const auto nRaRus = static_cast<uint32_t>(trigger.GetNRaRusAssociated());
+    NS_ASSERT(nRaRus > 0);
+
+    // the OBO counter is only decremented by stations having frames to transmit
+    if (!HasFramesToSendOnRaRu(hdr.GetAddr2()))
+    {
+        NS_LOG_DEBUG("No frame to transmit on a RA-RU");
+        return;
+    }
+
+    if (!m_ocw)
+    {
+        m_ocw = m_ocwMin;
+        m_obo = GetOboRng()->GetInteger(0, *m_ocw);
+    }
+
+    if (m_obo > nRaRus)
+    {
+        m_obo = m_obo - nRaRus;
+        NS_LOG_DEBUG("Decremented OBO counter to " << m_obo);
+        return;
+    }
+
+    m_obo = 0;
+    const auto index = GetOboRng()->GetInteger(0, nRaRus - 1);
+    const auto [userInfoIt, ru] = trigger.GetRaRuAssociated(index);
+    NS_LOG_DEBUG("Selected RA-RU " << ru);
+
+    // make the selected RA-RU look like an RU allocated to this station
+    CtrlTriggerHeader raRuTrigger = trigger;
+    auto raRuUserInfoIt =
+        std::next(raRuTrigger.begin(), std::distance(trigger.begin(), userInfoIt));
+    raRuUserInfoIt->SetAid12(m_staMac->GetAssociationId());
+    raRuUserInfoIt->SetRuAllocation(ru);
+    raRuUserInfoIt->SetSsAllocation(1, 1);
+
+    ReceiveBasicTrigger(raRuTrigger, hdr, RA_RU_STA_ID_BASE + index);
+}
+
+bool
+HeFrameExchangeManager::HasFramesToSendOnRaRu(Mac48Address receiver) const
+{
+    auto recipient = GetWifiRemoteStationManager()->GetMldAddress(receiver).value_or(receiver);
+
+    for (uint8_t tid = 0; tid < 8; tid++)
+    {
+        if (m_mac->GetBaAgreementEstablishedAsOriginator(receiver, tid) &&
+            m_mac->GetQosTxop(tid)->PeekNextMpdu(m_linkId, tid, recipient))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+HeFrameExchangeManager::UpdateOcw(bool success)
+{
+    NS_LOG_FUNCTION(this << success);
+    NS_ASSERT(m_ocw);
+
+    // Sec. 26.5.4 of 802.11ax-2021
+    m_ocw = success ? m_ocwMin : std::min(2 * *m_ocw + 1, m_ocwMax);
+    m_obo = GetOboRng()->GetInteger(0, *m_ocw);
+    NS_LOG_DEBUG("OCW=" << *m_ocw << " OBO=" << m_obo);
+}
+
+bool
+HeFrameExchangeManager::IsTbPpduOnRaRu(Mac48Address sender, const WifiTxVector& txVector) const
+{
+    NS_ASSERT(m_apMac);
+    return txVector.GetHeMuUserInfoMap().size() == 1 &&
+           IsRaRuStaId(txVector.GetHeMuUserInfoMap().cbegin()->first) &&
+           GetWifiRemoteStationManager()->IsAssociated(sender);
+}
+
 void
 HeFrameExchangeManager::SendQosNullFramesInTbPpdu(const CtrlTriggerHeader& trigger,
                                                   const WifiMacHeader& hdr)
@@ -2205,12 +2393,24 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
         auto acknowledgment = static_cast<WifiUlMuMultiStaBa*>(m_txParams.m_acknowledgment.get());
         std::size_t index = acknowledgment->baType.m_bitmapLen.size();
 
-        if (m_txTimer.GetStasExpectedToRespond().count(sender) == 0)
+        const auto onRaRu = IsTbPpduOnRaRu(sender, txVector);
+
+        if (m_txTimer.GetStasExpectedToRespond().count(sender) == 0 && !onRaRu)
         {
             NS_LOG_WARN("Received a TB PPDU from an unexpected station: " << sender);
             return;
         }
 
+        // the SNR is reported in the Multi-STA BlockAck for the AID of the sender
+        const uint16_t staId = onRaRu ? m_apMac->GetAssociationId(sender, m_linkId)
+                                      : txVector.GetHeMuUserInfoMap().begin()->first;
+        if (onRaRu && !inAmpdu)
+        {
+            NS_LOG_DEBUG("Received a TB PPDU on a RA-RU from " << sender);
+            m_raRuRxTrace(sender, txVector.GetHeMuUserInfoMap().begin()->second.ru);
+            m_raRusToRespond.erase(txVector.GetHeMuUserInfoMap().begin()->second.ru);
+        }
+
         if (hdr.IsBlockAckReq())
         {
             NS_LOG_DEBUG("Received a BlockAckReq in a TB PPDU from " << sender);
@@ -2228,7 +2428,6 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
             acknowledgment->stationsReceivingMultiStaBa.emplace(std::make_pair(sender, tid), index);
             acknowledgment->baType.m_bitmapLen.push_back(
                 m_mac->GetBaTypeAsRecipient(sender, tid).m_bitmapLen.at(0));
-            uint16_t staId = txVector.GetHeMuUserInfoMap().begin()->first;
             m_muSnrTag.Set(staId, rxSignalInfo.snr);
         }
         else if (hdr.IsQosData() && !inAmpdu && hdr.GetQosAckPolicy() == WifiMacHeader::NORMAL_ACK)
@@ -2241,7 +2440,6 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
             // Acknowledgment context of Multi-STA Block Acks
             acknowledgment->stationsReceivingMultiStaBa.emplace(std::make_pair(sender, tid), index);
             acknowledgment->baType.m_bitmapLen.push_back(0);
-            uint16_t staId = txVector.GetHeMuUserInfoMap().begin()->first;
             m_muSnrTag.Set(staId, rxSignalInfo.snr);
         }
         else if (!(hdr.IsQosData() && !hdr.HasData() && !inAmpdu))
@@ -2268,7 +2466,9 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
         // remove the sender from the set of stations that are expected to send a TB PPDU
         m_txTimer.GotResponseFrom(sender);
 
-        if (m_txTimer.GetStasExpectedToRespond().empty())
+        // other stations may still send a TB PPDU on the RA-RUs on which no TB PPDU
+        // has been received yet
+        if (m_txTimer.GetStasExpectedToRespond().empty() && m_raRusToRespond.empty())
         {
             // we do not expect any other BlockAck frame
             m_txTimer.Cancel();
@@ -2478,6 +2678,11 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
             MuSnrTag tag;
             mpdu->GetPacket()->PeekPacketTag(tag);
 
+            // the PSDU may have been sent on a Random Access RU, hence the STA-ID in the PSDU
+            // map may differ from our AID
+            NS_ABORT_IF(m_psduMap.size() != 1);
+            const auto tbPsdu = m_psduMap.begin()->second;
+
             // notify the Block Ack Manager
             for (const auto& index : indices)
             {
@@ -2486,8 +2691,7 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                 if (blockAck.GetAckType(index) && tid < 8)
                 {
                     // Acknowledgment context
-                    NS_ABORT_IF(m_psduMap.empty() || m_psduMap.begin()->first != staId);
-                    GetBaManager(tid)->NotifyGotAck(m_linkId, *m_psduMap.at(staId)->begin());
+                    GetBaManager(tid)->NotifyGotAck(m_linkId, *tbPsdu->begin());
                 }
                 else
                 {
@@ -2496,8 +2700,7 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                     {
                         // All-ack context, we need to determine the actual TID(s) of the PSDU
                         NS_ASSERT(indices.size() == 1);
-                        NS_ABORT_IF(m_psduMap.empty() || m_psduMap.begin()->first != staId);
-                        std::set<uint8_t> tids = m_psduMap.at(staId)->GetTids();
+                        std::set<uint8_t> tids = tbPsdu->GetTids();
                         NS_ABORT_MSG_IF(tids.size() > 1, "Multi-TID A-MPDUs not supported yet");
                         tid = *tids.begin();
                     }
@@ -2516,14 +2719,14 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                                                                        m_txParams.m_txVector);
                 }
 
-                if (m_psduMap.at(staId)->GetHeader(0).IsQosData() &&
+                if (tbPsdu->GetHeader(0).IsQosData() &&
                     (blockAck.GetAckType(index) // Ack or All-ack context
                      || std::any_of(blockAck.GetBitmap(index).begin(),
                                     blockAck.GetBitmap(index).end(),
                                     [](uint8_t b) { return b != 0; })))
                 {
-                    NS_ASSERT(m_psduMap.at(staId)->GetHeader(0).HasData());
-                    NS_ASSERT(m_psduMap.at(staId)->GetHeader(0).GetQosTid() == tid);
+                    NS_ASSERT(tbPsdu->GetHeader(0).HasData());
+                    NS_ASSERT(tbPsdu->GetHeader(0).GetQosTid() == tid);
                     // the station has received a response from the AP for the HE TB PPDU
                     // transmitted in response to a Basic Trigger Frame and at least one
                     // MPDU was acknowledged. Therefore, it needs to update the access
@@ -2532,6 +2735,12 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                 }
             }
 
+            if (IsRaRuStaId(m_psduMap.begin()->first))
+            {
+                // successful transmission on a Random Access RU
+                UpdateOcw(true);
+            }
+
             // cancel the timer
             m_txTimer.Cancel();
             m_channelAccessManager->NotifyAckTimeoutResetNow();
@@ -2575,7 +2784,8 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
             if (hdr.GetAddr1() != m_self &&
                 (!hdr.GetAddr1().IsBroadcast() || !m_staMac->IsAssociated() ||
                  hdr.GetAddr2() != m_bssid // not sent by the AP this STA is associated with
-                 || trigger.FindUserInfoWithAid(m_staMac->GetAssociationId()) == trigger.end()))
+                 || (trigger.FindUserInfoWithAid(m_staMac->GetAssociationId()) == trigger.end() &&
+                     (!trigger.IsBasic() || trigger.GetNRaRusAssociated() == 0))))
             {
                 // not addressed to us
                 return;
@@ -2629,13 +2839,23 @@ HeFrameExchangeManager::ReceiveMpdu(Ptr<const WifiMpdu> mpdu,
                                     hdr.GetDuration(),
                                     rxSignalInfo.snr);
             }
+            else if (trigger.IsBasic() && trigger.FindUserInfoWithAid(staId) == trigger.end())
+            {
+                // no RU is allocated to us, contend for the Random Access RUs
+                Simulator::Schedule(m_phy->GetSifs(),
+                                    &HeFrameExchangeManager::ReceiveBasicTriggerWithRaRus,
+                                    this,
+                                    trigger,
+                                    hdr);
+            }
             else if (trigger.IsBasic())
             {
                 Simulator::Schedule(m_phy->GetSifs(),
                                     &HeFrameExchangeManager::ReceiveBasicTrigger,
                                     this,
                                     trigger,
-                                    hdr);
+                                    hdr,
+                                    staId);
             }
             else if (trigger.IsBsrp())
             {
@@ -2678,13 +2898,20 @@ HeFrameExchangeManager::EndReceiveAmpdu(Ptr<const WifiPsdu> psdu,
         auto acknowledgment = static_cast<WifiUlMuMultiStaBa*>(m_txParams.m_acknowledgment.get());
         std::size_t index = acknowledgment->baType.m_bitmapLen.size();
 
-        if (m_txTimer.GetStasExpectedToRespond().count(sender) == 0)
+        const auto onRaRu = IsTbPpduOnRaRu(sender, txVector);
+
+        if (m_txTimer.GetStasExpectedToRespond().count(sender) == 0 && !onRaRu)
         {
             NS_LOG_WARN("Received a TB PPDU from an unexpected station: " << sender);
             return;
         }
 
         NS_LOG_DEBUG("Received an A-MPDU in a TB PPDU from " << sender << " (" << *psdu << ")");
+        if (onRaRu)
+        {
+            m_raRuRxTrace(sender, txVector.GetHeMuUserInfoMap().begin()->second.ru);
+            m_raRusToRespond.erase(txVector.GetHeMuUserInfoMap().begin()->second.ru);
+        }
 
         if (std::any_of(tids.begin(), tids.end(), [&psdu](uint8_t tid) {
                 return psdu->GetAckPolicyForTid(tid) == WifiMacHeader::NORMAL_ACK;
@@ -2709,7 +2936,9 @@ HeFrameExchangeManager::EndReceiveAmpdu(Ptr<const WifiPsdu> psdu,
                         m_mac->GetBaTypeAsRecipient(sender, tid).m_bitmapLen.at(0));
                 }
             }
-            uint16_t staId = txVector.GetHeMuUserInfoMap().begin()->first;
+            // the SNR is reported in the Multi-STA BlockAck for the AID of the sender
+            uint16_t staId = onRaRu ? m_apMac->GetAssociationId(sender, m_linkId)
+                                    : txVector.GetHeMuUserInfoMap().begin()->first;
             m_muSnrTag.Set(staId, rxSignalInfo.snr);
         }
 
@@ -2726,7 +2955,9 @@ HeFrameExchangeManager::EndReceiveAmpdu(Ptr<const WifiPsdu> psdu,
         // remove the sender from the set of stations that are expected to send a TB PPDU
         m_txTimer.GotResponseFrom(sender);
 
-        if (m_txTimer.GetStasExpectedToRespond().empty())
+        // other stations may still send a TB PPDU on the RA-RUs on which no TB PPDU
+        // has been received yet
+        if (m_txTimer.GetStasExpectedToRespond().empty() && m_raRusToRespond.empty())
         {
             // we do not expect any other BlockAck frame
             m_txTimer.Cancel();
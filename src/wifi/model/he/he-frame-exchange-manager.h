@@ -22,9 +22,12 @@
 
 #include "mu-snr-tag.h"
 
+#include "ns3/traced-value.h"
 #include "ns3/vht-frame-exchange-manager.h"
 
 #include <map>
+#include <optional>
+#include <set>
 #include <unordered_map>
 
 namespace ns3
@@ -34,6 +37,7 @@ class MultiUserScheduler;
 class ApWifiMac;
 class StaWifiMac;
 class CtrlTriggerHeader;
+class UniformRandomVariable;
 
 /**
  * Map of PSDUs indexed by STA-ID
@@ -139,6 +143,24 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
      */
     bool UlMuCsMediumIdle(const CtrlTriggerHeader& trigger) const;
 
+    /**
+     * Assign a fixed random variable stream number to the random variables used by this
+     * Frame Exchange Manager (i.e., the one used to draw the OFDMA random access backoff
+     * counter). Return the number of streams (possibly zero) that have been assigned.
+     *
+     * \param stream first stream index to use
+     * \return the number of stream indices assigned by this Frame Exchange Manager
+     */
+    int64_t AssignStreams(int64_t stream);
+
+    /**
+     * TracedCallback signature for HE TB PPDUs transmitted or received on a Random Access RU.
+     *
+     * \param address the MAC address of the station transmitting the HE TB PPDU
+     * \param ru the Random Access RU
+     */
+    typedef void (*RaRuTracedCallback)(Mac48Address address, HeRu::RuSpec ru);
+
   protected:
     void DoDispose() override;
     void Reset() override;
@@ -358,7 +380,49 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
      * \param trigger the Basic Trigger Frame content
      * \param hdr the MAC header of the Basic Trigger Frame
      */
-    void ReceiveBasicTrigger(const CtrlTriggerHeader& trigger, const WifiMacHeader& hdr);
+    void ReceiveBasicTrigger(const CtrlTriggerHeader& trigger,
+                             const WifiMacHeader& hdr,
+                             uint16_t staId);
+
+    /**
+     * Take the necessary actions when receiving a Basic Trigger Frame that does not
+     * allocate an RU to this station but allocates Random Access RUs for associated
+     * stations. The UL OFDMA-based random access (UORA) procedure is performed: if this
+     * station has frames to transmit, the OFDMA random access backoff (OBO) counter is
+     * decremented by the number of RA-RUs and, if it reaches zero, a randomly selected
+     * RA-RU is used to transmit a TB PPDU (Sec. 26.5.4 of 802.11ax-2021).
+     *
+     * \param trigger the Basic Trigger Frame content
+     * \param hdr the MAC header of the Basic Trigger Frame
+     */
+    void ReceiveBasicTriggerWithRaRus(const CtrlTriggerHeader& trigger, const WifiMacHeader& hdr);
+
+    /**
+     * \param receiver the address of the AP that sent a Basic Trigger Frame
+     * \return whether this station has frames that can be transmitted to the given AP in
+     *         a TB PPDU sent on a Random Access RU
+     */
+    bool HasFramesToSendOnRaRu(Mac48Address receiver) const;
+
+    /**
+     * Update the OFDMA contention window (OCW) after a transmission on a Random Access RU
+     * and draw a new value for the OFDMA random access backoff (OBO) counter.
+     *
+     * \param success whether the transmission on the RA-RU was successful
+     */
+    void UpdateOcw(bool success);
+
+    /**
+     * \return the random variable used to draw the OBO counter, which is created if needed
+     */
+    Ptr<UniformRandomVariable> GetOboRng();
+
+    /**
+     * \param sender the station that sent a TB PPDU solicited by a Basic Trigger Frame
+     * \param txVector the TXVECTOR of the received TB PPDU
+     * \return whether the TB PPDU was sent on a Random Access RU by an associated station
+     */
+    bool IsTbPpduOnRaRu(Mac48Address sender, const WifiTxVector& txVector) const;
 
     /**
      * Respond to a MU-BAR Trigger Frame (if permitted by UL MU CS mechanism).
@@ -380,6 +444,17 @@ class HeFrameExchangeManager : public VhtFrameExchangeManager
     EventId m_multiStaBaEvent;             //!< Sending a Multi-STA BlockAck event
     MuSnrTag m_muSnrTag;                   //!< Tag to attach to Multi-STA BlockAck frames
     bool m_triggerFrameInAmpdu;            //!< True if the received A-MPDU contains an MU-BAR
+    uint32_t m_ocwMin;                     //!< minimum OFDMA contention window
+    uint32_t m_ocwMax;                     //!< maximum OFDMA contention window
+    std::optional<uint32_t> m_ocw;         //!< OFDMA contention window (if UORA started)
+    TracedValue<uint32_t> m_obo;           //!< OFDMA random access backoff counter
+    Ptr<UniformRandomVariable> m_oboRng;   //!< random variable to draw the OBO counter
+
+    std::set<HeRu::RuSpec> m_raRusToRespond; //!< RA-RUs allocated by the last Basic Trigger
+                                             //!< Frame on which no TB PPDU was received yet
+
+    TracedCallback<Mac48Address, HeRu::RuSpec> m_raRuTxTrace; //!< TX on RA-RU trace
+    TracedCallback<Mac48Address, HeRu::RuSpec> m_raRuRxTrace; //!< RX on RA-RU trace
 };
 
 } // namespace ns3
@@ -382,7 +382,15 @@ HePhy::StartReceivePreamble(Ptr<const WifiPpdu> ppdu,
                         << GetDuration(WIFI_PPDU_FIELD_TRAINING, txVector).As(Time::NS));
             auto event = CreateInterferenceEvent(ppdu, rxDuration, rxPowersW, !hePortionStarted);
             uint16_t staId = GetStaId(ppdu);
-            NS_ASSERT(m_beginMuPayloadRxEvents.find(staId) == m_beginMuPayloadRxEvents.end());
+            if (m_beginMuPayloadRxEvents.find(staId) != m_beginMuPayloadRxEvents.end())
+            {
+                // this can only happen if multiple stations selected the same Random Access
+                // RU, in which case the HE TB PPDUs collide
+                NS_ASSERT(IsRaRuStaId(staId));
+                NS_LOG_INFO("Consider HE portion of the PPDU as interference since another "
+                            "HE TB PPDU is being received on the same RA-RU");
+                return;
+            }
             m_beginMuPayloadRxEvents[staId] =
                 Simulator::Schedule(GetDuration(WIFI_PPDU_FIELD_TRAINING, txVector),
                                     &HePhy::StartReceiveMuPayload,
@@ -286,7 +286,9 @@ MultiUserScheduler::GetTriggerFrame(const CtrlTriggerHeader& trigger, uint8_t li
     packet->AddHeader(trigger);
 
     Mac48Address receiver = Mac48Address::GetBroadcast();
-    if (trigger.GetNUserInfoFields() == 1)
+    // a Trigger Frame allocating Random Access RUs is sent to the broadcast address
+    if (trigger.GetNUserInfoFields() == 1 && trigger.begin()->GetAid12() != 0 &&
+        trigger.begin()->GetAid12() != 2045)
     {
         auto aid = trigger.begin()->GetAid12();
         auto aidAddrMapIt = m_apMac->GetStaList(linkId).find(aid);
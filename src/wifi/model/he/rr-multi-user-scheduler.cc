@@ -79,6 +79,15 @@ RrMultiUserScheduler::GetTypeId()
                 UintegerValue(500),
                 MakeUintegerAccessor(&RrMultiUserScheduler::m_ulPsduSize),
                 MakeUintegerChecker<uint32_t>())
+            .AddAttribute("NRaRus",
+                          "The number of Random Access RUs for associated stations to allocate "
+                          "in every Basic Trigger Frame. If non-zero, Basic Trigger Frames are "
+                          "sent even if no station can be solicited, so that stations that "
+                          "have not reported their buffer status can transmit via UL OFDMA-based "
+                          "random access (UORA).",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&RrMultiUserScheduler::m_nRaRus),
+                          MakeUintegerChecker<uint8_t>(0, MAX_N_RA_RU_STA_IDS))
             .AddAttribute("UseCentral26TonesRus",
                           "If enabled, central 26-tone RUs are allocated, too, when the "
                           "selected RU type is at least 52 tones.",
@@ -394,16 +403,26 @@ RrMultiUserScheduler::TrySendingBasicTf()
                m_apMac->GetMaxBufferStatus(info.address) > 0;
     });
 
+    if (m_nRaRus > 0)
+    {
+        AddRaRus(txVector);
+    }
+
     if (txVector.GetHeMuUserInfoMap().empty())
     {
         NS_LOG_DEBUG("No suitable station found");
         return TxFormat::DL_MU_TX;
     }
 
-    uint32_t maxBufferSize = 0;
+    // stations transmitting on RA-RUs are solicited to send a PSDU of m_ulPsduSize bytes
+    uint32_t maxBufferSize = (m_nRaRus > 0 ? m_ulPsduSize : 0);
 
     for (const auto& candidate : txVector.GetHeMuUserInfoMap())
     {
+        if (IsRaRuStaId(candidate.first))
+        {
+            continue;
+        }
         auto address = m_apMac->GetMldOrLinkAddressByAid(candidate.first);
         NS_ASSERT_MSG(address, "AID " << candidate.first << " not found");
 
@@ -476,13 +495,15 @@ RrMultiUserScheduler::TrySendingBasicTf()
     }
 
     // Compute the time taken by each station to transmit a frame of maxBufferSize size
+    // (m_ulPsduSize bytes for stations transmitting on RA-RUs)
     Time bufferTxTime = Seconds(0);
-    for (const auto& userInfo : m_trigger)
+    for (const auto& [staId, userInfo] : txVector.GetHeMuUserInfoMap())
     {
-        Time duration = WifiPhy::CalculateTxDuration(maxBufferSize,
-                                                     txVector,
-                                                     m_apMac->GetWifiPhy(m_linkId)->GetPhyBand(),
-                                                     userInfo.GetAid12());
+        Time duration =
+            WifiPhy::CalculateTxDuration(IsRaRuStaId(staId) ? m_ulPsduSize : maxBufferSize,
+                                         txVector,
+                                         m_apMac->GetWifiPhy(m_linkId)->GetPhyBand(),
+                                         staId);
         bufferTxTime = Max(bufferTxTime, duration);
     }
 
@@ -496,13 +517,13 @@ RrMultiUserScheduler::TrySendingBasicTf()
         // maxDuration may be a too short time. If it does not allow any station to
         // transmit at least m_ulPsduSize bytes, give up the UL MU transmission for now
         Time minDuration = Seconds(0);
-        for (const auto& userInfo : m_trigger)
+        for (const auto& [staId, userInfo] : txVector.GetHeMuUserInfoMap())
         {
             Time duration =
                 WifiPhy::CalculateTxDuration(m_ulPsduSize,
                                              txVector,
                                              m_apMac->GetWifiPhy(m_linkId)->GetPhyBand(),
-                                             userInfo.GetAid12());
+                                             staId);
             minDuration = (minDuration.IsZero() ? duration : Min(minDuration, duration));
         }
 
@@ -819,6 +840,57 @@ RrMultiUserScheduler::FinalizeTxVector(WifiTxVector& txVector)
     m_candidates.erase(candidateIt, m_candidates.end());
 }
 
+void
+RrMultiUserScheduler::AddRaRus(WifiTxVector& txVector)
+{
+    // Do not log txVector because GetTxVectorForUlMu() may have left RUs undefined
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(txVector.GetHeMuUserInfoMap().size() == m_candidates.size());
+
+    // compute the RU size so that candidate stations and RA-RUs are allocated
+    // equal-sized RUs (central 26-tone RUs are not allocated)
+    const auto nStations = m_candidates.size();
+    std::size_t nRus = nStations + m_nRaRus;
+    std::size_t nCentral26TonesRus;
+    HeRu::RuType ruType =
+        HeRu::GetEqualSizedRusForStations(m_allowedWidth, nRus, nCentral26TonesRus);
+    const auto nRaRus =
+        std::min<std::size_t>(m_nRaRus, nRus - std::min<std::size_t>(nStations, 1));
+    const auto nStaRus = std::min(nStations, nRus - nRaRus);
+
+    NS_LOG_DEBUG(nStaRus << " stations and " << nRaRus << " RA-RUs are being assigned a "
+                         << ruType << " RU");
+
+    // re-allocate RUs to candidate stations
+    WifiTxVector::HeMuUserInfoMap heMuUserInfoMap;
+    std::swap(heMuUserInfoMap, txVector.GetHeMuUserInfoMap());
+
+    auto candidateIt = m_candidates.begin(); // iterator over the list of candidate receivers
+    auto ruSet = HeRu::GetRusOfType(m_allowedWidth, ruType);
+    auto ruSetIt = ruSet.begin();
+
+    for (std::size_t i = 0; i < nStaRus; i++)
+    {
+        NS_ASSERT(candidateIt != m_candidates.end());
+        auto mapIt = heMuUserInfoMap.find(candidateIt->first->aid);
+        NS_ASSERT(mapIt != heMuUserInfoMap.end());
+
+        txVector.SetHeMuUserInfo(mapIt->first,
+                                 {*ruSetIt++, mapIt->second.mcs, mapIt->second.nss});
+        candidateIt++;
+    }
+
+    // remove candidates that will not be served
+    m_candidates.erase(candidateIt, m_candidates.end());
+
+    // the stations that will transmit on the RA-RUs are not known in advance, hence
+    // the most robust MCS is used
+    for (std::size_t i = 0; i < nRaRus; i++)
+    {
+        txVector.SetHeMuUserInfo(RA_RU_STA_ID_BASE + i, {*ruSetIt++, 0, 1});
+    }
+}
+
 void
 RrMultiUserScheduler::UpdateCredits(std::list<MasterInfo>& staList,
                                     Time txDuration,
@@ -138,6 +138,17 @@ class RrMultiUserScheduler : public MultiUserScheduler
      * \param txVector the given TXVECTOR
      */
     void FinalizeTxVector(WifiTxVector& txVector);
+    /**
+     * Add Random Access RUs for associated stations to the given TXVECTOR, which is used
+     * to construct a Basic Trigger Frame and contains an HeMuUserInfo entry for each
+     * candidate station (possibly none). The candidate stations and the RA-RUs are
+     * allocated equal-sized RUs; RA-RUs do not prevent the allocation of an RU to at
+     * least one candidate station. The set of candidate stations is updated by removing
+     * stations that are not allocated an RU.
+     *
+     * \param txVector the given TXVECTOR
+     */
+    void AddRaRus(WifiTxVector& txVector);
     /**
      * Update credits of the stations in the given list considering that a PPDU having
      * the given duration is being transmitted or solicited by using the given TXVECTOR.
@@ -162,6 +173,7 @@ class RrMultiUserScheduler : public MultiUserScheduler
     bool m_enableBsrp;           //!< send a BSRP before an UL MU transmission
     bool m_useCentral26TonesRus; //!< whether to allocate central 26-tone RUs
     uint32_t m_ulPsduSize;       //!< the size in byte of the solicited PSDU
+    uint8_t m_nRaRus;            //!< number of RA-RUs to allocate in Basic Trigger Frames
     std::map<AcIndex, std::list<MasterInfo>>
         m_staListDl;                       //!< Per-AC list of stations (next to serve for DL first)
     std::list<MasterInfo> m_staListUl;     //!< List of stations to serve for UL
@@ -283,16 +283,43 @@ HtPhy::GetPayloadDuration(uint32_t size,
                           double& totalAmpduNumSymbols,
                           uint16_t staId) const
 {
+    return CalculatePayloadDuration(size,
+                                    GetDataFieldParams(txVector, band, staId),
+                                    mpdutype,
+                                    incFlag,
+                                    totalAmpduSize,
+                                    totalAmpduNumSymbols);
+}
+
+HtPhy::DataFieldParams
+HtPhy::GetDataFieldParams(const WifiTxVector& txVector, WifiPhyBand band, uint16_t staId) const
+{
+    DataFieldParams params;
     WifiMode payloadMode = txVector.GetMode(staId);
-    uint8_t stbc = txVector.IsStbc() ? 2 : 1; // corresponding to m_STBC in Nsym computation (see
-                                              // IEEE 802.11-2016, equations (19-32) and (21-62))
-    uint8_t nes = GetNumberBccEncoders(txVector);
+    params.stbc = txVector.IsStbc() ? 2 : 1; // corresponding to m_STBC in Nsym computation (see
+                                             // IEEE 802.11-2016, equations (19-32) and (21-62))
+    params.nes = GetNumberBccEncoders(txVector);
     // TODO: Update station managers to consider GI capabilities
-    Time symbolDuration = GetSymbolDuration(txVector);
+    params.symbolDuration = GetSymbolDuration(txVector);
+    params.numDataBitsPerSymbol = payloadMode.GetDataRate(txVector, staId) *
+                                  params.symbolDuration.GetNanoSeconds() / 1e9;
+    params.service = GetNumberServiceBits();
+    params.signalExtension = GetSignalExtension(band);
+    return params;
+}
 
-    double numDataBitsPerSymbol =
-        payloadMode.GetDataRate(txVector, staId) * symbolDuration.GetNanoSeconds() / 1e9;
-    uint8_t service = GetNumberServiceBits();
+Time
+HtPhy::CalculatePayloadDuration(uint32_t size,
+                                const DataFieldParams& params,
+                                MpduType mpdutype,
+                                bool incFlag,
+                                uint32_t& totalAmpduSize,
+                                double& totalAmpduNumSymbols)
+{
+    const uint8_t stbc = params.stbc;
+    const uint8_t nes = params.nes;
+    const uint8_t service = params.service;
+    const double numDataBitsPerSymbol = params.numDataBitsPerSymbol;
 
     double numSymbols = 0;
     switch (mpdutype)
@@ -345,10 +372,10 @@ HtPhy::GetPayloadDuration(uint32_t size,
     }
 
     Time payloadDuration =
-        FemtoSeconds(static_cast<uint64_t>(numSymbols * symbolDuration.GetFemtoSeconds()));
+        FemtoSeconds(static_cast<uint64_t>(numSymbols * params.symbolDuration.GetFemtoSeconds()));
     if (mpdutype == NORMAL_MPDU || mpdutype == SINGLE_MPDU || mpdutype == LAST_MPDU_IN_AGGREGATE)
     {
-        payloadDuration += GetSignalExtension(band);
+        payloadDuration += params.signalExtension;
     }
     return payloadDuration;
 }
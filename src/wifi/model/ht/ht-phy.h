@@ -84,6 +84,54 @@ class HtPhy : public OfdmPhy
                             const WifiTxVector& txVector,
                             Time ppduDuration) override;
 
+    /**
+     * The parameters that, along with the PSDU size, determine the duration of
+     * the Data field (see IEEE 802.11-2016, equations (19-32) and (21-62)).
+     * They only depend on the TXVECTOR and on the band, hence they can be
+     * computed once and reused for any PSDU size.
+     */
+    struct DataFieldParams
+    {
+        double numDataBitsPerSymbol; //!< number of data bits per OFDM symbol
+        Time symbolDuration;         //!< OFDM symbol duration (including GI)
+        uint8_t stbc;                //!< 2 if STBC is used, 1 otherwise
+        uint8_t nes;                 //!< number of BCC encoders
+        uint8_t service;             //!< number of service bits
+        Time signalExtension;        //!< signal extension duration
+    };
+
+    /**
+     * \param txVector the TXVECTOR used for the transmission
+     * \param band the frequency band
+     * \param staId the STA-ID of the PSDU (only used for MU PPDUs)
+     * \return the parameters determining the duration of the Data field
+     */
+    DataFieldParams GetDataFieldParams(const WifiTxVector& txVector,
+                                       WifiPhyBand band,
+                                       uint16_t staId) const;
+
+    /**
+     * Compute the duration of the Data field carrying the given number of bytes.
+     * This is the closed-form counterpart of GetPayloadDuration() to be used when
+     * the parameters of the Data field are already known.
+     *
+     * \param size the number of bytes in the packet to send
+     * \param params the parameters of the Data field
+     * \param mpdutype the type of the MPDU as defined in WifiPhy::MpduType
+     * \param incFlag this flag is used to indicate that the variables need to be update or not
+     * \param totalAmpduSize the total size of the previously transmitted MPDUs for the concerned
+     * A-MPDU. If incFlag is set, this parameter will be updated.
+     * \param totalAmpduNumSymbols the number of symbols previously transmitted for the MPDUs in
+     * the concerned A-MPDU. If incFlag is set, this parameter will be updated.
+     * \return the duration of the PSDU
+     */
+    static Time CalculatePayloadDuration(uint32_t size,
+                                         const DataFieldParams& params,
+                                         MpduType mpdutype,
+                                         bool incFlag,
+                                         uint32_t& totalAmpduSize,
+                                         double& totalAmpduNumSymbols);
+
     /**
      * \return the WifiMode used for the L-SIG (non-HT header) field
      */
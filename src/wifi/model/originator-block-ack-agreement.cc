@@ -102,9 +102,10 @@ OriginatorBlockAckAgreement::InitTxWindow()
 void
 OriginatorBlockAckAgreement::AdvanceTxWindow()
 {
-    while (m_txWindow.At(0))
+    // advance the window past all the acknowledged MPDUs at the head of the window
+    if (auto count = m_txWindow.FindFirstUnset(); count > 0)
     {
-        m_txWindow.Advance(1); // reset the current head -- ensures loop termination
+        m_txWindow.Advance(count);
     }
 }
 
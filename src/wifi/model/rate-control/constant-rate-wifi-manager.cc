@@ -164,4 +164,11 @@ ConstantRateWifiManager::DoGetRtsTxVector(WifiRemoteStation* st)
         GetAggregation(st));
 }
 
+std::optional<uint64_t>
+ConstantRateWifiManager::DoGetTxVectorGeneration(WifiRemoteStation* station) const
+{
+    // the TXVECTORs only depend on the configuration of the station and of this manager
+    return 0;
+}
+
 } // namespace ns3
@@ -62,6 +62,7 @@ class ConstantRateWifiManager : public WifiRemoteStationManager
     void DoReportFinalDataFailed(WifiRemoteStation* station) override;
     WifiTxVector DoGetDataTxVector(WifiRemoteStation* station, uint16_t allowedWidth) override;
     WifiTxVector DoGetRtsTxVector(WifiRemoteStation* station) override;
+    std::optional<uint64_t> DoGetTxVectorGeneration(WifiRemoteStation* station) const override;
 
     WifiMode m_dataMode; //!< Wifi mode for unicast Data frames
     WifiMode m_ctlMode;  //!< Wifi mode for RTS frames
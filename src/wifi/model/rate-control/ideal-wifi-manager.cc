@@ -23,6 +23,8 @@
 #include "ns3/wifi-phy.h"
 
 #include <algorithm>
+#include <limits>
+#include <numeric>
 
 namespace ns3
 {
@@ -45,10 +47,19 @@ struct IdealWifiRemoteStation : public WifiRemoteStation
     WifiMode m_lastMode; //!< Mode most recently used to the remote station
     uint16_t
         m_lastChannelWidth; //!< Channel width (in MHz) most recently used to the remote station
+    uint64_t m_txVectorGeneration{0}; //!< generation of the TXVECTORs used to the remote station
+    // the mode selected for Data frames (RTS frames) does not change as long as the last
+    // observed SNR is greater than the minimum and not greater than the maximum of the range
+    double m_dataSnrMin; //!< minimum of the SNR range of the mode selected for Data frames
+    double m_dataSnrMax; //!< maximum of the SNR range of the mode selected for Data frames
+    double m_rtsSnrMin;  //!< minimum of the SNR range of the mode selected for RTS frames
+    double m_rtsSnrMax;  //!< maximum of the SNR range of the mode selected for RTS frames
 };
 
 /// To avoid using the cache before a valid value has been cached
 static const double CACHE_INITIAL_VALUE = -100;
+/// Relative margin absorbing the rounding errors when converting SNR thresholds
+static const double SNR_RANGE_MARGIN = 1e-9;
 
 NS_OBJECT_ENSURE_REGISTERED(IdealWifiManager);
 
@@ -118,104 +129,263 @@ void
 IdealWifiManager::BuildSnrThresholds()
 {
     m_thresholds.clear();
-    WifiMode mode;
-    WifiTxVector txVector;
-    uint8_t nss = 1;
+    m_nonHtModes.clear();
     for (const auto& mode : GetPhy()->GetModeList())
     {
+        WifiTxVector txVector;
         txVector.SetChannelWidth(GetChannelWidthForNonHtMode(mode));
-        txVector.SetNss(nss);
+        txVector.SetNss(1);
         txVector.SetMode(mode);
         NS_LOG_DEBUG("Adding mode = " << mode.GetUniqueName());
-        AddSnrThreshold(txVector, GetPhy()->CalculateSnr(txVector, m_ber));
+        NS_ABORT_MSG_IF(m_nonHtModes.size() >= 64, "Too many non-HT modes");
+        AddSnrThreshold({mode.GetModulationClass(), txVector.GetChannelWidth(), 800, 1},
+                        mode,
+                        m_nonHtModes.size(),
+                        GetPhy()->CalculateSnr(txVector, m_ber));
+        m_nonHtModes.push_back(mode);
     }
     // Add all MCSes
     if (GetHtSupported())
     {
+        const auto maxNss = GetPhy()->GetMaxSupportedTxSpatialStreams();
         for (const auto& mode : GetPhy()->GetMcsList())
         {
+            const auto mc = mode.GetModulationClass();
+            // the minimum SNRs do not depend on the guard interval, hence they are computed
+            // once with the guard interval used by this device and copied in the tables of
+            // all the guard intervals, which only differ in the data rates
+            std::vector<uint16_t> guardIntervals{400, 800};
+            uint16_t guardInterval = GetShortGuardIntervalSupported() ? 400 : 800;
+            if (mc >= WIFI_MOD_CLASS_HE)
+            {
+                guardIntervals = {800, 1600, 3200};
+                guardInterval = GetGuardInterval();
+            }
             for (uint16_t j = 20; j <= GetPhy()->GetChannelWidth(); j *= 2)
             {
-                txVector.SetChannelWidth(j);
-                if (mode.GetModulationClass() == WIFI_MOD_CLASS_HT)
+                // create the (possibly empty) tables for all the combinations supported by the
+                // PHY, so that missing tables reveal that capabilities have changed
+                for (uint8_t k = 1; k <= maxNss; k++)
                 {
-                    uint16_t guardInterval = GetShortGuardIntervalSupported() ? 400 : 800;
-                    txVector.SetGuardInterval(guardInterval);
-                    // derive NSS from the MCS index
-                    nss = (mode.GetMcsValue() / 8) + 1;
-                    NS_LOG_DEBUG("Adding mode = " << mode.GetUniqueName() << " channel width " << j
-                                                  << " nss " << +nss << " GI " << guardInterval);
-                    txVector.SetNss(nss);
-                    txVector.SetMode(mode);
-                    AddSnrThreshold(txVector, GetPhy()->CalculateSnr(txVector, m_ber));
+                    for (const auto gi : guardIntervals)
+                    {
+                        m_thresholds[{mc, j, gi, k}];
+                    }
                 }
-                else
+                WifiTxVector txVector;
+                txVector.SetChannelWidth(j);
+                txVector.SetGuardInterval(guardInterval);
+                txVector.SetMode(mode);
+                for (uint8_t nss = 1; nss <= maxNss; nss++)
                 {
-                    uint16_t guardInterval;
-                    if (mode.GetModulationClass() == WIFI_MOD_CLASS_VHT)
+                    // HT modes: derive NSS from the MCS index
+                    if (mc == WIFI_MOD_CLASS_HT && nss != (mode.GetMcsValue() / 8) + 1)
                     {
-                        guardInterval = GetShortGuardIntervalSupported() ? 400 : 800;
+                        continue;
                     }
-                    else
+                    txVector.SetNss(nss);
+                    if ((mc != WIFI_MOD_CLASS_HT && !mode.IsAllowed(j, nss)) || !txVector.IsValid())
                     {
-                        guardInterval = GetGuardInterval();
+                        NS_LOG_DEBUG("Mode = " << mode.GetUniqueName() << " disallowed");
+                        continue;
                     }
-                    txVector.SetGuardInterval(guardInterval);
-                    for (uint8_t k = 1; k <= GetPhy()->GetMaxSupportedTxSpatialStreams(); k++)
+                    NS_LOG_DEBUG("Adding mode = " << mode.GetUniqueName() << " channel width " << j
+                                                  << " nss " << +nss << " GI " << guardInterval);
+                    const auto snr = GetPhy()->CalculateSnr(txVector, m_ber);
+                    for (const auto gi : guardIntervals)
                     {
-                        if (mode.IsAllowed(j, k))
-                        {
-                            NS_LOG_DEBUG("Adding mode = " << mode.GetUniqueName()
-                                                          << " channel width " << j << " nss " << +k
-                                                          << " GI " << guardInterval);
-                            txVector.SetNss(k);
-                            txVector.SetMode(mode);
-                            AddSnrThreshold(txVector, GetPhy()->CalculateSnr(txVector, m_ber));
-                        }
-                        else
-                        {
-                            NS_LOG_DEBUG("Mode = " << mode.GetUniqueName() << " disallowed");
-                        }
+                        AddSnrThreshold({mc, j, gi, nss}, mode, mode.GetMcsValue(), snr);
                     }
                 }
             }
         }
     }
+    // sort the tables by increasing minimum SNR and find the highest data rate achievable
+    // with every minimum SNR
+    for (auto& [key, table] : m_thresholds)
+    {
+        std::vector<std::size_t> order(table.entries.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&table](std::size_t a, std::size_t b) {
+            return table.snrs[a] < table.snrs[b];
+        });
+        SnrThresholdTable sorted;
+        sorted.mask = table.mask;
+        for (const auto i : order)
+        {
+            sorted.snrs.push_back(table.snrs[i]);
+            sorted.entries.push_back(table.entries[i]);
+            auto& entry = sorted.entries.back();
+            entry.best = sorted.entries.size() - 1;
+            if (sorted.entries.size() > 1)
+            {
+                const auto prevBest = sorted.entries[sorted.entries.size() - 2].best;
+                if (sorted.entries[prevBest].dataRate >= entry.dataRate)
+                {
+                    entry.best = prevBest;
+                }
+            }
+        }
+        table = std::move(sorted);
+    }
+}
+
+void
+IdealWifiManager::AddSnrThreshold(const SnrThresholdKey& key,
+                                  WifiMode mode,
+                                  uint8_t bit,
+                                  double snr)
+{
+    NS_LOG_FUNCTION(this << mode.GetUniqueName() << std::get<1>(key) << std::get<2>(key)
+                         << +std::get<3>(key) << +bit << snr);
+    NS_ABORT_MSG_IF(bit >= 64, "Cannot identify mode " << mode.GetUniqueName());
+    auto& table = m_thresholds[key];
+    const auto& [mc, channelWidth, guardInterval, nss] = key;
+    table.snrs.push_back(snr);
+    table.entries.push_back({mode, mode.GetDataRate(channelWidth, guardInterval, nss), bit, 0});
+    table.mask |= (uint64_t{1} << bit);
+}
+
+const IdealWifiManager::SnrThresholdTable*
+IdealWifiManager::GetSnrThresholdTable(const SnrThresholdKey& key)
+{
+    auto it = m_thresholds.find(key);
+    if (it == m_thresholds.end())
+    {
+        // This means capabilities have changed in runtime, hence rebuild SNR thresholds
+        BuildSnrThresholds();
+        it = m_thresholds.find(key);
+        if (it == m_thresholds.end())
+        {
+            return nullptr;
+        }
+    }
+    return &it->second;
 }
 
 double
 IdealWifiManager::GetSnrThreshold(WifiTxVector txVector)
 {
     NS_LOG_FUNCTION(this << txVector);
-    auto it = std::find_if(m_thresholds.begin(),
-                           m_thresholds.end(),
-                           [&txVector](const std::pair<double, WifiTxVector>& p) -> bool {
-                               return ((txVector.GetMode() == p.second.GetMode()) &&
-                                       (txVector.GetNss() == p.second.GetNss()) &&
-                                       (txVector.GetChannelWidth() == p.second.GetChannelWidth()));
-                           });
-    if (it == m_thresholds.end())
+    const auto mc = txVector.GetMode().GetModulationClass();
+    const SnrThresholdKey key{mc,
+                              txVector.GetChannelWidth(),
+                              mc < WIFI_MOD_CLASS_HT ? 800 : txVector.GetGuardInterval(),
+                              txVector.GetNss()};
+    auto findSnr = [&txVector](const SnrThresholdTable* table) -> std::optional<double> {
+        if (table == nullptr)
+        {
+            return std::nullopt;
+        }
+        for (std::size_t i = 0; i < table->entries.size(); ++i)
+        {
+            if (table->entries[i].mode == txVector.GetMode())
+            {
+                return table->snrs[i];
+            }
+        }
+        return std::nullopt;
+    };
+    auto snr = findSnr(GetSnrThresholdTable(key));
+    if (!snr)
     {
         // This means capabilities have changed in runtime, hence rebuild SNR thresholds
         BuildSnrThresholds();
-        it = std::find_if(m_thresholds.begin(),
-                          m_thresholds.end(),
-                          [&txVector](const std::pair<double, WifiTxVector>& p) -> bool {
-                              return ((txVector.GetMode() == p.second.GetMode()) &&
-                                      (txVector.GetNss() == p.second.GetNss()) &&
-                                      (txVector.GetChannelWidth() == p.second.GetChannelWidth()));
-                          });
-        NS_ASSERT_MSG(it != m_thresholds.end(), "SNR threshold not found");
-    }
-    return it->first;
+        snr = findSnr(GetSnrThresholdTable(key));
+        NS_ASSERT_MSG(snr, "SNR threshold not found");
+    }
+    return *snr;
+}
+
+const IdealWifiManager::SnrThresholdTable::Entry*
+IdealWifiManager::GetBestMode(const SnrThresholdTable& table, double snr, uint64_t supported) const
+{
+    if (table.snrs.empty())
+    {
+        return nullptr;
+    }
+    // branchless binary search of the number of minimum SNRs smaller than the given SNR
+    const double* base = table.snrs.data();
+    std::size_t n = table.snrs.size();
+    while (n > 1)
+    {
+        const auto half = n / 2;
+        base = (base[half] < snr) ? base + half : base;
+        n -= half;
+    }
+    const auto count = static_cast<std::size_t>(base - table.snrs.data()) + (*base < snr);
+    if (count == 0)
+    {
+        return nullptr;
+    }
+    if ((supported & table.mask) == table.mask)
+    {
+        return &table.entries[table.entries[count - 1].best];
+    }
+    // the station does not support all the modes of the table
+    const SnrThresholdTable::Entry* best = nullptr;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& entry = table.entries[i];
+        if (((supported >> entry.bit) & 1) && (!best || entry.dataRate > best->dataRate))
+        {
+            best = &entry;
+        }
+    }
+    return best;
 }
 
 void
-IdealWifiManager::AddSnrThreshold(WifiTxVector txVector, double snr)
+IdealWifiManager::NarrowSnrRange(IdealWifiRemoteStation* station,
+                                 const SnrThresholdTable& table,
+                                 double snr,
+                                 uint16_t channelWidth,
+                                 uint8_t nss) const
 {
-    NS_LOG_FUNCTION(this << txVector.GetMode().GetUniqueName() << txVector.GetChannelWidth()
-                         << snr);
-    m_thresholds.emplace_back(snr, txVector);
+    // GetBestMode only depends on the number of minimum SNRs smaller than the given SNR
+    const auto it = std::lower_bound(table.snrs.cbegin(), table.snrs.cend(), snr);
+    // ratio between the last observed SNR and the SNR computed by GetLastObservedSnr
+    double ratio = 1;
+    if (channelWidth != station->m_lastChannelWidthObserved)
+    {
+        ratio *= static_cast<double>(channelWidth) / station->m_lastChannelWidthObserved;
+    }
+    if (nss != station->m_lastNssObserved)
+    {
+        ratio *= static_cast<double>(nss) / station->m_lastNssObserved;
+    }
+    if (it != table.snrs.cbegin())
+    {
+        station->m_dataSnrMin =
+            std::max(station->m_dataSnrMin, *std::prev(it) * ratio * (1 + SNR_RANGE_MARGIN));
+    }
+    if (it != table.snrs.cend())
+    {
+        station->m_dataSnrMax =
+            std::min(station->m_dataSnrMax, *it * ratio * (1 - SNR_RANGE_MARGIN));
+    }
+}
+
+uint64_t
+IdealWifiManager::GetSupportedNonHtModes(IdealWifiRemoteStation* station)
+{
+    uint64_t supported = 0;
+    for (uint8_t i = 0; i < GetNSupported(station); i++)
+    {
+        const auto mode = GetSupported(station, i);
+        auto it = std::find(m_nonHtModes.cbegin(), m_nonHtModes.cend(), mode);
+        if (it == m_nonHtModes.cend())
+        {
+            // This means capabilities have changed in runtime, hence rebuild SNR thresholds
+            BuildSnrThresholds();
+            it = std::find(m_nonHtModes.cbegin(), m_nonHtModes.cend(), mode);
+        }
+        if (it != m_nonHtModes.cend())
+        {
+            supported |= (uint64_t{1} << std::distance(m_nonHtModes.cbegin(), it));
+        }
+    }
+    return supported;
 }
 
 WifiRemoteStation*
@@ -239,6 +409,44 @@ IdealWifiManager::Reset(WifiRemoteStation* station) const
     st->m_lastMode = GetDefaultMode();
     st->m_lastChannelWidth = 0;
     st->m_lastNss = 1;
+    // empty range, so that the next observed SNR changes the generation
+    st->m_dataSnrMin = std::numeric_limits<double>::infinity();
+    st->m_dataSnrMax = -std::numeric_limits<double>::infinity();
+    st->m_rtsSnrMin = -std::numeric_limits<double>::infinity();
+    st->m_rtsSnrMax = std::numeric_limits<double>::infinity();
+    ++st->m_txVectorGeneration;
+}
+
+void
+IdealWifiManager::SetLastObserved(IdealWifiRemoteStation* station,
+                                  double snr,
+                                  uint16_t channelWidth,
+                                  uint8_t nss) const
+{
+    NS_LOG_FUNCTION(this << station << snr << channelWidth << +nss);
+    const bool changed =
+        (channelWidth != station->m_lastChannelWidthObserved || nss != station->m_lastNssObserved);
+    // the selected modes do not change as long as the SNR does not cross any of the
+    // thresholds surrounding the SNR that was used to select them
+    if (changed || snr <= station->m_dataSnrMin || snr > station->m_dataSnrMax ||
+        snr <= station->m_rtsSnrMin || snr > station->m_rtsSnrMax)
+    {
+        ++station->m_txVectorGeneration;
+        // the RTS TXVECTOR (and its range) is computed again when needed
+        station->m_rtsSnrMin = -std::numeric_limits<double>::infinity();
+        station->m_rtsSnrMax = std::numeric_limits<double>::infinity();
+    }
+    if (changed)
+    {
+        // the range has been computed for the previous channel width and NSS; it is not
+        // reset in the other cases because DoGetDataTxVector may reuse the last mode
+        // without computing the range again
+        station->m_dataSnrMin = std::numeric_limits<double>::infinity();
+        station->m_dataSnrMax = -std::numeric_limits<double>::infinity();
+    }
+    station->m_lastSnrObserved = snr;
+    station->m_lastChannelWidthObserved = channelWidth;
+    station->m_lastNssObserved = nss;
 }
 
 void
@@ -267,10 +475,10 @@ IdealWifiManager::DoReportRtsOk(WifiRemoteStation* st,
 {
     NS_LOG_FUNCTION(this << st << ctsSnr << ctsMode.GetUniqueName() << rtsSnr);
     auto station = static_cast<IdealWifiRemoteStation*>(st);
-    station->m_lastSnrObserved = rtsSnr;
-    station->m_lastChannelWidthObserved =
-        GetPhy()->GetChannelWidth() >= 40 ? 20 : GetPhy()->GetChannelWidth();
-    station->m_lastNssObserved = 1;
+    SetLastObserved(station,
+                    rtsSnr,
+                    GetPhy()->GetChannelWidth() >= 40 ? 20 : GetPhy()->GetChannelWidth(),
+                    1);
 }
 
 void
@@ -289,9 +497,7 @@ IdealWifiManager::DoReportDataOk(WifiRemoteStation* st,
         NS_LOG_WARN("DataSnr reported to be zero; not saving this report.");
         return;
     }
-    station->m_lastSnrObserved = dataSnr;
-    station->m_lastChannelWidthObserved = dataChannelWidth;
-    station->m_lastNssObserved = dataNss;
+    SetLastObserved(station, dataSnr, dataChannelWidth, dataNss);
 }
 
 void
@@ -311,9 +517,7 @@ IdealWifiManager::DoReportAmpduTxStatus(WifiRemoteStation* st,
         NS_LOG_WARN("DataSnr reported to be zero; not saving this report.");
         return;
     }
-    station->m_lastSnrObserved = dataSnr;
-    station->m_lastChannelWidthObserved = dataChannelWidth;
-    station->m_lastNssObserved = dataNss;
+    SetLastObserved(station, dataSnr, dataChannelWidth, dataNss);
 }
 
 void
@@ -339,12 +543,10 @@ IdealWifiManager::DoGetDataTxVector(WifiRemoteStation* st, uint16_t allowedWidth
     // highest data rate for which the SNR threshold is smaller than m_lastSnr
     // to ensure correct packet delivery.
     WifiMode maxMode = GetDefaultModeForSta(st);
-    WifiTxVector txVector;
     uint64_t bestRate = 0;
     uint8_t selectedNss = 1;
     uint16_t guardInterval;
     uint16_t channelWidth = std::min(GetChannelWidth(station), allowedWidth);
-    txVector.SetChannelWidth(channelWidth);
     if ((station->m_lastSnrCached != CACHE_INITIAL_VALUE) &&
         (station->m_lastSnrObserved == station->m_lastSnrCached) &&
         (channelWidth == station->m_lastChannelWidth))
@@ -360,18 +562,21 @@ IdealWifiManager::DoGetDataTxVector(WifiRemoteStation* st, uint16_t allowedWidth
     }
     else
     {
+        station->m_dataSnrMin = -std::numeric_limits<double>::infinity();
+        station->m_dataSnrMax = std::numeric_limits<double>::infinity();
         if (GetHtSupported() && GetHtSupported(st))
         {
-            for (uint8_t i = 0; i < GetNMcsSupported(station); i++)
+            const auto maxNss =
+                std::min(GetMaxNumberOfTransmitStreams(), GetNumberOfSupportedStreams(station));
+            for (const auto mc :
+                 {WIFI_MOD_CLASS_HT, WIFI_MOD_CLASS_VHT, WIFI_MOD_CLASS_HE, WIFI_MOD_CLASS_EHT})
             {
-                auto mode = GetMcsSupported(station, i);
-                if (!IsCandidateModulationClass(mode.GetModulationClass(), station))
+                if (!IsCandidateModulationClass(mc, station))
                 {
                     continue;
                 }
-                txVector.SetMode(mode);
                 uint16_t guardInterval;
-                if (mode.GetModulationClass() >= WIFI_MOD_CLASS_HE)
+                if (mc >= WIFI_MOD_CLASS_HE)
                 {
                     guardInterval = std::max(GetGuardInterval(station), GetGuardInterval());
                 }
@@ -381,104 +586,63 @@ IdealWifiManager::DoGetDataTxVector(WifiRemoteStation* st, uint16_t allowedWidth
                         std::max(GetShortGuardIntervalSupported(station) ? 400 : 800,
                                  GetShortGuardIntervalSupported() ? 400 : 800));
                 }
-                txVector.SetGuardInterval(guardInterval);
-                if (mode.GetModulationClass() == WIFI_MOD_CLASS_HT)
+                // the MCSs supported by the station, identified by their index
+                uint64_t supported = 0;
+                for (uint8_t i = 0; i < GetNMcsSupported(station); i++)
                 {
-                    // Derive NSS from the MCS index. There is a different mode for each possible
-                    // NSS value.
-                    uint8_t nss = (mode.GetMcsValue() / 8) + 1;
-                    txVector.SetNss(nss);
-                    if (!txVector.IsValid() || nss > std::min(GetMaxNumberOfTransmitStreams(),
-                                                              GetNumberOfSupportedStreams(st)))
+                    auto mode = GetMcsSupported(station, i);
+                    if (mode.GetModulationClass() == mc && mode.GetMcsValue() < 64)
+                    {
+                        supported |= (uint64_t{1} << mode.GetMcsValue());
+                    }
+                }
+                for (uint8_t nss = 1; nss <= maxNss; nss++)
+                {
+                    const auto table = GetSnrThresholdTable({mc, channelWidth, guardInterval, nss});
+                    if (!table)
                     {
-                        NS_LOG_DEBUG("Skipping mode " << mode.GetUniqueName() << " nss " << +nss
-                                                      << " width " << txVector.GetChannelWidth());
+                        NS_LOG_DEBUG("No mode for nss " << +nss << " width " << channelWidth);
                         continue;
                     }
-                    double threshold = GetSnrThreshold(txVector);
-                    uint64_t dataRate = mode.GetDataRate(txVector.GetChannelWidth(),
-                                                         txVector.GetGuardInterval(),
-                                                         nss);
-                    NS_LOG_DEBUG("Testing mode " << mode.GetUniqueName() << " data rate "
-                                                 << dataRate << " threshold " << threshold
-                                                 << " last snr observed "
-                                                 << station->m_lastSnrObserved << " cached "
-                                                 << station->m_lastSnrCached);
                     double snr = GetLastObservedSnr(station, channelWidth, nss);
-                    if (dataRate > bestRate && threshold < snr)
+                    NarrowSnrRange(station, *table, snr, channelWidth, nss);
+                    const auto entry = GetBestMode(*table, snr, supported);
+                    // the MCS with the lowest index is preferred among those with the same
+                    // data rate
+                    if (entry && (entry->dataRate > bestRate ||
+                                  (entry->dataRate == bestRate &&
+                                   entry->mode.GetMcsValue() < maxMode.GetMcsValue())))
                     {
-                        NS_LOG_DEBUG("Candidate mode = " << mode.GetUniqueName() << " data rate "
-                                                         << dataRate << " threshold " << threshold
+                        NS_LOG_DEBUG("Candidate mode = " << entry->mode.GetUniqueName()
+                                                         << " data rate " << entry->dataRate
                                                          << " channel width " << channelWidth
-                                                         << " snr " << snr);
-                        bestRate = dataRate;
-                        maxMode = mode;
+                                                         << " nss " << +nss << " snr " << snr);
+                        bestRate = entry->dataRate;
+                        maxMode = entry->mode;
                         selectedNss = nss;
                     }
                 }
-                else
-                {
-                    for (uint8_t nss = 1; nss <= std::min(GetMaxNumberOfTransmitStreams(),
-                                                          GetNumberOfSupportedStreams(station));
-                         nss++)
-                    {
-                        txVector.SetNss(nss);
-                        if (!txVector.IsValid())
-                        {
-                            NS_LOG_DEBUG("Skipping mode " << mode.GetUniqueName() << " nss " << +nss
-                                                          << " width "
-                                                          << +txVector.GetChannelWidth());
-                            continue;
-                        }
-                        double threshold = GetSnrThreshold(txVector);
-                        uint64_t dataRate = mode.GetDataRate(txVector.GetChannelWidth(),
-                                                             txVector.GetGuardInterval(),
-                                                             nss);
-                        NS_LOG_DEBUG("Testing mode = " << mode.GetUniqueName() << " data rate "
-                                                       << dataRate << " threshold " << threshold
-                                                       << " last snr observed "
-                                                       << station->m_lastSnrObserved << " cached "
-                                                       << station->m_lastSnrCached);
-                        double snr = GetLastObservedSnr(station, channelWidth, nss);
-                        if (dataRate > bestRate && threshold < snr)
-                        {
-                            NS_LOG_DEBUG("Candidate mode = "
-                                         << mode.GetUniqueName() << " data rate " << dataRate
-                                         << " threshold " << threshold << " channel width "
-                                         << channelWidth << " snr " << snr);
-                            bestRate = dataRate;
-                            maxMode = mode;
-                            selectedNss = nss;
-                        }
-                    }
-                }
             }
         }
         else
         {
             // Non-HT selection
             selectedNss = 1;
-            for (uint8_t i = 0; i < GetNSupported(station); i++)
+            const auto supported = GetSupportedNonHtModes(station);
+            for (auto it = m_thresholds.cbegin();
+                 it != m_thresholds.cend() && std::get<0>(it->first) < WIFI_MOD_CLASS_HT;
+                 ++it)
             {
-                auto mode = GetSupported(station, i);
-                txVector.SetMode(mode);
-                txVector.SetNss(selectedNss);
-                uint16_t channelWidth = GetChannelWidthForNonHtMode(mode);
-                txVector.SetChannelWidth(channelWidth);
-                double threshold = GetSnrThreshold(txVector);
-                uint64_t dataRate = mode.GetDataRate(txVector.GetChannelWidth(),
-                                                     txVector.GetGuardInterval(),
-                                                     txVector.GetNss());
-                NS_LOG_DEBUG("mode = " << mode.GetUniqueName() << " threshold " << threshold
-                                       << " last snr observed " << station->m_lastSnrObserved);
-                double snr = GetLastObservedSnr(station, channelWidth, 1);
-                if (dataRate > bestRate && threshold < snr)
+                double snr = GetLastObservedSnr(station, std::get<1>(it->first), 1);
+                NarrowSnrRange(station, it->second, snr, std::get<1>(it->first), 1);
+                const auto entry = GetBestMode(it->second, snr, supported);
+                if (entry && entry->dataRate > bestRate)
                 {
-                    NS_LOG_DEBUG("Candidate mode = " << mode.GetUniqueName() << " data rate "
-                                                     << dataRate << " threshold " << threshold
+                    NS_LOG_DEBUG("Candidate mode = " << entry->mode.GetUniqueName()
+                                                     << " data rate " << entry->dataRate
                                                      << " snr " << snr);
-                    bestRate = dataRate;
-                    maxMode = mode;
+                    bestRate = entry->dataRate;
+                    maxMode = entry->mode;
                 }
             }
         }
@@ -524,6 +688,12 @@ IdealWifiManager::DoGetDataTxVector(WifiRemoteStation* st, uint16_t allowedWidth
     return bestTxVector;
 }
 
+std::optional<uint64_t>
+IdealWifiManager::DoGetTxVectorGeneration(WifiRemoteStation* station) const
+{
+    return static_cast<IdealWifiRemoteStation*>(station)->m_txVectorGeneration;
+}
+
 WifiTxVector
 IdealWifiManager::DoGetRtsTxVector(WifiRemoteStation* st)
 {
@@ -537,6 +707,8 @@ IdealWifiManager::DoGetRtsTxVector(WifiRemoteStation* st)
     WifiMode mode;
     uint8_t nss = 1;
     WifiMode maxMode = GetDefaultMode();
+    station->m_rtsSnrMin = -std::numeric_limits<double>::infinity();
+    station->m_rtsSnrMax = std::numeric_limits<double>::infinity();
     // RTS is sent in a non-HT frame
     for (uint8_t i = 0; i < GetNBasicModes(); i++)
     {
@@ -550,6 +722,15 @@ IdealWifiManager::DoGetRtsTxVector(WifiRemoteStation* st)
             maxThreshold = threshold;
             maxMode = mode;
         }
+        // the selected mode only depends on the thresholds smaller than the SNR
+        if (threshold < station->m_lastSnrObserved)
+        {
+            station->m_rtsSnrMin = std::max(station->m_rtsSnrMin, threshold);
+        }
+        else
+        {
+            station->m_rtsSnrMax = std::min(station->m_rtsSnrMax, threshold);
+        }
     }
     return WifiTxVector(
         maxMode,
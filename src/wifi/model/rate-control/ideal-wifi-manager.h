@@ -23,6 +23,10 @@
 #include "ns3/traced-value.h"
 #include "ns3/wifi-remote-station-manager.h"
 
+#include <map>
+#include <tuple>
+#include <vector>
+
 namespace ns3
 {
 
@@ -83,6 +87,7 @@ class IdealWifiManager : public WifiRemoteStationManager
     void DoReportFinalDataFailed(WifiRemoteStation* station) override;
     WifiTxVector DoGetDataTxVector(WifiRemoteStation* station, uint16_t allowedWidth) override;
     WifiTxVector DoGetRtsTxVector(WifiRemoteStation* station) override;
+    std::optional<uint64_t> DoGetTxVectorGeneration(WifiRemoteStation* station) const override;
 
     /**
      * Reset the station, invoked if the maximum amount of retries has failed.
@@ -92,12 +97,75 @@ class IdealWifiManager : public WifiRemoteStationManager
     void Reset(WifiRemoteStation* station) const;
 
     /**
-     * Construct the vector of minimum SNRs needed to successfully transmit for
-     * all possible combinations (rate, channel width, nss) based on PHY capabilities.
-     * This is called at initialization and if PHY capabilities changed.
+     * Record the SNR, the channel width and the number of spatial streams of the most
+     * recently reported packet sent to the given station. The generation of the TXVECTORs
+     * of the station is incremented if the channel width or the number of spatial streams
+     * changed or if the SNR is out of the ranges in which the modes selected for Data
+     * and RTS frames do not change.
+     *
+     * \param station the station the packet was sent to
+     * \param snr the SNR of the packet
+     * \param channelWidth the channel width (in MHz) of the packet
+     * \param nss the number of spatial streams of the packet
+     */
+    void SetLastObserved(IdealWifiRemoteStation* station,
+                         double snr,
+                         uint16_t channelWidth,
+                         uint8_t nss) const;
+
+    /**
+     * Key identifying an SNR threshold table: the modulation class, the channel width (MHz),
+     * the guard interval (ns) and the number of spatial streams
+     */
+    using SnrThresholdKey = std::tuple<WifiModulationClass, uint16_t, uint16_t, uint8_t>;
+
+    /**
+     * The modes of a modulation class that can be used with a given channel width, guard
+     * interval and number of spatial streams, sorted by increasing minimum SNR.
+     */
+    struct SnrThresholdTable
+    {
+        /// A mode of the table
+        struct Entry
+        {
+            WifiMode mode;     ///< the mode
+            uint64_t dataRate; ///< the data rate (b/s) of the mode
+            uint8_t bit;       ///< the bit identifying the mode in the masks of supported modes
+            std::size_t best;  ///< index of the entry with the highest data rate up to this one
+        };
+
+        std::vector<double> snrs;   ///< the minimum SNRs (linear scale), in increasing order
+        std::vector<Entry> entries; ///< the modes, in the same order as the minimum SNRs
+        uint64_t mask{0};           ///< the mask of all the modes of the table
+    };
+
+    /**
+     * Construct the tables of minimum SNRs needed to successfully transmit for
+     * all possible combinations (rate, channel width, guard interval, nss) based on PHY
+     * capabilities. This is called at initialization and if PHY capabilities changed.
      */
     void BuildSnrThresholds();
 
+    /**
+     * Add a mode to the SNR threshold table identified by the given key. The table is
+     * sorted when all the modes have been added.
+     *
+     * \param key the key identifying the table
+     * \param mode the mode
+     * \param bit the bit identifying the mode in the masks of supported modes
+     * \param snr the minimum SNR for the given mode in linear scale
+     */
+    void AddSnrThreshold(const SnrThresholdKey& key, WifiMode mode, uint8_t bit, double snr);
+
+    /**
+     * Get the SNR threshold table identified by the given key. If no such table exists,
+     * capabilities have changed in runtime, hence SNR thresholds are rebuilt.
+     *
+     * \param key the key identifying the table
+     * \return a pointer to the table, if any, or a null pointer otherwise
+     */
+    const SnrThresholdTable* GetSnrThresholdTable(const SnrThresholdKey& key);
+
     /**
      * Return the minimum SNR needed to successfully transmit
      * data with this WifiTxVector at the specified BER.
@@ -107,14 +175,41 @@ class IdealWifiManager : public WifiRemoteStationManager
      * \return the minimum SNR for the given WifiTxVector in linear scale
      */
     double GetSnrThreshold(WifiTxVector txVector);
+
+    /**
+     * Get the mode with the highest data rate among the modes of the given table that are
+     * supported and whose minimum SNR is smaller than the given SNR.
+     *
+     * \param table the SNR threshold table
+     * \param snr the SNR in linear scale
+     * \param supported the mask of the supported modes
+     * \return a pointer to the entry of the selected mode, if any, or a null pointer otherwise
+     */
+    const SnrThresholdTable::Entry* GetBestMode(const SnrThresholdTable& table,
+                                                double snr,
+                                                uint64_t supported) const;
+
     /**
-     * Adds a pair of WifiTxVector and the minimum SNR for that given vector
-     * to the list.
+     * Narrow the range of the last observed SNR in which the mode selected from the
+     * given SNR threshold table does not change.
      *
-     * \param txVector the WifiTxVector storing mode, channel width, and Nss
-     * \param snr the minimum SNR for the given txVector in linear scale
+     * \param station the peer station
+     * \param table the SNR threshold table
+     * \param snr the SNR used to select a mode from the table (see GetLastObservedSnr)
+     * \param channelWidth the channel width (in MHz) the SNR has been computed for
+     * \param nss the number of spatial streams the SNR has been computed for
+     */
+    void NarrowSnrRange(IdealWifiRemoteStation* station,
+                        const SnrThresholdTable& table,
+                        double snr,
+                        uint16_t channelWidth,
+                        uint8_t nss) const;
+
+    /**
+     * \param station the peer station
+     * \return the mask of the non-HT modes supported by the given station
      */
-    void AddSnrThreshold(WifiTxVector txVector, double snr);
+    uint64_t GetSupportedNonHtModes(IdealWifiRemoteStation* station);
 
     /**
      * Convenience function for selecting a channel width for non-HT mode
@@ -155,14 +250,9 @@ class IdealWifiManager : public WifiRemoteStationManager
      */
     bool IsCandidateModulationClass(WifiModulationClass mc, IdealWifiRemoteStation* station);
 
-    /**
-     * A vector of <snr, WifiTxVector> pair holding the minimum SNR for the
-     * WifiTxVector
-     */
-    typedef std::vector<std::pair<double, WifiTxVector>> Thresholds;
-
-    double m_ber;            //!< The maximum Bit Error Rate acceptable at any transmission mode
-    Thresholds m_thresholds; //!< List of WifiTxVector and the minimum SNR pair
+    double m_ber; //!< The maximum Bit Error Rate acceptable at any transmission mode
+    std::map<SnrThresholdKey, SnrThresholdTable> m_thresholds; //!< SNR threshold tables
+    std::vector<WifiMode> m_nonHtModes; //!< non-HT modes, indexed by their bit in the masks
 
     TracedValue<uint64_t> m_currentRate; //!< Trace rate changes
 };
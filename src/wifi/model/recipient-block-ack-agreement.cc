@@ -253,13 +253,11 @@ RecipientBlockAckAgreement::FillBlockAckBitmap(CtrlBAckResponseHeader* blockAckH
         blockAckHeader->SetStartingSequence(ssn, index);
         blockAckHeader->ResetBitmap(index);
 
-        for (std::size_t i = 0; i < m_scoreboard.GetWinSize(); i++)
-        {
-            if (m_scoreboard.At(i))
-            {
-                blockAckHeader->SetReceivedPacket((ssn + i) % SEQNO_SPACE_SIZE, index);
-            }
-        }
+        // the element of the scoreboard at distance i from WinStartR corresponds to
+        // bit i of the bitmap, because SSN is set to WinStartR
+        auto bitmap = blockAckHeader->GetBitmap(index);
+        m_scoreboard.CopyTo(bitmap);
+        blockAckHeader->SetBitmap(bitmap, index);
     }
 }
 
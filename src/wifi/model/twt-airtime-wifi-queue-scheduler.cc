@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "twt-airtime-wifi-queue-scheduler.h"
+
+#include "wifi-mac-queue.h"
+#include "wifi-phy.h"
+#include "wifi-remote-station-manager.h"
+
+#include "ns3/data-rate.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+#include <algorithm>
+#include <optional>
+#include <tuple>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("TwtAirtimeWifiQueueScheduler");
+
+bool
+operator==(const TwtAirtimePrio& lhs, const TwtAirtimePrio& rhs)
+{
+    return lhs.type == rhs.type && lhs.spEnd == rhs.spEnd && lhs.round == rhs.round &&
+           lhs.timestamp == rhs.timestamp;
+}
+
+bool
+operator<(const TwtAirtimePrio& lhs, const TwtAirtimePrio& rhs)
+{
+    // Control queues have the highest priority
+    if (lhs.type == WIFI_CTL_QUEUE && rhs.type != WIFI_CTL_QUEUE)
+    {
+        return true;
+    }
+    if (lhs.type != WIFI_CTL_QUEUE && rhs.type == WIFI_CTL_QUEUE)
+    {
+        return false;
+    }
+    // Management queues have the second highest priority
+    if (lhs.type == WIFI_MGT_QUEUE && rhs.type != WIFI_MGT_QUEUE)
+    {
+        return true;
+    }
+    if (lhs.type != WIFI_MGT_QUEUE && rhs.type == WIFI_MGT_QUEUE)
+    {
+        return false;
+    }
+    // we get here if both priority values refer to container queues of the same type
+    // or both refer to data queues. Serve first the receivers whose SP ends earlier,
+    // then the stations in the earliest DRR round and finally the oldest frames
+    return std::tie(lhs.spEnd, lhs.round, lhs.timestamp) <
+           std::tie(rhs.spEnd, rhs.round, rhs.timestamp);
+}
+
+NS_OBJECT_ENSURE_REGISTERED(TwtAirtimeWifiQueueScheduler);
+
+TypeId
+TwtAirtimeWifiQueueScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::TwtAirtimeWifiQueueScheduler")
+            .SetParent<WifiMacQueueSchedulerImpl<Time>>()
+            .SetGroupName("Wifi")
+            .AddConstructor<TwtAirtimeWifiQueueScheduler>()
+            .AddAttribute("Quantum",
+                          "The airtime granted to every station in each Deficit Round Robin "
+                          "round. Must be strictly positive.",
+                          TimeValue(MicroSeconds(300)),
+                          MakeTimeAccessor(&TwtAirtimeWifiQueueScheduler::m_quantum),
+                          MakeTimeChecker(NanoSeconds(1)));
+    return tid;
+}
+
+TwtAirtimeWifiQueueScheduler::TwtAirtimeWifiQueueScheduler()
+    : NS_LOG_TEMPLATE_DEFINE("TwtAirtimeWifiQueueScheduler")
+{
+}
+
+void
+TwtAirtimeWifiQueueScheduler::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& drrInfo : m_drrInfo)
+    {
+        drrInfo.stations.clear();
+    }
+    WifiMacQueueSchedulerImpl<TwtAirtimePrio>::DoDispose();
+}
+
+Time
+TwtAirtimeWifiQueueScheduler::GetDeficit(AcIndex ac, const Mac48Address& address) const
+{
+    NS_ASSERT(static_cast<uint8_t>(ac) < AC_UNDEF);
+
+    const auto& stations = m_drrInfo[ac].stations;
+    if (auto it = stations.find(address); it != stations.cend())
+    {
+        return it->second.deficit;
+    }
+    // a station that has never been served is granted a full quantum
+    return m_quantum;
+}
+
+TwtAirtimeWifiQueueScheduler::StationInfo&
+TwtAirtimeWifiQueueScheduler::GetStationInfo(AcIndex ac, const WifiContainerQueueId& queueId)
+{
+    auto& drrInfo = m_drrInfo[ac];
+    auto [it, inserted] = drrInfo.stations.try_emplace(std::get<Mac48Address>(queueId));
+
+    if (inserted || it->second.round < drrInfo.currentRound)
+    {
+        // the station did not take part in the last rounds, hence it cannot accumulate
+        // airtime for such rounds
+        it->second.round = drrInfo.currentRound;
+        it->second.deficit = m_quantum;
+    }
+    it->second.queueIds.insert(queueId);
+    return it->second;
+}
+
+Time
+TwtAirtimeWifiQueueScheduler::GetSpEnd(const WifiContainerQueueId& queueId) const
+{
+    const auto type = std::get<WifiContainerQueueType>(queueId);
+    const auto& address = std::get<Mac48Address>(queueId);
+
+    if (!GetMac() || std::get<WifiReceiverAddressType>(queueId) != WIFI_UNICAST ||
+        type == WIFI_CTL_QUEUE || type == WIFI_MGT_QUEUE)
+    {
+        return Time::Max();
+    }
+
+    auto manager = GetMac()->GetWifiRemoteStationManager(*GetMac()->GetLinkIds().cbegin());
+    if (manager->GetTwtAgreementCount(address) == 0)
+    {
+        return Time::Max();
+    }
+
+    if (auto timeLeft = manager->GetTimeTillEndOfOngoingTwtSPs(address);
+        timeLeft.IsStrictlyPositive())
+    {
+        return Simulator::Now() + timeLeft;
+    }
+    return Time::Max();
+}
+
+Time
+TwtAirtimeWifiQueueScheduler::GetAirtime(const WifiContainerQueueId& queueId, uint32_t bytes) const
+{
+    std::optional<WifiTxVector> txVector;
+
+    if (GetMac())
+    {
+        const auto linkId = *GetMac()->GetLinkIds().cbegin();
+        auto manager = GetMac()->GetWifiRemoteStationManager(linkId);
+        auto receiver = std::get<Mac48Address>(queueId);
+
+        if (std::get<WifiReceiverAddressType>(queueId) == WIFI_BROADCAST)
+        {
+            // the TXVECTOR of group addressed frames does not depend on the state of
+            // a remote station, hence it can be computed here
+            WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+            hdr.SetAddr1(Mac48Address::GetBroadcast());
+            txVector =
+                manager->GetDataTxVector(hdr, GetMac()->GetWifiPhy(linkId)->GetChannelWidth());
+        }
+        else
+        {
+            if (auto staAddress = manager->GetAffiliatedStaAddress(receiver))
+            {
+                receiver = *staAddress;
+            }
+            // do not invoke the rate control algorithm, which may update its state
+            // (e.g., sampling rates), and use the TXVECTOR it last selected instead
+            txVector = manager->GetLastDataTxVector(receiver);
+        }
+    }
+
+    if (!txVector)
+    {
+        // the TX rate is unknown, use the lowest OFDM rate, which is the same for all the
+        // stations and hence makes the scheduler fair in terms of bytes
+        return DataRate("6Mb/s").CalculateBytesTxTime(bytes);
+    }
+
+    auto rate = txVector->GetMode().GetDataRate(*txVector);
+    NS_ASSERT(rate > 0);
+    return NanoSeconds(static_cast<uint64_t>(bytes) * 8 * 1000000000 / rate);
+}
+
+void
+TwtAirtimeWifiQueueScheduler::UpdatePriority(AcIndex ac, const WifiContainerQueueId& queueId)
+{
+    NS_LOG_FUNCTION(this << +ac);
+
+    // priority is determined by the head of the queue
+    auto item = GetWifiMacQueue(ac)->PeekByQueueId(queueId);
+    if (!item)
+    {
+        return;
+    }
+
+    const auto type = std::get<WifiContainerQueueType>(queueId);
+    const auto& station = m_drrInfo[ac].stations.at(std::get<Mac48Address>(queueId));
+
+    SetPriority(ac, queueId, {type, GetSpEnd(queueId), station.round, item->GetTimestamp()});
+}
+
+Ptr<WifiMpdu>
+TwtAirtimeWifiQueueScheduler::HasToDropBeforeEnqueuePriv(AcIndex ac, Ptr<WifiMpdu> mpdu)
+{
+    auto queue = GetWifiMacQueue(ac);
+    if (queue->QueueBase::GetNPackets() < queue->GetMaxSize().GetValue())
+    {
+        // the queue is not full, do not drop anything
+        return nullptr;
+    }
+
+    // Control and management frames should be prioritized: drop a frame from the
+    // data queue having the lowest priority
+    if (mpdu->GetHeader().IsCtl() || mpdu->GetHeader().IsMgt())
+    {
+        const auto& sortedQueues = GetSortedQueues(ac);
+        for (auto it = sortedQueues.crbegin(); it != sortedQueues.crend(); ++it)
+        {
+            const auto& queueId = it->second.get().first;
+            if (std::get<WifiContainerQueueType>(queueId) == WIFI_MGT_QUEUE ||
+                std::get<WifiContainerQueueType>(queueId) == WIFI_CTL_QUEUE)
+            {
+                // do not drop control or management frames
+                continue;
+            }
+
+            // do not drop frames that are inflight or to be retransmitted
+            Ptr<WifiMpdu> item;
+            while ((item = queue->PeekByQueueId(queueId, item)))
+            {
+                if (!item->IsInFlight() && !item->GetHeader().IsRetry())
+                {
+                    NS_LOG_DEBUG("Dropping " << *item);
+                    return item;
+                }
+            }
+        }
+    }
+    NS_LOG_DEBUG("Dropping received MPDU: " << *mpdu);
+    return mpdu;
+}
+
+void
+TwtAirtimeWifiQueueScheduler::DoNotifyEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu)
+{
+    NS_LOG_FUNCTION(this << +ac << *mpdu);
+
+    const auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
+    GetStationInfo(ac, queueId);
+    UpdatePriority(ac, queueId);
+}
+
+void
+TwtAirtimeWifiQueueScheduler::DoNotifyDequeue(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus)
+{
+    NS_LOG_FUNCTION(this << +ac << mpdus.size());
+
+    std::map<WifiContainerQueueId, uint32_t> dequeuedBytes;
+
+    for (const auto& mpdu : mpdus)
+    {
+        dequeuedBytes[WifiMacQueueContainer::GetQueueId(mpdu)] += mpdu->GetSize();
+    }
+
+    auto& drrInfo = m_drrInfo[ac];
+    std::set<WifiContainerQueueId> queueIds;
+
+    for (const auto& [queueId, bytes] : dequeuedBytes)
+    {
+        queueIds.insert(queueId);
+
+        const auto type = std::get<WifiContainerQueueType>(queueId);
+        auto stationIt = drrInfo.stations.find(std::get<Mac48Address>(queueId));
+        if (type == WIFI_CTL_QUEUE || type == WIFI_MGT_QUEUE ||
+            stationIt == drrInfo.stations.end())
+        {
+            continue;
+        }
+
+        // charge the airtime used by the dequeued frames to the station
+        auto& station = stationIt->second;
+        drrInfo.currentRound = std::max(drrInfo.currentRound, station.round);
+        station.deficit -= GetAirtime(queueId, bytes);
+
+        if (!station.deficit.IsStrictlyPositive())
+        {
+            // the station exhausted its deficit, move it to the round in which its
+            // deficit becomes positive again
+            const auto rounds = -station.deficit.GetTimeStep() / m_quantum.GetTimeStep() + 1;
+            station.round += rounds;
+            station.deficit += m_quantum * rounds;
+            NS_LOG_DEBUG("Station " << std::get<Mac48Address>(queueId) << " moved to round "
+                                    << station.round << " with deficit " << station.deficit);
+            // the priority of all the queues of the station has changed
+            queueIds.insert(station.queueIds.cbegin(), station.queueIds.cend());
+        }
+    }
+
+    for (const auto& queueId : queueIds)
+    {
+        UpdatePriority(ac, queueId);
+    }
+}
+
+void
+TwtAirtimeWifiQueueScheduler::DoNotifyRemove(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus)
+{
+    NS_LOG_FUNCTION(this << +ac << mpdus.size());
+
+    std::set<WifiContainerQueueId> queueIds;
+
+    for (const auto& mpdu : mpdus)
+    {
+        queueIds.insert(WifiMacQueueContainer::GetQueueId(mpdu));
+    }
+
+    for (const auto& queueId : queueIds)
+    {
+        UpdatePriority(ac, queueId);
+    }
+}
+
+void
+TwtAirtimeWifiQueueScheduler::DoNotifyUnblock(AcIndex ac,
+                                              const std::list<WifiContainerQueueId>& queueIds)
+{
+    NS_LOG_FUNCTION(this << +ac << queueIds.size());
+
+    // the receiver may have entered a TWT SP, hence the priority of the unblocked queues
+    // needs to be updated
+    for (const auto& queueId : queueIds)
+    {
+        GetStationInfo(ac, queueId);
+        UpdatePriority(ac, queueId);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef TWT_AIRTIME_WIFI_QUEUE_SCHEDULER_H
+#define TWT_AIRTIME_WIFI_QUEUE_SCHEDULER_H
+
+#include "wifi-mac-queue-scheduler-impl.h"
+
+#include "ns3/nstime.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+namespace ns3
+{
+
+class WifiMpdu;
+
+/**
+ * \ingroup wifi
+ *
+ * Definition of priority for container queues served by the TwtAirtimeWifiQueueScheduler.
+ */
+struct TwtAirtimePrio
+{
+    WifiContainerQueueType type; ///< type of container queue
+    Time spEnd;                  ///< end time of the ongoing SP of the receiver (Time::Max if none)
+    uint64_t round;              ///< DRR round the station of the container queue is served in
+    Time timestamp;              ///< timestamp of the MPDU at the head of the container queue
+};
+
+/**
+ * \param lhs the left hand side priority
+ * \param rhs the right hand side priority
+ * \return whether the left hand side priority is equal to the right hand side priority
+ */
+bool operator==(const TwtAirtimePrio& lhs, const TwtAirtimePrio& rhs);
+/**
+ * \param lhs the left hand side priority
+ * \param rhs the right hand side priority
+ * \return whether the left hand side priority is less than the right hand side priority
+ */
+bool operator<(const TwtAirtimePrio& lhs, const TwtAirtimePrio& rhs);
+
+/**
+ * \ingroup wifi
+ *
+ * TwtAirtimeWifiQueueScheduler is a wifi queue scheduler meant for APs serving
+ * stations that established TWT agreements. Control frames have the highest priority
+ * and management frames have the second highest priority, as with the
+ * FcfsWifiQueueScheduler. Data frames are then served as follows:
+ *
+ * - queues whose receiver is in a TWT service period are served in increasing order
+ *   of the end time of such service period (earliest deadline first), so that the
+ *   stations whose service period is about to end are served before it ends; queues
+ *   whose receiver is not in a TWT service period come afterwards;
+ * - queues having the same deadline are served according to a Deficit Round Robin
+ *   (DRR) scheme based on airtime: every station is granted a quantum of airtime per
+ *   round and the airtime used to transmit the MPDUs dequeued for a station is charged
+ *   to its deficit; when the deficit is exhausted, the station moves to the next round,
+ *   hence stations using low transmission rates do not starve the other stations;
+ * - queues of the same station or of stations in the same round are served in a first
+ *   come first serve fashion.
+ *
+ * The airtime of the dequeued MPDUs is computed from the data rate of the TX vector
+ * last selected by the remote station manager for the receiver (the rate control
+ * algorithm is not invoked) or from the lowest OFDM rate if no TX vector has been
+ * selected yet. The deficits are kept separately for each Access Category.
+ */
+class TwtAirtimeWifiQueueScheduler : public WifiMacQueueSchedulerImpl<TwtAirtimePrio>
+{
+  public:
+    /**
+     * \brief Get the type ID.
+     * \return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    TwtAirtimeWifiQueueScheduler();
+
+    /**
+     * Get the airtime that the given station can still use in the current DRR round
+     * to transmit frames of the given Access Category.
+     *
+     * \param ac the given Access Category
+     * \param address the address of the given station
+     * \return the deficit of the given station
+     */
+    Time GetDeficit(AcIndex ac, const Mac48Address& address) const;
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    /// DRR state of a station
+    struct StationInfo
+    {
+        Time deficit;                              ///< airtime left in the current round
+        uint64_t round{0};                         ///< round the station is served in
+        std::set<WifiContainerQueueId> queueIds{}; ///< IDs of the queues of the station
+    };
+
+    /// DRR state of an Access Category
+    struct PerAcDrrInfo
+    {
+        std::map<Mac48Address, StationInfo> stations; ///< per-station DRR state
+        uint64_t currentRound{0};                     ///< round currently being served
+    };
+
+    Ptr<WifiMpdu> HasToDropBeforeEnqueuePriv(AcIndex ac, Ptr<WifiMpdu> mpdu) override;
+    void DoNotifyEnqueue(AcIndex ac, Ptr<WifiMpdu> mpdu) override;
+    void DoNotifyDequeue(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus) override;
+    void DoNotifyRemove(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus) override;
+    void DoNotifyUnblock(AcIndex ac, const std::list<WifiContainerQueueId>& queueIds) override;
+
+    /**
+     * Get the DRR state of the station the given container queue belongs to. If the
+     * station lags behind the current round (because it had nothing to transmit or it
+     * was sleeping), it joins the current round with a full quantum.
+     *
+     * \param ac the Access Category of the given container queue
+     * \param queueId the ID of the given container queue
+     * \return the DRR state of the station
+     */
+    StationInfo& GetStationInfo(AcIndex ac, const WifiContainerQueueId& queueId);
+
+    /**
+     * Set the priority of the given container queue, if not empty, based on the end
+     * of the ongoing TWT SP of its receiver, the DRR round of its station and the
+     * timestamp of the MPDU at its head.
+     *
+     * \param ac the Access Category of the given container queue
+     * \param queueId the ID of the given container queue
+     */
+    void UpdatePriority(AcIndex ac, const WifiContainerQueueId& queueId);
+
+    /**
+     * \param queueId the ID of the given container queue
+     * \return the end time of the ongoing TWT SP of the receiver of the frames in the
+     *         given container queue, or Time::Max if the receiver is not in a TWT SP
+     */
+    Time GetSpEnd(const WifiContainerQueueId& queueId) const;
+
+    /**
+     * \param queueId the ID of the container queue holding the given frames
+     * \param bytes the size in bytes of the given frames
+     * \return the airtime required to transmit the given frames to their receiver
+     */
+    Time GetAirtime(const WifiContainerQueueId& queueId, uint32_t bytes) const;
+
+    Time m_quantum;                                //!< airtime granted to every station per round
+    std::vector<PerAcDrrInfo> m_drrInfo{AC_UNDEF}; //!< per-AC DRR state
+    NS_LOG_TEMPLATE_DECLARE;                       //!< redefinition of the log component
+};
+
+} // namespace ns3
+
+#endif /* TWT_AIRTIME_WIFI_QUEUE_SCHEDULER_H */
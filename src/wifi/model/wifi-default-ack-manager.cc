@@ -706,7 +706,20 @@ WifiDefaultAckManager::TryUlMuTransmission(Ptr<const WifiMpdu> mpdu,
                 NS_LOG_INFO("Unallocated RU");
                 continue;
             }
-            NS_ABORT_MSG_IF(aid12 == 0 || aid12 > 2007, "Allocation of RA-RUs is not supported");
+            NS_ABORT_MSG_IF(aid12 == 2045, "Allocation of RA-RUs for unassociated STAs is not "
+                                           "supported");
+            if (aid12 == 0)
+            {
+                // the stations that will transmit on the RA-RUs are not known in advance;
+                // assume that each RA-RU is used and acknowledged with a 64-bit bitmap
+                NS_LOG_INFO("RA-RUs for associated STAs");
+                acknowledgment->baType.m_bitmapLen.insert(
+                    acknowledgment->baType.m_bitmapLen.end(),
+                    userInfo.GetNRaRus(),
+                    8);
+                continue;
+            }
+            NS_ABORT_MSG_IF(aid12 > 2007, "Invalid AID12 value: " << aid12);
 
             NS_ASSERT(apMac->GetStaList(m_linkId).find(aid12) != apMac->GetStaList(m_linkId).end());
             Mac48Address staAddress = apMac->GetStaList(m_linkId).find(aid12)->second;
@@ -730,11 +743,21 @@ WifiDefaultAckManager::TryUlMuTransmission(Ptr<const WifiMpdu> mpdu,
                 m_mac->GetBaTypeAsRecipient(staAddress, tid).m_bitmapLen.at(0));
         }
 
-        uint16_t staId = trigger.begin()->GetAid12();
-        acknowledgment->tbPpduTxVector = trigger.GetHeTbTxVector(staId);
-        acknowledgment->multiStaBaTxVector = GetWifiRemoteStationManager()->GetBlockAckTxVector(
-            apMac->GetStaList(m_linkId).find(staId)->second,
-            acknowledgment->tbPpduTxVector);
+        if (auto staIt = apMac->GetStaList(m_linkId).find(trigger.begin()->GetAid12());
+            staIt != apMac->GetStaList(m_linkId).end())
+        {
+            acknowledgment->tbPpduTxVector = trigger.GetHeTbTxVector(staIt->first);
+            acknowledgment->multiStaBaTxVector =
+                GetWifiRemoteStationManager()->GetBlockAckTxVector(staIt->second,
+                                                                   acknowledgment->tbPpduTxVector);
+        }
+        else
+        {
+            // the Trigger Frame only allocates RA-RUs, the Multi-STA BlockAck is sent
+            // with the same TXVECTOR as the (broadcast) Trigger Frame
+            acknowledgment->tbPpduTxVector = trigger.GetHeTbTxVector(RA_RU_STA_ID_BASE);
+            acknowledgment->multiStaBaTxVector = txParams.m_txVector;
+        }
         return acknowledgment;
     }
     else if (trigger.IsBsrp())
@@ -369,6 +369,11 @@ WifiDefaultProtectionManager::TryUlMuTransmission(Ptr<const WifiMpdu> mpdu,
 
     for (const auto& userInfo : trigger)
     {
+        if (userInfo.GetAid12() == 0 || userInfo.GetAid12() == 2045)
+        {
+            // the stations transmitting on Random Access RUs are not known in advance
+            continue;
+        }
         // Add a User Info field to the MU-RTS for this solicited station
         // The UL HE-MCS, UL FEC Coding Type, UL DCM, SS Allocation and UL Target RSSI fields
         // in the User Info field are reserved (Sec. 9.3.1.22.5 of 802.11ax)
@@ -25,6 +25,8 @@
 #include "ns3/mac48-address.h"
 #include "ns3/simulator.h"
 
+#include <vector>
+
 namespace ns3
 {
 
@@ -34,6 +36,9 @@ WifiMacQueueContainer::clear()
     m_queues.clear();
     m_expiredQueue.clear();
     m_nBytesPerQueue.clear();
+    m_inflightExpired.clear();
+    m_expiryInfo.clear();
+    m_expiryIndex.clear();
 }
 
 WifiMacQueueContainer::iterator
@@ -113,82 +118,161 @@ WifiMacQueueContainer::GetNBytes(const WifiContainerQueueId& queueId) const
     return m_nBytesPerQueue.at(queueId);
 }
 
+void
+WifiMacQueueContainer::SetExpiryTime(iterator it, Time expiryTime) const
+{
+    if (it->expiryList != nullptr)
+    {
+        it->expiryList->Remove(*it);
+    }
+    it->expiryTime = expiryTime;
+
+    if (expiryTime == Time::Max())
+    {
+        // this MPDU never expires, no need to index it
+        return;
+    }
+
+    WifiContainerQueueId queueId = GetQueueId(it->mpdu);
+    auto& info = m_expiryInfo[queueId];
+    info.list.Insert(it);
+
+    // the key of the container queue in the expiry index must not exceed the earliest
+    // expiry time of its MPDUs
+    if (!info.indexIt.has_value() || (*info.indexIt)->first > expiryTime)
+    {
+        if (info.indexIt.has_value())
+        {
+            m_expiryIndex.erase(*info.indexIt);
+        }
+        info.indexIt = m_expiryIndex.emplace(expiryTime, queueId);
+    }
+}
+
+Time
+WifiMacQueueContainer::GetNextExpiryTime() const
+{
+    return m_expiryIndex.empty() ? Time::Max() : m_expiryIndex.cbegin()->first;
+}
+
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
-    return DoExtractExpiredMpdus(m_queues[queueId]);
+    auto infoIt = m_expiryInfo.find(queueId);
+
+    if (infoIt == m_expiryInfo.end())
+    {
+        return {m_expiredQueue.end(), m_expiredQueue.end()};
+    }
+    return DoExtractExpiredMpdus(queueId, infoIt->second);
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
-WifiMacQueueContainer::DoExtractExpiredMpdus(ContainerQueue& queue) const
+WifiMacQueueContainer::DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                             ExpiryInfo& info) const
 {
-    std::optional<std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>> ret;
-    auto firstExpiredIt = queue.begin();
-    auto lastExpiredIt = firstExpiredIt;
     Time now = Simulator::Now();
-
-    do
+    auto elem = info.list.GetHead();
+    ContainerQueue* queue = nullptr;
+    uint32_t* nBytes = nullptr;
+    auto firstExpiredIt = m_expiredQueue.end();
+    bool inflightExpired = false;
+
+    // visit the MPDUs with expired lifetime, which are at the head of the expiry list
+    while (elem != nullptr && elem->expiryTime <= now)
     {
-        // advance firstExpiredIt and lastExpiredIt to skip all inflight MPDUs
-        for (firstExpiredIt = lastExpiredIt;
-             firstExpiredIt != queue.end() && !firstExpiredIt->inflights.empty();
-             ++firstExpiredIt, ++lastExpiredIt)
-        {
-        }
+        auto next = elem->expiryNext;
 
-        if (!ret)
+        if (!elem->inflights.empty())
         {
-            // we get here in the first iteration only
-            ret = std::make_pair(firstExpiredIt, lastExpiredIt);
+            // inflight MPDUs cannot be extracted; they will be checked again afterwards
+            inflightExpired = true;
+            elem = next;
+            continue;
         }
 
-        // advance lastExpiredIt as we encounter MPDUs with expired lifetime that are not inflight
-        while (lastExpiredIt != queue.end() && lastExpiredIt->expiryTime <= now &&
-               lastExpiredIt->inflights.empty())
+        if (queue == nullptr)
         {
-            lastExpiredIt->expired = true;
-            // this MPDU is no longer queued
-            lastExpiredIt->ac = AC_UNDEF;
-            lastExpiredIt->deleter(lastExpiredIt->mpdu);
-
-            WifiContainerQueueId queueId = GetQueueId(lastExpiredIt->mpdu);
-            auto it = m_nBytesPerQueue.find(queueId);
-            NS_ASSERT(it != m_nBytesPerQueue.end());
-            NS_ASSERT(it->second >= lastExpiredIt->mpdu->GetSize());
-            it->second -= lastExpiredIt->mpdu->GetSize();
-
-            ++lastExpiredIt;
+            queue = &m_queues[queueId];
+            auto bytesIt = m_nBytesPerQueue.find(queueId);
+            NS_ASSERT(bytesIt != m_nBytesPerQueue.end());
+            nBytes = &bytesIt->second;
         }
 
-        if (lastExpiredIt != firstExpiredIt)
+        auto it = elem->expiryIt;
+        info.list.Remove(*elem);
+        elem->expired = true;
+        // this MPDU is no longer queued
+        elem->ac = AC_UNDEF;
+        elem->deleter(elem->mpdu);
+
+        NS_ASSERT(*nBytes >= elem->mpdu->GetSize());
+        *nBytes -= elem->mpdu->GetSize();
+
+        // transfer the MPDU to the tail of m_expiredQueue
+        m_expiredQueue.splice(m_expiredQueue.end(), *queue, it);
+        if (firstExpiredIt == m_expiredQueue.end())
         {
-            // transfer non-inflight MPDUs with expired lifetime to the tail of m_expiredQueue
-            m_expiredQueue.splice(m_expiredQueue.end(), queue, firstExpiredIt, lastExpiredIt);
-            ret->second = m_expiredQueue.end();
+            firstExpiredIt = it;
         }
+        elem = next;
+    }
 
-    } while (lastExpiredIt != firstExpiredIt);
+    // elem (if any) is now the MPDU with the earliest expiry time that has not expired yet,
+    // hence it determines the key of the container queue in the expiry index
+    if (info.indexIt.has_value() && (elem == nullptr || (*info.indexIt)->first != elem->expiryTime))
+    {
+        m_expiryIndex.erase(*info.indexIt);
+        info.indexIt.reset();
+    }
+    if (elem != nullptr && !info.indexIt.has_value())
+    {
+        info.indexIt = m_expiryIndex.emplace(elem->expiryTime, queueId);
+    }
 
-    return *ret;
+    if (inflightExpired)
+    {
+        m_inflightExpired.insert(queueId);
+    }
+    else if (!m_inflightExpired.empty())
+    {
+        m_inflightExpired.erase(queueId);
+    }
+
+    return {firstExpiredIt, m_expiredQueue.end()};
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
 WifiMacQueueContainer::ExtractAllExpiredMpdus() const
 {
-    std::optional<WifiMacQueueContainer::iterator> firstExpiredIt;
+    Time now = Simulator::Now();
+    auto firstExpiredIt = m_expiredQueue.end();
+
+    // the container queues to visit are those whose key in the expiry index has been
+    // reached and those storing inflight MPDUs with expired lifetime
+    std::vector<WifiContainerQueueId> queueIds(m_inflightExpired.cbegin(),
+                                               m_inflightExpired.cend());
+    for (auto indexIt = m_expiryIndex.cbegin();
+         indexIt != m_expiryIndex.cend() && indexIt->first <= now;
+         ++indexIt)
+    {
+        if (m_inflightExpired.count(indexIt->second) == 0)
+        {
+            queueIds.push_back(indexIt->second);
+        }
+    }
 
-    for (auto& queue : m_queues)
+    for (const auto& queueId : queueIds)
     {
-        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queue.second);
+        auto [firstIt, lastIt] = DoExtractExpiredMpdus(queueId, m_expiryInfo.at(queueId));
 
-        if (firstIt != lastIt && !firstExpiredIt)
+        if (firstIt != lastIt && firstExpiredIt == m_expiredQueue.end())
         {
             // this is the first queue with MPDUs with expired lifetime
             firstExpiredIt = firstIt;
         }
     }
-    return std::make_pair(firstExpiredIt ? *firstExpiredIt : m_expiredQueue.end(),
-                          m_expiredQueue.end());
+    return {firstExpiredIt, m_expiredQueue.end()};
 }
 
 std::pair<WifiMacQueueContainer::iterator, WifiMacQueueContainer::iterator>
@@ -24,10 +24,11 @@
 
 #include "ns3/mac48-address.h"
 
-#include <list>
+#include <map>
 #include <optional>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace ns3
 {
@@ -109,12 +110,19 @@ namespace ns3
  *
  * This container holds multiple container queues organized in an hash table
  * whose keys are WifiContainerQueueId tuples identifying the container queues.
+ *
+ * The elements of every container queue are also indexed by expiry time (see
+ * WifiMacQueueExpiryList), and the container queues are indexed by (a lower bound
+ * on) the earliest expiry time of their elements. Hence, extracting MPDUs with
+ * expired lifetime only requires to visit the expired MPDUs (and the expired
+ * MPDUs that cannot be extracted because they are inflight) of the container
+ * queues that have expired MPDUs.
  */
 class WifiMacQueueContainer
 {
   public:
     /// Type of a queue held by the container
-    using ContainerQueue = std::list<WifiMacQueueElem>;
+    using ContainerQueue = WifiMacQueueElemList;
     /// iterator over elements in a container queue
     using iterator = ContainerQueue::iterator;
     /// const iterator over elements in a container queue
@@ -178,6 +186,23 @@ class WifiMacQueueContainer
      */
     uint32_t GetNBytes(const WifiContainerQueueId& queueId) const;
 
+    /**
+     * Set the expiry time of the element pointed to by the given iterator and index the
+     * element by its expiry time. Elements that are not indexed (including those having an
+     * expiry time equal to Time::Max()) are never extracted by the methods that extract MPDUs
+     * with expired lifetime.
+     *
+     * \param it iterator pointing to an element stored in a container queue
+     * \param expiryTime the expiry time of the element
+     */
+    void SetExpiryTime(iterator it, Time expiryTime) const;
+
+    /**
+     * \return a lower bound on the earliest expiry time of the MPDUs stored in the container
+     *         queues that are not known to be expired, or Time::Max() if there is no such MPDU
+     */
+    Time GetNextExpiryTime() const;
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the container queue identified by
      * the given QueueId to the container queue storing MPDUs with expired lifetime.
@@ -205,16 +230,35 @@ class WifiMacQueueContainer
     std::pair<iterator, iterator> GetAllExpiredMpdus() const;
 
   private:
+    /// Index of the container queues sorted by the earliest expiry time of their MPDUs
+    using ExpiryIndex = std::multimap<Time, WifiContainerQueueId>;
+
+    /// Information about the expiry of the MPDUs stored in a container queue
+    struct ExpiryInfo
+    {
+        WifiMacQueueExpiryList list;                  //!< MPDUs sorted by increasing expiry time
+        std::optional<ExpiryIndex::iterator> indexIt; //!< entry of the queue in the expiry index
+    };
+
     /**
      * Transfer non-inflight MPDUs with expired lifetime in the given container queue to the
      * container queue storing MPDUs with expired lifetime.
      *
-     * \param queue the given container queue
+     * \param queueId the QueueId identifying the container queue
+     * \param info the information about the expiry of the MPDUs stored in the container queue
      * \return the range [first, last) of iterators pointing to the MPDUs transferred
      *         to the container queue storing MPDUs with expired lifetime
      */
-    std::pair<iterator, iterator> DoExtractExpiredMpdus(ContainerQueue& queue) const;
+    std::pair<iterator, iterator> DoExtractExpiredMpdus(const WifiContainerQueueId& queueId,
+                                                        ExpiryInfo& info) const;
 
+    // the expiry information must be destroyed after the container queues, because
+    // the elements of the container queues are linked to the expiry lists
+    mutable ExpiryIndex m_expiryIndex; //!< container queues sorted by earliest expiry time
+    mutable std::unordered_map<WifiContainerQueueId, ExpiryInfo>
+        m_expiryInfo; //!< expiry information of the container queues
+    mutable std::unordered_set<WifiContainerQueueId>
+        m_inflightExpired; //!< container queues storing inflight MPDUs with expired lifetime
     mutable std::unordered_map<WifiContainerQueueId, ContainerQueue>
         m_queues;                          //!< the container queues
     mutable ContainerQueue m_expiredQueue; //!< queue storing MPDUs with expired lifetime
@@ -27,6 +27,7 @@ namespace ns3
 WifiMacQueueElem::WifiMacQueueElem(Ptr<WifiMpdu> item)
     : mpdu(item),
       expiryTime(0),
+      enqueueTime(0),
       ac(AC_UNDEF),
       expired(false)
 {
@@ -34,8 +35,92 @@ WifiMacQueueElem::WifiMacQueueElem(Ptr<WifiMpdu> item)
 
 WifiMacQueueElem::~WifiMacQueueElem()
 {
+    if (expiryList != nullptr)
+    {
+        expiryList->Remove(*this);
+    }
     deleter(mpdu);
     inflights.clear();
 }
 
+WifiMacQueueExpiryList::~WifiMacQueueExpiryList()
+{
+    while (m_head != nullptr)
+    {
+        Remove(*m_head);
+    }
+}
+
+void
+WifiMacQueueExpiryList::Insert(WifiMacQueueElemList::iterator it)
+{
+    auto& elem = *it;
+    NS_ASSERT(elem.expiryList == nullptr);
+    elem.expiryList = this;
+    elem.expiryIt = it;
+
+    // look for the element after which the given element has to be inserted, starting from
+    // the tail of the list
+    auto prev = m_tail;
+    while (prev != nullptr && prev->expiryTime > elem.expiryTime)
+    {
+        prev = prev->expiryPrev;
+    }
+
+    elem.expiryPrev = prev;
+    elem.expiryNext = (prev != nullptr ? prev->expiryNext : m_head);
+
+    if (elem.expiryNext != nullptr)
+    {
+        elem.expiryNext->expiryPrev = &elem;
+    }
+    else
+    {
+        m_tail = &elem;
+    }
+
+    if (prev != nullptr)
+    {
+        prev->expiryNext = &elem;
+    }
+    else
+    {
+        m_head = &elem;
+    }
+}
+
+void
+WifiMacQueueExpiryList::Remove(WifiMacQueueElem& elem)
+{
+    NS_ASSERT(elem.expiryList == this);
+
+    if (elem.expiryPrev != nullptr)
+    {
+        elem.expiryPrev->expiryNext = elem.expiryNext;
+    }
+    else
+    {
+        m_head = elem.expiryNext;
+    }
+
+    if (elem.expiryNext != nullptr)
+    {
+        elem.expiryNext->expiryPrev = elem.expiryPrev;
+    }
+    else
+    {
+        m_tail = elem.expiryPrev;
+    }
+
+    elem.expiryList = nullptr;
+    elem.expiryPrev = nullptr;
+    elem.expiryNext = nullptr;
+}
+
+WifiMacQueueElem*
+WifiMacQueueExpiryList::GetHead() const
+{
+    return m_head;
+}
+
 } // namespace ns3
@@ -21,16 +21,29 @@
 #define WIFI_MAC_QUEUE_ELEM_H
 
 #include "qos-utils.h"
+#include "wifi-pooled-allocator.h"
 
 #include "ns3/callback.h"
 #include "ns3/nstime.h"
 
+#include <list>
 #include <map>
 
 namespace ns3
 {
 
 class WifiMpdu;
+struct WifiMacQueueElem;
+class WifiMacQueueExpiryList;
+
+/**
+ * \ingroup wifi
+ * Type of the lists of elements stored in a WifiMacQueue container. The list nodes are
+ * allocated from a pool shared by all the lists, so that enqueuing and dequeuing MPDUs
+ * does not involve the global memory allocator and the elements of a queue are likely
+ * to be close in memory.
+ */
+using WifiMacQueueElemList = std::list<WifiMacQueueElem, WifiPooledAllocator<WifiMacQueueElem>>;
 
 /**
  * \ingroup wifi
@@ -49,13 +62,21 @@ class WifiMpdu;
  */
 struct WifiMacQueueElem
 {
-    Ptr<WifiMpdu> mpdu;                         ///< MPDU stored by this element
-    Time expiryTime{0};                         ///< expiry time of the MPDU (set by WifiMacQueue)
-    AcIndex ac{AC_UNDEF};                       ///< the Access Category associated with the queue
-                                                ///< storing this element (set by WifiMacQueue)
-    bool expired{false};                        ///< whether this MPDU has been marked as expired
-    std::map<uint8_t, Ptr<WifiMpdu>> inflights; ///< map of MPDUs in-flight on each link
-    Callback<void, Ptr<WifiMpdu>> deleter;      ///< reset the iterator stored by the MPDU
+    Ptr<WifiMpdu> mpdu;                          ///< MPDU stored by this element
+    Time expiryTime{0};                          ///< expiry time of the MPDU (set through
+                                                 ///< WifiMacQueueContainer::SetExpiryTime)
+    Time enqueueTime{0};                         ///< time the MPDU was enqueued (preserved
+                                                 ///< when the MPDU is replaced)
+    AcIndex ac{AC_UNDEF};                        ///< the Access Category associated with the queue
+                                                 ///< storing this element (set by WifiMacQueue)
+    bool expired{false};                         ///< whether this MPDU has been marked as expired
+    std::map<uint8_t, Ptr<WifiMpdu>> inflights;  ///< map of MPDUs in-flight on each link
+    Callback<void, Ptr<WifiMpdu>> deleter;       ///< reset the iterator stored by the MPDU
+    WifiMacQueueExpiryList* expiryList{nullptr}; ///< the expiry list this element is linked to
+    WifiMacQueueElem* expiryPrev{nullptr};       ///< previous element in the expiry list
+    WifiMacQueueElem* expiryNext{nullptr};       ///< next element in the expiry list
+    WifiMacQueueElemList::iterator expiryIt;     ///< iterator pointing to this element (valid
+                                                 ///< if the element is linked to an expiry list)
 
     /**
      * Constructor.
@@ -66,6 +87,51 @@ struct WifiMacQueueElem
     ~WifiMacQueueElem();
 };
 
+/**
+ * \ingroup wifi
+ * Intrusive list of the elements of a container queue, sorted by increasing expiry time.
+ *
+ * Elements are linked to the list through the pointers they embed, hence linking and
+ * unlinking an element does not allocate memory. MPDUs are enqueued at the tail of their
+ * container queue with an expiry time equal to the current time plus a constant lifetime,
+ * hence an element is normally inserted at the tail of the list in constant time.
+ * An element is automatically unlinked from its list when it is destroyed.
+ */
+class WifiMacQueueExpiryList
+{
+  public:
+    WifiMacQueueExpiryList() = default;
+    ~WifiMacQueueExpiryList();
+
+    // elements store pointers to their list, hence a list cannot be copied
+    WifiMacQueueExpiryList(const WifiMacQueueExpiryList&) = delete;
+    WifiMacQueueExpiryList& operator=(const WifiMacQueueExpiryList&) = delete;
+
+    /**
+     * Link the element pointed to by the given iterator to this list, based on its expiry
+     * time. Elements having the same expiry time are kept in the order they are inserted.
+     *
+     * \param it iterator pointing to an element that is not linked to any expiry list
+     */
+    void Insert(WifiMacQueueElemList::iterator it);
+
+    /**
+     * Unlink the given element from this list.
+     *
+     * \param elem an element linked to this list
+     */
+    void Remove(WifiMacQueueElem& elem);
+
+    /**
+     * \return a pointer to the element with the earliest expiry time, if any, or a null pointer
+     */
+    WifiMacQueueElem* GetHead() const;
+
+  private:
+    WifiMacQueueElem* m_head{nullptr}; //!< element with the earliest expiry time
+    WifiMacQueueElem* m_tail{nullptr}; //!< element with the latest expiry time
+};
+
 } // namespace ns3
 
 #endif /* WIFI_MAC_QUEUE_ELEM_H */
@@ -33,6 +33,10 @@
 #include <vector>
 
 class WifiMacQueueDropOldestTest;
+class WifiMacQueueExpiryTimerTest;
+class TwtAirtimeWifiQueueSchedulerTest;
+class WifiMacQueueCoDelTest;
+class BlockAckManagerInFlightTest;
 
 namespace ns3
 {
@@ -53,6 +57,14 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
   public:
     /// allow WifiMacQueueDropOldestTest class access
     friend class ::WifiMacQueueDropOldestTest;
+    /// allow WifiMacQueueExpiryTimerTest class access
+    friend class ::WifiMacQueueExpiryTimerTest;
+    /// allow TwtAirtimeWifiQueueSchedulerTest class access
+    friend class ::TwtAirtimeWifiQueueSchedulerTest;
+    /// allow WifiMacQueueCoDelTest class access
+    friend class ::WifiMacQueueCoDelTest;
+    /// allow BlockAckManagerInFlightTest class access
+    friend class ::BlockAckManagerInFlightTest;
 
     /**
      * \brief Get the type ID.
@@ -250,6 +262,17 @@ class WifiMacQueueSchedulerImpl : public WifiMacQueueScheduler
      * \param mpdus the list of removed MPDUs
      */
     virtual void DoNotifyRemove(AcIndex ac, const std::list<Ptr<WifiMpdu>>& mpdus) = 0;
+    /**
+     * Notify the scheduler that at least one link has been unblocked for the given
+     * (non-empty) container queues of the given Access Category. Subclasses whose
+     * priority values depend on the state of the receiver (e.g., whether it is in a
+     * service period) can override this method to update the priority of such queues.
+     * The default implementation does nothing.
+     *
+     * \param ac the Access Category of the unblocked container queues
+     * \param queueIds the IDs of the unblocked container queues
+     */
+    virtual void DoNotifyUnblock(AcIndex ac, const std::list<WifiContainerQueueId>& queueIds);
 
     /**
      * Block or unblock the given set of links for the container queues of the given types and
@@ -500,6 +523,8 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::DoBlockQueues(
             break;
         }
     }
+    std::list<WifiContainerQueueId> unblockedQueueIds;
+
     for (auto& hdr : headers)
     {
         hdr.SetAddr1(rxAddress);
@@ -513,6 +538,15 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::DoBlockQueues(
                 mask.set(static_cast<std::size_t>(reason), block);
             }
         }
+        if (!block && queueInfoIt->second.priorityIt.has_value())
+        {
+            unblockedQueueIds.push_back(queueInfoIt->first);
+        }
+    }
+
+    if (!unblockedQueueIds.empty())
+    {
+        DoNotifyUnblock(ac, unblockedQueueIds);
     }
 }
 
@@ -709,6 +743,14 @@ WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyDequeue(AcIndex ac,
     }
 }
 
+template <class Priority, class Compare>
+void
+WifiMacQueueSchedulerImpl<Priority, Compare>::DoNotifyUnblock(
+    AcIndex /* ac */,
+    const std::list<WifiContainerQueueId>& /* queueIds */)
+{
+}
+
 template <class Priority, class Compare>
 void
 WifiMacQueueSchedulerImpl<Priority, Compare>::NotifyRemove(AcIndex ac,
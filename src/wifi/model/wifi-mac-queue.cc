@@ -24,8 +24,10 @@
 
 #include "wifi-mac-queue-scheduler.h"
 
+#include "ns3/boolean.h"
 #include "ns3/simulator.h"
 
+#include <cmath>
 #include <functional>
 #include <optional>
 
@@ -55,10 +57,37 @@ WifiMacQueue::GetTypeId()
                           TimeValue(MilliSeconds(500)),
                           MakeTimeAccessor(&WifiMacQueue::SetMaxDelay),
                           MakeTimeChecker())
+            .AddAttribute("EnableCoDel",
+                          "Whether CoDel is applied to each container queue storing data "
+                          "frames (i.e., to each pair of receiver and TID). MPDUs dropped "
+                          "by CoDel are also reported by the Expired trace source.",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&WifiMacQueue::m_enableCoDel),
+                          MakeBooleanChecker())
+            .AddAttribute("CoDelTarget",
+                          "The CoDel target sojourn time.",
+                          TimeValue(MilliSeconds(20)),
+                          MakeTimeAccessor(&WifiMacQueue::m_coDelTarget),
+                          MakeTimeChecker(Time{0}))
+            .AddAttribute("CoDelInterval",
+                          "The CoDel interval, i.e., the time the sojourn time must stay "
+                          "above the target before MPDUs are dropped.",
+                          TimeValue(MilliSeconds(100)),
+                          MakeTimeAccessor(&WifiMacQueue::m_coDelInterval),
+                          MakeTimeChecker(Time{1}))
             .AddTraceSource("Expired",
                             "MPDU dropped because its lifetime expired.",
                             MakeTraceSourceAccessor(&WifiMacQueue::m_traceExpired),
-                            "ns3::WifiMpdu::TracedCallback");
+                            "ns3::WifiMpdu::TracedCallback")
+            .AddTraceSource("CoDelDrop",
+                            "MPDU dropped by CoDel.",
+                            MakeTraceSourceAccessor(&WifiMacQueue::m_traceCoDelDrop),
+                            "ns3::WifiMpdu::TracedCallback")
+            .AddTraceSource("SojournTime",
+                            "Time spent in the queue by a data frame that is dequeued "
+                            "(e.g., because it has been acknowledged).",
+                            MakeTraceSourceAccessor(&WifiMacQueue::m_traceSojournTime),
+                            "ns3::Time::TracedCallback");
     return tid;
 }
 
@@ -77,7 +106,9 @@ void
 WifiMacQueue::DoDispose()
 {
     NS_LOG_FUNCTION(this);
+    m_expiryEvent.Cancel();
     m_scheduler = nullptr;
+    m_coDelStates.clear();
     Queue<WifiMpdu, WifiMacQueueContainer>::DoDispose();
 }
 
@@ -120,6 +151,11 @@ WifiMacQueue::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
 {
     NS_LOG_FUNCTION(this);
 
+    if (m_enableCoDel)
+    {
+        DoCoDel(queueId);
+    }
+
     std::list<Ptr<WifiMpdu>> mpdus;
     auto [first, last] = GetContainer().ExtractExpiredMpdus(queueId);
 
@@ -137,6 +173,7 @@ WifiMacQueue::ExtractExpiredMpdus(const WifiContainerQueueId& queueId) const
     {
         m_scheduler->NotifyRemove(m_ac, mpdus);
     }
+    EraseCoDelStateIfEmpty(queueId);
 }
 
 void
@@ -155,6 +192,7 @@ WifiMacQueue::ExtractAllExpiredMpdus() const
     {
         // fire the Expired trace
         Simulator::ScheduleNow(&WifiMacQueue::m_traceExpired, this, mpdu);
+        EraseCoDelStateIfEmpty(WifiMacQueueContainer::GetQueueId(mpdu));
     }
     // notify the scheduler
     if (!mpdus.empty())
@@ -182,6 +220,145 @@ WifiMacQueue::WipeAllExpiredMpdus()
     }
 }
 
+void
+WifiMacQueue::DoCoDel(const WifiContainerQueueId& queueId) const
+{
+    NS_LOG_FUNCTION(this);
+
+    auto queueType = std::get<WifiContainerQueueType>(queueId);
+    if (queueType != WIFI_QOSDATA_QUEUE && queueType != WIFI_DATA_QUEUE)
+    {
+        return;
+    }
+
+    const auto& queue = GetContainer().GetQueue(queueId);
+    if (queue.empty())
+    {
+        return;
+    }
+    auto& state = m_coDelStates[queueId];
+    auto now = Simulator::Now();
+
+    for (auto it = queue.cbegin(); it != queue.cend(); ++it)
+    {
+        if (!it->inflights.empty())
+        {
+            // the MPDU at the head of the queue is being transmitted
+            break;
+        }
+        if (it->expiryTime <= now)
+        {
+            // this MPDU is going to be extracted because its lifetime expired
+            continue;
+        }
+
+        auto sojournTime = now - it->enqueueTime;
+        bool okToDrop = false;
+
+        // the last MPDU in the queue is never dropped
+        if (sojournTime < m_coDelTarget || std::next(it) == queue.cend())
+        {
+            state.firstAboveTime = Time{0};
+        }
+        else if (state.firstAboveTime.IsZero())
+        {
+            state.firstAboveTime = now + m_coDelInterval;
+        }
+        else if (now >= state.firstAboveTime)
+        {
+            okToDrop = true;
+        }
+
+        if (state.dropping)
+        {
+            if (!okToDrop)
+            {
+                // sojourn time below target, leave the dropping state
+                state.dropping = false;
+                break;
+            }
+            if (now < state.dropNext)
+            {
+                break;
+            }
+            state.count++;
+            state.dropNext = CoDelControlLaw(state.dropNext, state.count);
+        }
+        else if (okToDrop)
+        {
+            // enter the dropping state; if we were dropping recently, start from the drop
+            // rate that controlled the queue in the previous dropping cycle
+            state.dropping = true;
+            auto delta = state.count - state.lastCount;
+            state.count =
+                (delta > 1 && now - state.dropNext < 16 * m_coDelInterval) ? delta : 1;
+            state.dropNext = CoDelControlLaw(now, state.count);
+            state.lastCount = state.count;
+        }
+        else
+        {
+            break;
+        }
+
+        NS_LOG_DEBUG("CoDel dropping " << *it->mpdu << " (sojourn time="
+                                       << sojournTime.As(Time::MS) << ")");
+        Simulator::ScheduleNow(&WifiMacQueue::m_traceCoDelDrop, this, it->mpdu);
+        GetContainer().SetExpiryTime(GetIt(it->mpdu), now);
+    }
+}
+
+void
+WifiMacQueue::EraseCoDelStateIfEmpty(const WifiContainerQueueId& queueId) const
+{
+    auto it = m_coDelStates.find(queueId);
+    if (it != m_coDelStates.end() && !it->second.dropping &&
+        GetContainer().GetQueue(queueId).empty())
+    {
+        NS_LOG_DEBUG("Erasing the CoDel state of an empty container queue");
+        m_coDelStates.erase(it);
+    }
+}
+
+Time
+WifiMacQueue::CoDelControlLaw(Time t, uint32_t count) const
+{
+    return t + Seconds(m_coDelInterval.GetSeconds() / std::sqrt(count));
+}
+
+void
+WifiMacQueue::UpdateExpiryTimer()
+{
+    auto nextExpiryTime = GetContainer().GetNextExpiryTime();
+
+    if (nextExpiryTime == Time::Max())
+    {
+        return;
+    }
+
+    auto now = Simulator::Now();
+    if (m_expiryEvent.IsRunning())
+    {
+        if (now + Simulator::GetDelayLeft(m_expiryEvent) <= nextExpiryTime)
+        {
+            return;
+        }
+        m_expiryEvent.Cancel();
+    }
+
+    NS_LOG_DEBUG("Expiry timer set to expire at " << nextExpiryTime.As(Time::US));
+    m_expiryEvent = Simulator::Schedule(Max(nextExpiryTime - now, Time{0}),
+                                        &WifiMacQueue::ExpiryTimeout,
+                                        this);
+}
+
+void
+WifiMacQueue::ExpiryTimeout()
+{
+    NS_LOG_FUNCTION(this);
+    WipeAllExpiredMpdus();
+    UpdateExpiryTimer();
+}
+
 bool
 WifiMacQueue::TtlExceeded(Ptr<const WifiMpdu> item, const Time& now)
 {
@@ -293,6 +470,10 @@ WifiMacQueue::DequeueIfQueued(const std::list<Ptr<const WifiMpdu>>& mpdus)
             NS_ASSERT(it->ac == m_ac);
             NS_ASSERT(it->mpdu == mpdu->GetOriginal());
             iterators.emplace_back(it);
+            if (it->expiryTime != Time::Max())
+            {
+                m_traceSojournTime(Simulator::Now() - it->enqueueTime);
+            }
         }
     }
 
@@ -430,13 +611,16 @@ WifiMacQueue::Replace(Ptr<const WifiMpdu> currentItem, Ptr<WifiMpdu> newItem)
     NS_ASSERT(!newItem->IsQueued());
 
     Time expiryTime = currentIt->expiryTime;
+    Time enqueueTime = currentIt->enqueueTime;
     auto pos = std::next(currentIt);
     DoDequeue({currentIt});
     bool ret = Insert(pos, newItem);
-    GetIt(newItem)->expiryTime = expiryTime;
     // The size of a WifiMacQueue is measured as number of packets. We dequeued
     // one packet, so there is certainly room for inserting one packet
     NS_ABORT_IF(!ret);
+    GetContainer().SetExpiryTime(GetIt(newItem), expiryTime);
+    GetIt(newItem)->enqueueTime = enqueueTime;
+    UpdateExpiryTimer();
 }
 
 uint32_t
@@ -489,7 +673,11 @@ WifiMacQueue::DoEnqueue(ConstIterator pos, Ptr<WifiMpdu> item)
         // set item's information about its position in the queue
         item->SetQueueIt(ret, {});
         ret->ac = m_ac;
-        ret->expiryTime = item->GetHeader().IsCtl() ? Time::Max() : Simulator::Now() + m_maxDelay;
+        ret->enqueueTime = Simulator::Now();
+        GetContainer().SetExpiryTime(ret,
+                                     item->GetHeader().IsCtl() ? Time::Max()
+                                                               : Simulator::Now() + m_maxDelay);
+        UpdateExpiryTimer();
         WmqIteratorTag tag;
         ret->deleter = [tag](auto mpdu) { mpdu->SetQueueIt(std::nullopt, tag); };
 
@@ -517,6 +705,7 @@ WifiMacQueue::DoDequeue(const std::list<ConstIterator>& iterators)
             {
                 SetMaxSize(GetMaxSize() - item);
             }
+            EraseCoDelStateIfEmpty(WifiMacQueueContainer::GetQueueId(item));
         }
     }
 
@@ -540,6 +729,7 @@ WifiMacQueue::DoRemove(ConstIterator pos)
         {
             SetMaxSize(GetMaxSize() - item);
         }
+        EraseCoDelStateIfEmpty(WifiMacQueueContainer::GetQueueId(item));
         m_scheduler->NotifyRemove(m_ac, {item});
     }
 
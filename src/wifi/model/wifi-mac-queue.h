@@ -27,6 +27,7 @@
 #include "wifi-mac-queue-container.h"
 #include "wifi-mpdu.h"
 
+#include "ns3/event-id.h"
 #include "ns3/queue.h"
 
 #include <functional>
@@ -60,6 +61,18 @@ extern template class Queue<WifiMpdu, ns3::WifiMacQueueContainer>;
  * dot11EDCATableMSDULifetime has elapsed, it is dropped.
  * Otherwise, it is returned to the caller.
  *
+ * Optionally, a CoDel (RFC 8289) active queue management can be enabled, which
+ * is applied separately to each container queue storing data frames (i.e., to
+ * each pair of receiver and TID), along with the WifiMacQueueScheduler that
+ * selects the container queue to serve. When the MPDU at the head of a container
+ * queue is about to be served, its sojourn time is compared to the CoDel target;
+ * if the sojourn time has stayed above the target for at least one CoDel
+ * interval, the MPDU is dropped and further drops are scheduled according to the
+ * CoDel control law until the sojourn time goes below the target. Thus, the
+ * backlog of a station that cannot be served (e.g., because it is in power save
+ * mode) does not increase the queuing delay of the other stations and is kept
+ * short without having to tune the MaxDelay attribute.
+ *
  * Compiling python bindings fails if the namespace (ns3) is not
  * specified for WifiMacQueueContainerT.
  */
@@ -259,7 +272,9 @@ class WifiMacQueue : public Queue<WifiMpdu, ns3::WifiMacQueueContainer>
      * Move MPDUs with expired lifetime from the container queue identified by the
      * given queue ID to the container queue storing MPDUs with expired lifetime.
      * Each MPDU that is found to have an expired lifetime feeds the "Expired"
-     * trace source and is notified to the scheduler.
+     * trace source and is notified to the scheduler. If CoDel is enabled, the
+     * MPDUs at the head of the container queue that are dropped by CoDel are
+     * handled as MPDUs with expired lifetime.
      * \note that such MPDUs are not removed from the WifiMacQueue (and hence are
      * still accounted for in the overall statistics kept by the Queue base class)
      * in order to make this method const.
@@ -347,12 +362,73 @@ class WifiMacQueue : public Queue<WifiMpdu, ns3::WifiMacQueueContainer>
      */
     Ptr<WifiMpdu> DoRemove(ConstIterator pos);
 
+    /**
+     * Apply CoDel to the container queue identified by the given queue ID. The MPDUs
+     * at the head of the container queue that have to be dropped are marked as having
+     * an expired lifetime, hence they are extracted along with the other MPDUs with
+     * expired lifetime.
+     *
+     * \param queueId the given queue ID
+     */
+    void DoCoDel(const WifiContainerQueueId& queueId) const;
+
+    /**
+     * Erase the CoDel state of the container queue identified by the given queue ID if
+     * such container queue is empty and not in the dropping state, so that the states
+     * of the container queues that are no longer used are not retained.
+     *
+     * \param queueId the given queue ID
+     */
+    void EraseCoDelStateIfEmpty(const WifiContainerQueueId& queueId) const;
+
+    /**
+     * Compute the time of the next CoDel drop according to the CoDel control law.
+     *
+     * \param t the time of the current drop
+     * \param count the number of drops since entering the dropping state
+     * \return the time of the next drop
+     */
+    Time CoDelControlLaw(Time t, uint32_t count) const;
+
+    /**
+     * Make sure that the expiry timer expires not later than the earliest expiry time of
+     * the MPDUs stored in this queue.
+     */
+    void UpdateExpiryTimer();
+
+    /**
+     * Remove the MPDUs with expired lifetime from this queue and restart the expiry timer.
+     */
+    void ExpiryTimeout();
+
     Time m_maxDelay;                        //!< Time to live for packets in the queue
+    EventId m_expiryEvent;                  //!< event removing MPDUs with expired lifetime
     AcIndex m_ac;                           //!< the access category
     Ptr<WifiMacQueueScheduler> m_scheduler; //!< the MAC queue scheduler
 
+    /// CoDel state of a container queue
+    struct CoDelState
+    {
+        Time firstAboveTime{0}; //!< time at which the sojourn time will have been above
+                                //!< the target for one interval (zero if below the target)
+        Time dropNext{0};       //!< time of the next drop in the dropping state
+        uint32_t count{0};      //!< number of drops since entering the dropping state
+        uint32_t lastCount{0};  //!< value of count when the dropping state was last entered
+        bool dropping{false};   //!< whether the container queue is in the dropping state
+    };
+
+    bool m_enableCoDel;   //!< whether CoDel is applied to the container queues
+    Time m_coDelTarget;   //!< CoDel target sojourn time
+    Time m_coDelInterval; //!< CoDel interval
+    mutable std::unordered_map<WifiContainerQueueId, CoDelState>
+        m_coDelStates; //!< CoDel state of the container queues storing data frames
+
     /// Traced callback: fired when a packet is dropped due to lifetime expiration
     TracedCallback<Ptr<const WifiMpdu>> m_traceExpired;
+    /// Traced callback: fired when a packet is dropped by CoDel
+    TracedCallback<Ptr<const WifiMpdu>> m_traceCoDelDrop;
+    /// Traced callback: fired with the time spent in the queue by a dequeued data frame
+    TracedCallback<Time> m_traceSojournTime;
 
     NS_LOG_TEMPLATE_DECLARE; //!< redefinition of the log component
 };
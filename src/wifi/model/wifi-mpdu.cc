@@ -44,6 +44,7 @@ WifiMpdu::WifiMpdu(Ptr<const Packet> p, const WifiMacHeader& header, Time stamp)
     if (header.IsQosData() && header.IsQosAmsdu())
     {
         original.m_msduList = MsduAggregator::Deaggregate(p->Copy());
+        original.m_amsduSize = static_cast<uint16_t>(p->GetSize());
     }
 }
 
@@ -112,7 +113,32 @@ WifiMpdu::GetOriginalInfo() const
 Ptr<const Packet>
 WifiMpdu::GetPacket() const
 {
-    return GetOriginalInfo().m_packet;
+    auto& original = GetOriginalInfo();
+
+    if (!original.m_packet)
+    {
+        // build the A-MSDU from the list of aggregated MSDUs
+        NS_ASSERT(!original.m_msduList.empty());
+        std::vector<Ptr<Packet>> subframes;
+        subframes.reserve(original.m_msduList.size());
+        uint32_t size = 0;
+        for (const auto& [msdu, hdr] : original.m_msduList)
+        {
+            // pad the previous A-MSDU subframe
+            if (uint8_t padding = MsduAggregator::CalculatePadding(size); padding > 0)
+            {
+                subframes.back()->AddAtEnd(Create<Packet>(padding));
+                size += padding;
+            }
+            auto amsduSubframe = msdu->Copy();
+            amsduSubframe->AddHeader(hdr);
+            size += amsduSubframe->GetSize();
+            subframes.push_back(amsduSubframe);
+        }
+        original.m_packet = ConcatenatePackets(std::move(subframes));
+        NS_ASSERT(original.m_packet->GetSize() == original.m_amsduSize);
+    }
+    return original.m_packet;
 }
 
 Time
@@ -147,7 +173,9 @@ WifiMpdu::GetDestinationAddress() const
 uint32_t
 WifiMpdu::GetPacketSize() const
 {
-    return GetPacket()->GetSize();
+    auto& original = GetOriginalInfo();
+    // the size of an A-MSDU that has not been built yet is known
+    return original.m_packet ? original.m_packet->GetSize() : original.m_amsduSize;
 }
 
 uint32_t
@@ -193,7 +221,7 @@ WifiMpdu::Aggregate(Ptr<const WifiMpdu> msdu)
     {
         // An MSDU is going to be aggregated to this MPDU, hence this has to be an A-MSDU now
         Ptr<const WifiMpdu> firstMsdu = Create<const WifiMpdu>(*this);
-        original.m_packet = Create<Packet>();
+        original.m_amsduSize = 0;
         DoAggregate(firstMsdu);
 
         m_header.SetQosAmsdu();
@@ -245,27 +273,11 @@ WifiMpdu::DoAggregate(Ptr<const WifiMpdu> msdu)
     auto& original = std::get<OriginalInfo>(m_instanceInfo);
 
     original.m_msduList.emplace_back(msdu->GetPacket(), hdr);
-
-    // build the A-MSDU
-    NS_ASSERT(original.m_packet);
-    Ptr<Packet> amsdu = original.m_packet->Copy();
-
-    // pad the previous A-MSDU subframe if the A-MSDU is not empty
-    if (original.m_packet->GetSize() > 0)
-    {
-        uint8_t padding = MsduAggregator::CalculatePadding(original.m_packet->GetSize());
-
-        if (padding)
-        {
-            amsdu->AddAtEnd(Create<Packet>(padding));
-        }
-    }
-
-    // add A-MSDU subframe header and MSDU
-    Ptr<Packet> amsduSubframe = msdu->GetPacket()->Copy();
-    amsduSubframe->AddHeader(hdr);
-    amsdu->AddAtEnd(amsduSubframe);
-    original.m_packet = amsdu;
+    original.m_amsduSize =
+        MsduAggregator::GetSizeIfAggregated(hdr.GetLength(), original.m_amsduSize);
+    // the A-MSDU is built when the packet is requested, so that aggregating an MSDU
+    // does not require to copy all the MSDUs aggregated so far
+    original.m_packet = nullptr;
 }
 
 bool
@@ -133,7 +133,9 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
      *        constituting an A-MSDU). Note that the given MPDU cannot contain
      *        an A-MSDU. If the given MPDU is a null pointer, the effect of this
      *        call is to add only an A-MSDU subframe header, thus producing an A-MSDU
-     *        containing a single MSDU.
+     *        containing a single MSDU. The aggregated MSDUs are only referenced by
+     *        this MPDU; the packet containing the A-MSDU is built when it is first
+     *        requested (see GetPacket()).
      * \param msdu the MPDU containing the MSDU to aggregate
      */
     void Aggregate(Ptr<const WifiMpdu> msdu);
@@ -158,7 +160,7 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
     DeaggregatedMsdusCI end() const;
 
     /// Const iterator typedef
-    typedef std::list<WifiMacQueueElem>::iterator Iterator;
+    typedef WifiMacQueueElemList::iterator Iterator;
 
     /**
      * Set the queue iterator stored by this object.
@@ -285,11 +287,12 @@ class WifiMpdu : public SimpleRefCount<WifiMpdu>
      */
     struct OriginalInfo
     {
-        Ptr<const Packet> m_packet;        //!< MSDU or A-MSDU contained in this queue item
-        Time m_timestamp;                  //!< construction time
-        DeaggregatedMsdus m_msduList;      //!< list of aggregated MSDUs included in this MPDU
-        std::optional<Iterator> m_queueIt; //!< Queue iterator pointing to this MPDU, if queued
-        bool m_seqNoAssigned;              //!< whether a sequence number has been assigned
+        mutable Ptr<const Packet> m_packet; //!< MSDU or A-MSDU contained in this queue item
+        Time m_timestamp;                   //!< construction time
+        DeaggregatedMsdus m_msduList;       //!< list of aggregated MSDUs included in this MPDU
+        uint16_t m_amsduSize;               //!< size of the A-MSDU built by aggregation
+        std::optional<Iterator> m_queueIt;  //!< Queue iterator pointing to this MPDU, if queued
+        bool m_seqNoAssigned;               //!< whether a sequence number has been assigned
     };
 
     /**
@@ -46,6 +46,8 @@
 #include "ns3/vht-configuration.h"
 
 #include <algorithm>
+#include <optional>
+#include <unordered_map>
 
 namespace ns3
 {
@@ -1447,6 +1449,75 @@ WifiPhy::GetStartOfPacketDuration(const WifiTxVector& txVector)
     return MicroSeconds(4);
 }
 
+/**
+ * Information cached for the transmission of SU PPDUs using a given TXVECTOR in a given band
+ */
+struct WifiPhy::TxDurationInfo
+{
+    Time preambleAndHeader; //!< duration of the PHY preamble and header
+    std::optional<HtPhy::DataFieldParams> dataField; //!< Data field parameters (HT and later)
+    std::unordered_map<uint32_t, Time> payloadDurations; //!< payload duration per PSDU size
+};
+
+bool WifiPhy::m_txDurationCacheEnabled = true;
+
+namespace
+{
+
+/**
+ * \param txVector the TXVECTOR of an SU PPDU
+ * \param band the frequency band
+ * \return a key packing all the TXVECTOR parameters that affect the duration of the PPDU
+ */
+uint64_t
+GetTxDurationKey(const WifiTxVector& txVector, WifiPhyBand band)
+{
+    const auto uid = txVector.GetMode().GetUid();
+    NS_ASSERT(uid < (1 << 16));
+    NS_ASSERT(txVector.GetGuardInterval() < (1 << 12));
+    NS_ASSERT(txVector.GetNss() < (1 << 4) && txVector.GetNess() < (1 << 4));
+    uint64_t key = uid;
+    key = (key << 16) | txVector.GetChannelWidth();
+    key = (key << 12) | txVector.GetGuardInterval();
+    key = (key << 4) | txVector.GetPreambleType();
+    key = (key << 4) | txVector.GetNss();
+    key = (key << 4) | txVector.GetNess();
+    key = (key << 1) | (txVector.IsStbc() ? 1 : 0);
+    key = (key << 2) | (txVector.GetEhtPpduType() & 0x03);
+    key = (key << 3) | band;
+    return key;
+}
+
+} // namespace
+
+void
+WifiPhy::SetTxDurationCacheEnabled(bool enable)
+{
+    m_txDurationCacheEnabled = enable;
+}
+
+WifiPhy::TxDurationInfo*
+WifiPhy::GetTxDurationInfo(const WifiTxVector& txVector, WifiPhyBand band)
+{
+    if (!m_txDurationCacheEnabled || txVector.IsMu() || !txVector.GetInactiveSubchannels().empty())
+    {
+        return nullptr;
+    }
+
+    static std::unordered_map<uint64_t, TxDurationInfo> cache;
+    auto [it, inserted] = cache.try_emplace(GetTxDurationKey(txVector, band));
+    if (inserted)
+    {
+        const auto entity = GetStaticPhyEntity(txVector.GetModulationClass());
+        it->second.preambleAndHeader = entity->CalculatePhyPreambleAndHeaderDuration(txVector);
+        if (const auto htPhy = DynamicCast<const HtPhy>(entity))
+        {
+            it->second.dataField = htPhy->GetDataFieldParams(txVector, band, SU_STA_ID);
+        }
+    }
+    return &it->second;
+}
+
 Time
 WifiPhy::GetPayloadDuration(uint32_t size,
                             const WifiTxVector& txVector,
@@ -1476,20 +1547,51 @@ WifiPhy::GetPayloadDuration(uint32_t size,
                             double& totalAmpduNumSymbols,
                             uint16_t staId)
 {
-    return GetStaticPhyEntity(txVector.GetModulationClass())
-        ->GetPayloadDuration(size,
-                             txVector,
-                             band,
-                             mpdutype,
-                             incFlag,
-                             totalAmpduSize,
-                             totalAmpduNumSymbols,
-                             staId);
+    auto info = GetTxDurationInfo(txVector, band);
+    if (info && info->dataField)
+    {
+        return HtPhy::CalculatePayloadDuration(size,
+                                               *info->dataField,
+                                               mpdutype,
+                                               incFlag,
+                                               totalAmpduSize,
+                                               totalAmpduNumSymbols);
+    }
+    const auto entity = GetStaticPhyEntity(txVector.GetModulationClass());
+    if (info && mpdutype == NORMAL_MPDU)
+    {
+        auto [it, inserted] = info->payloadDurations.try_emplace(size);
+        if (inserted)
+        {
+            it->second = entity->GetPayloadDuration(size,
+                                                    txVector,
+                                                    band,
+                                                    mpdutype,
+                                                    incFlag,
+                                                    totalAmpduSize,
+                                                    totalAmpduNumSymbols,
+                                                    staId);
+        }
+        return it->second;
+    }
+    return entity->GetPayloadDuration(size,
+                                      txVector,
+                                      band,
+                                      mpdutype,
+                                      incFlag,
+                                      totalAmpduSize,
+                                      totalAmpduNumSymbols,
+                                      staId);
 }
 
 Time
 WifiPhy::CalculatePhyPreambleAndHeaderDuration(const WifiTxVector& txVector)
 {
+    // the duration of the PHY preamble and header does not depend on the band
+    if (const auto info = GetTxDurationInfo(txVector, WIFI_PHY_BAND_UNSPECIFIED))
+    {
+        return info->preambleAndHeader;
+    }
     return GetStaticPhyEntity(txVector.GetModulationClass())
         ->CalculatePhyPreambleAndHeaderDuration(txVector);
 }
@@ -1500,8 +1602,25 @@ WifiPhy::CalculateTxDuration(uint32_t size,
                              WifiPhyBand band,
                              uint16_t staId)
 {
-    Time duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
-                    GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+    Time duration;
+    if (const auto info = GetTxDurationInfo(txVector, band); info && info->dataField)
+    {
+        // fast path: a single lookup and the closed-form number of OFDM symbols
+        uint32_t totalAmpduSize;
+        double totalAmpduNumSymbols;
+        duration = info->preambleAndHeader +
+                   HtPhy::CalculatePayloadDuration(size,
+                                                   *info->dataField,
+                                                   NORMAL_MPDU,
+                                                   false,
+                                                   totalAmpduSize,
+                                                   totalAmpduNumSymbols);
+    }
+    else
+    {
+        duration = CalculatePhyPreambleAndHeaderDuration(txVector) +
+                   GetPayloadDuration(size, txVector, band, NORMAL_MPDU, staId);
+    }
     NS_ASSERT(duration.IsStrictlyPositive());
     return duration;
 }
@@ -1519,6 +1638,12 @@ WifiPhy::CalculateTxDuration(WifiConstPsduMap psduMap,
                              const WifiTxVector& txVector,
                              WifiPhyBand band)
 {
+    if (psduMap.size() == 1 && !txVector.IsMu())
+    {
+        // SU PPDU: the PHY entity would compute the TX duration of the only PSDU anyway
+        const auto& [staId, psdu] = *psduMap.cbegin();
+        return CalculateTxDuration(psdu->GetSize(), txVector, band, staId);
+    }
     return GetStaticPhyEntity(txVector.GetModulationClass())
         ->CalculateTxDuration(psduMap, txVector, band);
 }
@@ -326,6 +326,20 @@ class WifiPhy : public Object
      */
     static Time GetStartOfPacketDuration(const WifiTxVector& txVector);
 
+    /**
+     * Enable or disable the cache of the TX durations of SU PPDUs. The cache is shared
+     * by CalculateTxDuration, GetPayloadDuration and CalculatePhyPreambleAndHeaderDuration
+     * (hence by all the PHY instances) and stores, for every combination of TXVECTOR
+     * parameters and band, the duration of the PHY preamble and header and either the
+     * parameters of the Data field (HT and later, for which the number of OFDM symbols is
+     * then computed in closed form) or the payload duration per PSDU size. Enabling or
+     * disabling the cache does not alter the computed durations. The cache is enabled by
+     * default.
+     *
+     * \param enable whether the TX duration cache is enabled
+     */
+    static void SetTxDurationCacheEnabled(bool enable);
+
     /**
      * The WifiPhy::GetModeList() method is used
      * (e.g., by a WifiRemoteStationManager) to determine the set of
@@ -1487,6 +1501,21 @@ class WifiPhy : public Object
      */
     static std::map<WifiModulationClass, Ptr<PhyEntity>>& GetStaticPhyEntities();
 
+    struct TxDurationInfo;
+
+    /**
+     * Get the information cached for the transmission of SU PPDUs using the given
+     * TXVECTOR in the given band, computing it first if this is the first request.
+     *
+     * \param txVector the TXVECTOR used for the transmission
+     * \param band the frequency band
+     * \return the cached information or a null pointer if the cache is disabled or
+     *         the given TXVECTOR is not eligible (e.g., MU PPDUs)
+     */
+    static TxDurationInfo* GetTxDurationInfo(const WifiTxVector& txVector, WifiPhyBand band);
+
+    static bool m_txDurationCacheEnabled; //!< whether the TX duration cache is enabled
+
     WifiStandard m_standard;                    //!< WifiStandard
     WifiModulationClass m_maxModClassSupported; //!< max modulation class supported
     WifiPhyBand m_band;                         //!< WifiPhyBand
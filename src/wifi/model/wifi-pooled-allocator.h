@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef WIFI_POOLED_ALLOCATOR_H
+#define WIFI_POOLED_ALLOCATOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace ns3
+{
+
+/**
+ * \ingroup wifi
+ *
+ * Allocator for node-based containers (such as std::list) that serves the
+ * allocations of single objects from a pool of slabs, each holding many
+ * objects, and keeps the released objects in a free list for reuse.
+ *
+ * All the instances of this allocator share, for a given type, the same pool,
+ * hence they all compare equal and elements can be spliced between containers
+ * using this allocator. Allocating and releasing a node does not involve the
+ * global memory allocator once the pool holds enough slabs, and nodes are kept
+ * close in memory. The memory held by the pool is never returned, which allows
+ * containers with static storage duration to be safely destroyed at exit.
+ *
+ * As the rest of the simulator, this allocator is not thread-safe.
+ *
+ * \tparam T the type of the allocated objects
+ */
+template <typename T>
+class WifiPooledAllocator
+{
+  public:
+    /// The type of the allocated objects
+    using value_type = T;
+
+    WifiPooledAllocator() noexcept = default;
+
+    /**
+     * Converting constructor.
+     *
+     * \tparam U the type of the objects allocated by the given allocator
+     */
+    template <typename U>
+    WifiPooledAllocator(const WifiPooledAllocator<U>& /* other */) noexcept
+    {
+    }
+
+    /**
+     * Allocate storage for the given number of objects.
+     *
+     * \param n the number of objects
+     * \return a pointer to the allocated storage
+     */
+    T* allocate(std::size_t n)
+    {
+        if (n != 1)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(GetPool().Allocate());
+    }
+
+    /**
+     * Release the storage previously allocated for the given number of objects.
+     *
+     * \param p a pointer to the storage
+     * \param n the number of objects
+     */
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (n != 1)
+        {
+            ::operator delete(p);
+            return;
+        }
+        GetPool().Deallocate(p);
+    }
+
+    /**
+     * \tparam U the type of the objects allocated by the given allocator
+     * \return true, because all the instances share the same pool
+     */
+    template <typename U>
+    bool operator==(const WifiPooledAllocator<U>& /* other */) const noexcept
+    {
+        return true;
+    }
+
+    /**
+     * \tparam U the type of the objects allocated by the given allocator
+     * \return false, because all the instances share the same pool
+     */
+    template <typename U>
+    bool operator!=(const WifiPooledAllocator<U>& /* other */) const noexcept
+    {
+        return false;
+    }
+
+  private:
+    /// A pool of blocks of memory suitable to store an object of type T
+    class Pool
+    {
+      public:
+        /**
+         * \return a block of memory suitable to store an object of type T
+         */
+        void* Allocate()
+        {
+            if (m_free == nullptr)
+            {
+                Grow();
+            }
+            Block* block = m_free;
+            m_free = block->next;
+            return block;
+        }
+
+        /**
+         * Put the given block of memory in the free list.
+         *
+         * \param p a block of memory previously returned by Allocate()
+         */
+        void Deallocate(void* p) noexcept
+        {
+            auto block = static_cast<Block*>(p);
+            block->next = m_free;
+            m_free = block;
+        }
+
+      private:
+        /// A block of memory, which is linked into the free list when unused
+        union Block {
+            Block* next;                                 //!< next free block
+            alignas(T) unsigned char storage[sizeof(T)]; //!< storage for an object
+        };
+
+        /// Allocate a new slab and add its blocks to the free list
+        void Grow()
+        {
+            // slabs double in size, so that small pools stay small and large ones
+            // require few allocations
+            m_slabSize = (m_slabSize == 0) ? 64 : std::min<std::size_t>(2 * m_slabSize, 4096);
+            auto slab = new Block[m_slabSize];
+            m_slabs.push_back(slab);
+            for (std::size_t i = m_slabSize; i > 0; --i)
+            {
+                slab[i - 1].next = m_free;
+                m_free = &slab[i - 1];
+            }
+        }
+
+        Block* m_free{nullptr};      //!< head of the free list
+        std::size_t m_slabSize{0};   //!< size in blocks of the last allocated slab
+        std::vector<Block*> m_slabs; //!< the allocated slabs
+    };
+
+    /**
+     * \return the pool shared by all the allocators of objects of type T
+     */
+    static Pool& GetPool()
+    {
+        // never deleted, see class documentation
+        static Pool* pool = new Pool;
+        return *pool;
+    }
+};
+
+} // namespace ns3
+
+#endif /* WIFI_POOLED_ALLOCATOR_H */
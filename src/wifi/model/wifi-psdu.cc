@@ -88,25 +88,20 @@ WifiPsdu::IsAggregate() const
 Ptr<const Packet>
 WifiPsdu::GetPacket() const
 {
-    Ptr<Packet> packet = Create<Packet>();
     if (m_mpduList.size() == 1 && !m_isSingle)
     {
-        packet = m_mpduList.at(0)->GetPacket()->Copy();
-        packet->AddHeader(m_mpduList.at(0)->GetHeader());
-        AddWifiMacTrailer(packet);
+        return m_mpduList.at(0)->GetProtocolDataUnit();
     }
-    else if (m_isSingle)
-    {
-        MpduAggregator::Aggregate(m_mpduList.at(0), packet, true);
-    }
-    else
+
+    // build the A-MPDU subframes separately and concatenate them at once, so that the
+    // MPDUs aggregated first are not copied again every time an MPDU is aggregated
+    std::vector<Ptr<Packet>> subframes;
+    subframes.reserve(m_mpduList.size());
+    for (std::size_t i = 0; i < m_mpduList.size(); ++i)
     {
-        for (auto& mpdu : m_mpduList)
-        {
-            MpduAggregator::Aggregate(mpdu, packet, false);
-        }
+        subframes.push_back(GetAmpduSubframe(i));
     }
-    return packet;
+    return ConcatenatePackets(std::move(subframes));
 }
 
 Mac48Address
@@ -339,6 +339,9 @@ WifiRadioEnergyModel::ChangeState(int newState)
         // update current state & last update time stamp
         SetWifiRadioState((WifiPhyState)newState);
 
+        // notify energy source of the new current draw
+        m_source->HandleCurrentChanged();
+
         // some debug message
         NS_LOG_DEBUG("WifiRadioEnergyModel:Total energy consumption is " << m_totalEnergyConsumption
                                                                          << "J");
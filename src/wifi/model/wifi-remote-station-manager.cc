@@ -225,6 +225,7 @@ WifiRemoteStationManager::SetShortPreambleEnabled(bool enable)
 {
     NS_LOG_FUNCTION(this << enable);
     m_shortPreambleEnabled = enable;
+    ++m_txVectorGeneration;
 }
 
 void
@@ -327,6 +328,7 @@ WifiRemoteStationManager::AddSupportedPhyPreamble(Mac48Address address,
     NS_LOG_FUNCTION(this << address << isShortPreambleSupported);
     NS_ASSERT(!address.IsGroup());
     LookupState(address)->m_shortPreamble = isShortPreambleSupported;
+    ++m_txVectorGeneration;
 }
 
 void
@@ -336,12 +338,14 @@ WifiRemoteStationManager::AddSupportedErpSlotTime(Mac48Address address,
     NS_LOG_FUNCTION(this << address << isShortSlotTimeSupported);
     NS_ASSERT(!address.IsGroup());
     LookupState(address)->m_shortSlotTime = isShortSlotTimeSupported;
+    ++m_txVectorGeneration;
 }
 
 void
 WifiRemoteStationManager::AddSupportedMode(Mac48Address address, WifiMode mode)
 {
     NS_LOG_FUNCTION(this << address << mode);
+    ++m_txVectorGeneration;
     NS_ASSERT(!address.IsGroup());
     auto state = LookupState(address);
     for (const auto& i : state->m_operationalRateSet)
@@ -371,6 +375,7 @@ void
 WifiRemoteStationManager::AddAllSupportedModes(Mac48Address address)
 {
     NS_LOG_FUNCTION(this << address);
+    ++m_txVectorGeneration;
     NS_ASSERT(!address.IsGroup());
     auto state = LookupState(address);
     state->m_operationalRateSet.clear();
@@ -388,6 +393,7 @@ void
 WifiRemoteStationManager::AddAllSupportedMcs(Mac48Address address)
 {
     NS_LOG_FUNCTION(this << address);
+    ++m_txVectorGeneration;
     NS_ASSERT(!address.IsGroup());
     auto state = LookupState(address);
 
@@ -399,6 +405,7 @@ void
 WifiRemoteStationManager::RemoveAllSupportedMcs(Mac48Address address)
 {
     NS_LOG_FUNCTION(this << address);
+    ++m_txVectorGeneration;
     NS_ASSERT(!address.IsGroup());
     LookupState(address)->m_operationalMcsSet.clear();
 }
@@ -407,6 +414,7 @@ void
 WifiRemoteStationManager::AddSupportedMcs(Mac48Address address, WifiMode mcs)
 {
     NS_LOG_FUNCTION(this << address << mcs);
+    ++m_txVectorGeneration;
     NS_ASSERT(!address.IsGroup());
     auto state = LookupState(address);
     for (const auto& i : state->m_operationalMcsSet)
@@ -531,7 +539,13 @@ WifiRemoteStationManager::GetStaId(Mac48Address address, const WifiTxVector& txV
 
     uint16_t staId = SU_STA_ID;
 
-    if (txVector.IsMu())
+    if (txVector.IsUlMu() && txVector.GetHeMuUserInfoMap().size() == 1 &&
+        IsRaRuStaId(txVector.GetHeMuUserInfoMap().begin()->first))
+    {
+        // HE TB PPDU transmitted on a Random Access RU
+        staId = txVector.GetHeMuUserInfoMap().begin()->first;
+    }
+    else if (txVector.IsMu())
     {
         if (m_wifiMac->GetTypeOfStation() == AP)
         {
@@ -795,10 +809,7 @@ WifiRemoteStationManager::GetDataTxVector(const WifiMacHeader& header, uint16_t
     }
     else
     {
-        txVector = DoGetDataTxVector(Lookup(address), allowedWidth);
-        txVector.SetLdpc(txVector.GetMode().GetModulationClass() < WIFI_MOD_CLASS_HT
-                             ? false
-                             : UseLdpcForDestination(address));
+        txVector = GetUnicastDataTxVector(address, allowedWidth);
     }
     Ptr<HeConfiguration> heConfiguration = m_wifiPhy->GetDevice()->GetHeConfiguration();
     if (heConfiguration)
@@ -815,9 +826,92 @@ WifiRemoteStationManager::GetDataTxVector(const WifiMacHeader& header, uint16_t
     return txVector;
 }
 
+std::optional<WifiTxVector>
+WifiRemoteStationManager::GetLastDataTxVector(Mac48Address address) const
+{
+    NS_LOG_FUNCTION(this << address);
+    if (auto stationIt = m_stations.find(address); stationIt != m_stations.end())
+    {
+        return stationIt->second->m_lastDataTxVector;
+    }
+    return std::nullopt;
+}
+
+WifiTxVector
+WifiRemoteStationManager::GetUnicastDataTxVector(Mac48Address address, uint16_t allowedWidth)
+{
+    NS_LOG_FUNCTION(this << address << allowedWidth);
+    auto station = Lookup(address);
+    const auto rateGeneration = DoGetTxVectorGeneration(station);
+    if (IsCachedTxVectorValid(station->m_dataTxVector, rateGeneration, allowedWidth))
+    {
+        return station->m_dataTxVector->txVector;
+    }
+
+    auto txVector = DoGetDataTxVector(station, allowedWidth);
+    txVector.SetLdpc(txVector.GetMode().GetModulationClass() < WIFI_MOD_CLASS_HT
+                         ? false
+                         : UseLdpcForDestination(address));
+    station->m_lastDataTxVector = txVector;
+    if (rateGeneration)
+    {
+        station->m_dataTxVector.emplace(
+            WifiRemoteStation::CachedTxVector{*rateGeneration,
+                                              m_txVectorGeneration,
+                                              allowedWidth,
+                                              GetNumberOfAntennas(),
+                                              GetMaxNumberOfTransmitStreams(),
+                                              txVector});
+    }
+    return txVector;
+}
+
+WifiTxVector
+WifiRemoteStationManager::GetUnicastRtsTxVector(Mac48Address address)
+{
+    NS_LOG_FUNCTION(this << address);
+    auto station = Lookup(address);
+    const auto rateGeneration = DoGetTxVectorGeneration(station);
+    if (IsCachedTxVectorValid(station->m_rtsTxVector, rateGeneration, 0))
+    {
+        return station->m_rtsTxVector->txVector;
+    }
+
+    auto txVector = DoGetRtsTxVector(station);
+    if (rateGeneration)
+    {
+        station->m_rtsTxVector.emplace(
+            WifiRemoteStation::CachedTxVector{*rateGeneration,
+                                              m_txVectorGeneration,
+                                              0,
+                                              GetNumberOfAntennas(),
+                                              GetMaxNumberOfTransmitStreams(),
+                                              txVector});
+    }
+    return txVector;
+}
+
+bool
+WifiRemoteStationManager::IsCachedTxVectorValid(
+    const std::optional<WifiRemoteStation::CachedTxVector>& cached,
+    std::optional<uint64_t> rateGeneration,
+    uint16_t allowedWidth) const
+{
+    return rateGeneration && cached && cached->rateGeneration == *rateGeneration &&
+           cached->generation == m_txVectorGeneration && cached->allowedWidth == allowedWidth &&
+           cached->nAntennas == GetNumberOfAntennas() &&
+           cached->maxTxStreams == GetMaxNumberOfTransmitStreams();
+}
+
 WifiTxVector
 WifiRemoteStationManager::GetCtsToSelfTxVector()
 {
+    if (m_ctsToSelfTxVector && m_ctsToSelfTxVector->first == m_txVectorGeneration &&
+        m_ctsToSelfTxVector->second.GetNTx() == GetNumberOfAntennas())
+    {
+        return m_ctsToSelfTxVector->second;
+    }
+
     WifiMode defaultMode = GetDefaultMode();
     WifiPreamble defaultPreamble;
     if (defaultMode.GetModulationClass() == WIFI_MOD_CLASS_EHT)
@@ -841,15 +935,18 @@ WifiRemoteStationManager::GetCtsToSelfTxVector()
         defaultPreamble = WIFI_PREAMBLE_LONG;
     }
 
-    return WifiTxVector(defaultMode,
-                        GetDefaultTxPowerLevel(),
-                        defaultPreamble,
-                        ConvertGuardIntervalToNanoSeconds(defaultMode, m_wifiPhy->GetDevice()),
-                        GetNumberOfAntennas(),
-                        1,
-                        0,
-                        m_wifiPhy->GetTxBandwidth(defaultMode),
-                        false);
+    m_ctsToSelfTxVector.emplace(
+        m_txVectorGeneration,
+        WifiTxVector(defaultMode,
+                     GetDefaultTxPowerLevel(),
+                     defaultPreamble,
+                     ConvertGuardIntervalToNanoSeconds(defaultMode, m_wifiPhy->GetDevice()),
+                     GetNumberOfAntennas(),
+                     1,
+                     0,
+                     m_wifiPhy->GetTxBandwidth(defaultMode),
+                     false));
+    return m_ctsToSelfTxVector->second;
 }
 
 WifiTxVector
@@ -872,7 +969,7 @@ WifiRemoteStationManager::GetRtsTxVector(Mac48Address address, uint16_t allowedW
     }
     else
     {
-        v = DoGetRtsTxVector(Lookup(address));
+        v = GetUnicastRtsTxVector(address);
     }
     auto modulation = v.GetModulationClass();
 
@@ -1632,6 +1729,7 @@ WifiRemoteStationManager::SetQosSupport(Mac48Address from, bool qosSupported)
 {
     NS_LOG_FUNCTION(this << from << qosSupported);
     LookupState(from)->m_qosSupported = qosSupported;
+    ++m_txVectorGeneration;
 }
 
 void
@@ -1639,6 +1737,7 @@ WifiRemoteStationManager::SetEmlsrEnabled(const Mac48Address& from, bool emlsrEn
 {
     NS_LOG_FUNCTION(this << from << emlsrEnabled);
     LookupState(from)->m_emlsrEnabled = emlsrEnabled;
+    ++m_txVectorGeneration;
 }
 
 void
@@ -1646,6 +1745,7 @@ WifiRemoteStationManager::AddStationHtCapabilities(Mac48Address from, HtCapabili
 {
     // Used by all stations to record HT capabilities of remote stations
     NS_LOG_FUNCTION(this << from << htCapabilities);
+    ++m_txVectorGeneration;
     auto state = LookupState(from);
     if (htCapabilities.GetSupportedChannelWidth() == 1)
     {
@@ -1672,6 +1772,7 @@ WifiRemoteStationManager::AddStationVhtCapabilities(Mac48Address from,
 {
     // Used by all stations to record VHT capabilities of remote stations
     NS_LOG_FUNCTION(this << from << vhtCapabilities);
+    ++m_txVectorGeneration;
     auto state = LookupState(from);
     if (vhtCapabilities.GetSupportedChannelWidthSet() == 1)
     {
@@ -1699,6 +1800,7 @@ WifiRemoteStationManager::AddStationHeCapabilities(Mac48Address from, HeCapabili
 {
     // Used by all stations to record HE capabilities of remote stations
     NS_LOG_FUNCTION(this << from << heCapabilities);
+    ++m_txVectorGeneration;
     auto state = LookupState(from);
     if ((m_wifiPhy->GetPhyBand() == WIFI_PHY_BAND_5GHZ) ||
         (m_wifiPhy->GetPhyBand() == WIFI_PHY_BAND_6GHZ))
@@ -1750,6 +1852,7 @@ WifiRemoteStationManager::AddStationEhtCapabilities(Mac48Address from,
 {
     // Used by all stations to record EHT capabilities of remote stations
     NS_LOG_FUNCTION(this << from << ehtCapabilities);
+    ++m_txVectorGeneration;
     auto state = LookupState(from);
     for (const auto& mcs : m_wifiPhy->GetMcsList(WIFI_MOD_CLASS_EHT))
     {
@@ -1772,6 +1875,7 @@ WifiRemoteStationManager::AddStationMleCommonInfo(
     const std::shared_ptr<CommonInfoBasicMle>& mleCommonInfo)
 {
     NS_LOG_FUNCTION(this << from);
+    ++m_txVectorGeneration;
     auto state = LookupState(from);
     state->m_mleCommonInfo = mleCommonInfo;
     // insert another entry in m_states indexed by the MLD address and pointing to the same state
@@ -1898,6 +2002,7 @@ WifiRemoteStationManager::Reset()
     m_bssBasicMcsSet.clear();
     m_ssrc.fill(0);
     m_slrc.fill(0);
+    ++m_txVectorGeneration;
 }
 
 void
@@ -1916,6 +2021,7 @@ WifiRemoteStationManager::AddBasicMode(WifiMode mode)
         }
     }
     m_bssBasicRateSet.push_back(mode);
+    ++m_txVectorGeneration;
 }
 
 uint8_t
@@ -1983,6 +2089,7 @@ WifiRemoteStationManager::AddBasicMcs(WifiMode mcs)
         }
     }
     m_bssBasicMcsSet.push_back(mcs);
+    ++m_txVectorGeneration;
 }
 
 uint8_t
@@ -2052,6 +2159,12 @@ WifiRemoteStationManager::DoReportAmpduTxStatus(WifiRemoteStation* station,
     NS_LOG_DEBUG("DoReportAmpduTxStatus received but the manager does not handle A-MPDUs!");
 }
 
+std::optional<uint64_t>
+WifiRemoteStationManager::DoGetTxVectorGeneration(WifiRemoteStation* station) const
+{
+    return std::nullopt;
+}
+
 WifiMode
 WifiRemoteStationManager::GetSupported(const WifiRemoteStation* station, uint8_t i) const
 {
@@ -2335,6 +2448,7 @@ void
 WifiRemoteStationManager::SetDefaultTxPowerLevel(uint8_t txPower)
 {
     m_defaultTxPowerLevel = txPower;
+    ++m_txVectorGeneration;
 }
 
 uint8_t
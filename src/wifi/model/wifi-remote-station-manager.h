@@ -23,6 +23,7 @@
 #include "qos-utils.h"
 #include "wifi-mode.h"
 #include "wifi-remote-station-info.h"
+#include "wifi-tx-vector.h"
 #include "wifi-utils.h"
 
 #include "ns3/data-rate.h"
@@ -49,7 +50,6 @@ class WifiMac;
 class WifiMacHeader;
 class Packet;
 class WifiMpdu;
-class WifiTxVector;
 
 struct WifiRemoteStationState;
 struct RxSignalInfo;
@@ -72,6 +72,21 @@ struct WifiRemoteStation
     std::pair<double, Time>
         m_rssiAndUpdateTimePair; //!< RSSI (in dBm) of the most recent packet received from the
                                  //!< remote station along with update time
+
+    /// A TXVECTOR cached by the WifiRemoteStationManager
+    struct CachedTxVector
+    {
+        uint64_t rateGeneration; //!< generation published by the rate control algorithm
+        uint64_t generation;     //!< generation of the remote station manager
+        uint16_t allowedWidth;   //!< allowed width (MHz) the TXVECTOR was computed for
+        uint8_t nAntennas;       //!< number of antennas of the PHY
+        uint8_t maxTxStreams;    //!< max number of TX spatial streams of the PHY
+        WifiTxVector txVector;   //!< the cached TXVECTOR
+    };
+
+    std::optional<CachedTxVector> m_dataTxVector;   //!< cached TXVECTOR for Data frames
+    std::optional<CachedTxVector> m_rtsTxVector;    //!< cached TXVECTOR for RTS frames
+    std::optional<WifiTxVector> m_lastDataTxVector; //!< TXVECTOR last selected for Data frames
 };
 
 /**
@@ -866,6 +881,17 @@ class WifiRemoteStationManager : public Object
      * \return the TXVECTOR to use to send this packet
      */
     WifiTxVector GetDataTxVector(const WifiMacHeader& header, uint16_t allowedWidth);
+    /**
+     * Get the TXVECTOR last selected to send unicast Data frames to the given
+     * station. Unlike GetDataTxVector, this method does not invoke the rate
+     * control algorithm, hence it has no side effect on the remote station.
+     *
+     * \param address the MAC address of the remote station
+     *
+     * \return the TXVECTOR last selected to send Data frames to the given station,
+     *         if any
+     */
+    std::optional<WifiTxVector> GetLastDataTxVector(Mac48Address address) const;
     /**
      * \param address remote address
      * \param allowedWidth the allowed width in MHz for the data frame being protected
@@ -1312,7 +1338,9 @@ class WifiRemoteStationManager : public Object
     /**
      * If the given TXVECTOR is used for a MU transmission, return the STAID of
      * the station with the given address if we are an AP or our own STAID if we
-     * are a STA associated with some AP. Otherwise, return SU_STA_ID.
+     * are a STA associated with some AP. If the given TXVECTOR is used for an HE TB
+     * PPDU transmitted on a Random Access RU, return the STA-ID identifying the RA-RU.
+     * Otherwise, return SU_STA_ID.
      *
      * \param address the address of the station
      * \param txVector the TXVECTOR used for a MU transmission
@@ -1360,6 +1388,34 @@ class WifiRemoteStationManager : public Object
     virtual bool DoNeedFragmentation(WifiRemoteStation* station,
                                      Ptr<const Packet> packet,
                                      bool normally);
+    /**
+     * Get the TXVECTOR to use to send a Data frame to the given unicast address, from the
+     * cache of the station if the rate control algorithm publishes a generation counter.
+     *
+     * \param address the unicast address
+     * \param allowedWidth the allowed width in MHz to send the frame
+     * \return the TXVECTOR to use to send a Data frame to the given address
+     */
+    WifiTxVector GetUnicastDataTxVector(Mac48Address address, uint16_t allowedWidth);
+    /**
+     * Get the TXVECTOR to use to send an RTS frame to the given unicast address, from the
+     * cache of the station if the rate control algorithm publishes a generation counter.
+     *
+     * \param address the unicast address
+     * \return the TXVECTOR to use to send an RTS frame to the given address
+     */
+    WifiTxVector GetUnicastRtsTxVector(Mac48Address address);
+    /**
+     * \param cached the TXVECTOR cached for a station, if any
+     * \param rateGeneration the generation currently published by the rate control
+     *        algorithm for the station, if any
+     * \param allowedWidth the allowed width in MHz to send the frame
+     * \return whether the cached TXVECTOR can be used
+     */
+    bool IsCachedTxVectorValid(const std::optional<WifiRemoteStation::CachedTxVector>& cached,
+                               std::optional<uint64_t> rateGeneration,
+                               uint16_t allowedWidth) const;
+
     /**
      * \return a new station data structure
      */
@@ -1382,6 +1438,20 @@ class WifiRemoteStationManager : public Object
      *       to decide which transmission mode to use for the RTS.
      */
     virtual WifiTxVector DoGetRtsTxVector(WifiRemoteStation* station) = 0;
+    /**
+     * Rate control algorithms can opt in to the caching of the TXVECTORs returned by
+     * DoGetDataTxVector and DoGetRtsTxVector by publishing a generation counter for
+     * every station. The counter must change whenever such methods may return a different
+     * TXVECTOR for the station, except when the change is due to a new configuration of
+     * the station (e.g., its capabilities), of this object or of the antennas of the PHY,
+     * which is tracked by this object. Other parameters of the device (e.g., the guard
+     * interval) are assumed not to change while the stations are being served.
+     *
+     * \param station the station that we need to communicate
+     * \return the generation counter of the TXVECTORs used to transmit to the station, or
+     *         std::nullopt if such TXVECTORs cannot be cached (the default)
+     */
+    virtual std::optional<uint64_t> DoGetTxVectorGeneration(WifiRemoteStation* station) const;
 
     /**
      * This method is a pure virtual method that must be implemented by the sub-class.
@@ -1543,6 +1613,10 @@ class WifiRemoteStationManager : public Object
     StationStates m_states; //!< States of known stations
     Stations m_stations;    //!< Information for each known stations
 
+    uint64_t m_txVectorGeneration{0}; //!< incremented when the cached TXVECTORs become stale
+    std::optional<std::pair<uint64_t, WifiTxVector>>
+        m_ctsToSelfTxVector; //!< cached TXVECTOR for CTS-to-self frames and its generation
+
     WifiMode m_defaultTxMode; //!< The default transmission mode
     WifiMode m_defaultTxMcs;  //!< The default transmission modulation-coding scheme (MCS)
 
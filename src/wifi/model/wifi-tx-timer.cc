@@ -60,8 +60,9 @@ WifiTxTimer::Reschedule(const Time& delay)
         // have to reschedule Expire() (which would be executed too late otherwise)
         if (end < m_end)
         {
-            // timer expiration is moved up
-            m_timeoutEvent.Cancel();
+            // timer expiration is moved up; remove (rather than cancel) the pending event
+            // so that it does not linger in the simulator event queue
+            m_timeoutEvent.Remove();
             m_timeoutEvent = Simulator::Schedule(delay, &WifiTxTimer::Expire, this);
         }
         m_end = end;
@@ -127,7 +128,9 @@ void
 WifiTxTimer::Cancel()
 {
     NS_LOG_FUNCTION(this << GetReasonString(m_reason));
-    m_timeoutEvent.Cancel();
+    // the timer is cancelled every time the expected response is received, hence
+    // the timeout event is removed from the event queue rather than cancelled
+    m_timeoutEvent.Remove();
     m_impl = nullptr;
     m_staExpectResponseFrom.clear();
 }
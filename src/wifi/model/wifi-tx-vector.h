@@ -37,6 +37,28 @@ namespace ns3
 /// STA_ID for a RU that is intended for no user (Section 26.11.1 802.11ax-2021)
 static constexpr uint16_t NO_USER_STA_ID = 2046;
 
+/**
+ * STA-ID identifying the first Random Access RU (RA-RU) for associated stations allocated by
+ * a Trigger Frame in the TXVECTOR (TRIGVECTOR) of the solicited HE TB PPDU. AID12 values
+ * 2008 to 2044 are reserved (Table 9-31h of 802.11ax-2021) and never assigned to stations,
+ * hence they are used to identify the RA-RUs: the i-th RA-RU (starting from 0) allocated by a
+ * Trigger Frame is identified by the STA-ID RA_RU_STA_ID_BASE + i.
+ */
+static constexpr uint16_t RA_RU_STA_ID_BASE = 2008;
+
+/// Maximum number of RA-RUs that can be identified in a TXVECTOR
+static constexpr uint16_t MAX_N_RA_RU_STA_IDS = 37;
+
+/**
+ * \param staId the given STA-ID
+ * \return whether the given STA-ID identifies a RA-RU for associated stations
+ */
+inline bool
+IsRaRuStaId(uint16_t staId)
+{
+    return staId >= RA_RU_STA_ID_BASE && staId < RA_RU_STA_ID_BASE + MAX_N_RA_RU_STA_IDS;
+}
+
 /// HE MU specific user transmission parameters.
 struct HeMuUserInfo
 {
@@ -128,6 +128,27 @@ AddWifiMacTrailer(Ptr<Packet> packet)
     packet->AddTrailer(fcs);
 }
 
+Ptr<Packet>
+ConcatenatePackets(std::vector<Ptr<Packet>> packets)
+{
+    // the concatenation is a new packet, like the one returned by the Create function
+    packets.insert(packets.begin(), Create<Packet>());
+    while (packets.size() > 1)
+    {
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < packets.size(); i += 2)
+        {
+            if (i + 1 < packets.size())
+            {
+                packets[i]->AddAtEnd(packets[i + 1]);
+            }
+            packets[n++] = packets[i];
+        }
+        packets.resize(n);
+    }
+    return packets.front();
+}
+
 uint32_t
 GetSize(Ptr<const Packet> packet, const WifiMacHeader* hdr, bool isAmpdu)
 {
@@ -28,6 +28,7 @@
 #include <list>
 #include <map>
 #include <set>
+#include <vector>
 
 namespace ns3
 {
@@ -159,6 +160,17 @@ bool IsInWindow(uint16_t seq, uint16_t winstart, uint16_t winsize);
  * \param packet the packet to add a trailer to
  */
 void AddWifiMacTrailer(Ptr<Packet> packet);
+/**
+ * Concatenate the given packets. Packets are concatenated in pairs, in a
+ * balanced fashion, because every concatenation reallocates the buffer of
+ * the resulting packet: appending the packets one after another would copy
+ * the first packets again and again, while concatenating them in pairs copies
+ * every byte a number of times that is logarithmic in the number of packets.
+ *
+ * \param packets the (non-empty) list of packets to concatenate, which are modified
+ * \return the concatenation of the given packets
+ */
+Ptr<Packet> ConcatenatePackets(std::vector<Ptr<Packet>> packets);
 /**
  * Return the total size of the packet after WifiMacHeader and FCS trailer
  * have been added.
@@ -18,10 +18,14 @@
  */
 
 #include "ns3/ap-wifi-mac.h"
+#include "ns3/block-ack-manager.h"
+#include "ns3/block-ack-window.h"
 #include "ns3/boolean.h"
 #include "ns3/config.h"
 #include "ns3/ctrl-headers.h"
 #include "ns3/double.h"
+#include "ns3/fcfs-wifi-queue-scheduler.h"
+#include "ns3/mgt-action-headers.h"
 #include "ns3/mac-rx-middle.h"
 #include "ns3/mobility-helper.h"
 #include "ns3/originator-block-ack-agreement.h"
@@ -32,15 +36,22 @@
 #include "ns3/pointer.h"
 #include "ns3/qos-txop.h"
 #include "ns3/qos-utils.h"
+#include "ns3/random-variable-stream.h"
 #include "ns3/recipient-block-ack-agreement.h"
+#include "ns3/rng-seed-manager.h"
 #include "ns3/string.h"
 #include "ns3/test.h"
 #include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac-queue.h"
 #include "ns3/wifi-mpdu.h"
 #include "ns3/wifi-net-device.h"
+#include "ns3/wifi-utils.h"
 #include "ns3/yans-wifi-helper.h"
 
+#include <algorithm>
 #include <list>
+#include <map>
+#include <vector>
 
 using namespace ns3;
 
@@ -2005,6 +2016,342 @@ BlockAckAggregationDisabledTest::DoRun()
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Reference implementation of the block ack window
+ *
+ * Block ack window implemented as a vector of bool, which is updated element by element.
+ * It is used to check the correctness of BlockAckWindow.
+ */
+class ReferenceBlockAckWindow
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param winStart the window start
+     * \param winSize the window size
+     */
+    ReferenceBlockAckWindow(uint16_t winStart, uint16_t winSize)
+        : m_winStart(winStart),
+          m_window(winSize, false),
+          m_head(0)
+    {
+    }
+
+    /**
+     * \param distance the distance from the current winStart
+     * \return a reference to the element having the given distance from the current winStart
+     */
+    std::vector<bool>::reference At(std::size_t distance)
+    {
+        return m_window.at((m_head + distance) % m_window.size());
+    }
+
+    /**
+     * \param count the number of positions the current winStart must be advanced by
+     */
+    void Advance(std::size_t count)
+    {
+        if (count >= m_window.size())
+        {
+            m_window.assign(m_window.size(), false);
+            m_head = 0;
+        }
+        else
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                m_window[m_head] = false;
+                m_head = (m_head + 1) % m_window.size();
+            }
+        }
+        m_winStart = (m_winStart + count) % SEQNO_SPACE_SIZE;
+    }
+
+    /// Advance the window past the elements that are set at the head of the window
+    void AdvanceWhileSet()
+    {
+        while (At(0))
+        {
+            Advance(1);
+        }
+    }
+
+    /**
+     * \param bitmap the bitmap to fill with the elements of the window
+     */
+    void CopyTo(std::vector<uint8_t>& bitmap)
+    {
+        std::fill(bitmap.begin(), bitmap.end(), 0);
+        for (std::size_t i = 0; i < std::min(m_window.size(), bitmap.size() * 8); i++)
+        {
+            if (At(i))
+            {
+                bitmap[i / 8] |= (uint8_t(0x01) << (i % 8));
+            }
+        }
+    }
+
+    uint16_t m_winStart;        ///< window start (sequence number)
+    std::vector<bool> m_window; ///< window
+    std::size_t m_head;         ///< index of winStart in the vector
+};
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the block ack window
+ *
+ * Random sequences of operations are performed on a BlockAckWindow and on a
+ * reference implementation of the window and their content is compared after
+ * every operation.
+ */
+class BlockAckWindowTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param winSize the window size
+     */
+    BlockAckWindowTest(uint16_t winSize);
+
+  private:
+    void DoRun() override;
+
+    uint16_t m_winSize; ///< the window size
+};
+
+BlockAckWindowTest::BlockAckWindowTest(uint16_t winSize)
+    : TestCase("Check the correctness of the block ack window of size " + std::to_string(winSize)),
+      m_winSize(winSize)
+{
+}
+
+void
+BlockAckWindowTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+    auto rv = CreateObject<UniformRandomVariable>();
+    rv->SetStream(1);
+
+    uint16_t winStart = 4000;
+    BlockAckWindow window;
+    window.Init(winStart, m_winSize);
+    ReferenceBlockAckWindow reference(winStart, m_winSize);
+    std::vector<uint8_t> bitmap(m_winSize / 8 + 4);
+    std::vector<uint8_t> referenceBitmap(bitmap.size());
+
+    for (uint32_t n = 0; n < 2000; n++)
+    {
+        switch (rv->GetInteger(0, 4))
+        {
+        case 0: {
+            auto distance = rv->GetInteger(0, m_winSize - 1);
+            bool value = (rv->GetInteger(0, 3) != 0);
+            window.At(distance) = value;
+            reference.At(distance) = value;
+            break;
+        }
+        case 1: {
+            auto distance = rv->GetInteger(0, m_winSize - 1);
+            auto count = rv->GetInteger(0, m_winSize - distance);
+            bool value = (rv->GetInteger(0, 3) != 0);
+            window.Fill(distance, count, value);
+            for (std::size_t i = distance; i < distance + count; i++)
+            {
+                reference.At(i) = value;
+            }
+            break;
+        }
+        case 2: {
+            // advance by at most twice the window size
+            auto count = rv->GetInteger(0, 2 * m_winSize);
+            window.Advance(count);
+            reference.Advance(count);
+            break;
+        }
+        case 3: {
+            std::size_t first = 0;
+            while (first < m_winSize && reference.At(first))
+            {
+                first++;
+            }
+            NS_TEST_EXPECT_MSG_EQ(window.FindFirstUnset(), first, "Unexpected first unset element");
+            window.Advance(window.FindFirstUnset());
+            reference.AdvanceWhileSet();
+            break;
+        }
+        case 4: {
+            // use a bitmap smaller than the window, if possible
+            bitmap.resize(rv->GetInteger(1, m_winSize / 8 + 4));
+            referenceBitmap.resize(bitmap.size());
+            window.CopyTo(bitmap);
+            reference.CopyTo(referenceBitmap);
+            NS_TEST_EXPECT_MSG_EQ((bitmap == referenceBitmap), true, "Unexpected bitmap");
+            break;
+        }
+        }
+
+        NS_TEST_ASSERT_MSG_EQ(window.GetWinStart(), reference.m_winStart, "Unexpected winStart");
+        for (std::size_t i = 0; i < m_winSize; i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(window.At(i),
+                                  reference.At(i),
+                                  "Unexpected element at distance " << i << " (operation #" << n
+                                                                    << ")");
+        }
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the handling of the in flight MPDUs by the BlockAckManager
+ *
+ * An originator block ack agreement is established with a starting sequence number close
+ * to the end of the sequence number space. Ten MPDUs (whose sequence numbers wrap around)
+ * are stored as in flight MPDUs in an order that requires the ring of in flight MPDUs to
+ * extend both forward and backward. A BlockAck frame acknowledging all but two MPDUs is
+ * then received: the acknowledged MPDUs must be dequeued from the EDCA queue, while the
+ * other MPDUs must stay in the EDCA queue and be marked as retransmissions. The two
+ * MPDUs are then retransmitted: one is acknowledged with a normal Ack and the other
+ * one is not.
+ */
+class BlockAckManagerInFlightTest : public TestCase
+{
+  public:
+    BlockAckManagerInFlightTest();
+
+  private:
+    void DoRun() override;
+};
+
+BlockAckManagerInFlightTest::BlockAckManagerInFlightTest()
+    : TestCase("Check the handling of the in flight MPDUs by the BlockAckManager")
+{
+}
+
+void
+BlockAckManagerInFlightTest::DoRun()
+{
+    const uint8_t tid = 0;
+    const uint8_t linkId = 0;
+    const uint16_t startingSeq = 4090;
+    const auto recipient = Mac48Address::Allocate();
+
+    auto queue = CreateObject<WifiMacQueue>(AC_BE);
+    auto scheduler = CreateObject<FcfsWifiQueueScheduler>();
+    scheduler->m_perAcInfo[AC_BE].wifiMacQueue = queue;
+    queue->SetScheduler(scheduler);
+
+    auto baManager = CreateObject<BlockAckManager>();
+    baManager->SetQueue(queue);
+    baManager->SetBlockDestinationCallback(
+        Callback<void, Mac48Address, uint8_t>([](Mac48Address, uint8_t) {}));
+    baManager->SetUnblockDestinationCallback(
+        Callback<void, Mac48Address, uint8_t>([](Mac48Address, uint8_t) {}));
+
+    MgtAddBaRequestHeader reqHdr;
+    reqHdr.SetImmediateBlockAck();
+    reqHdr.SetTid(tid);
+    reqHdr.SetBufferSize(64);
+    reqHdr.SetTimeout(0);
+    reqHdr.SetStartingSequence(startingSeq);
+    baManager->CreateOriginatorAgreement(reqHdr, recipient);
+
+    MgtAddBaResponseHeader respHdr;
+    respHdr.SetImmediateBlockAck();
+    respHdr.SetTid(tid);
+    respHdr.SetBufferSize(64);
+    respHdr.SetTimeout(0);
+    baManager->UpdateOriginatorAgreement(respHdr, recipient, startingSeq);
+
+    std::map<uint16_t, Ptr<WifiMpdu>> mpdus;
+    for (uint16_t i = 0; i < 10; i++)
+    {
+        WifiMacHeader hdr;
+        hdr.SetType(WIFI_MAC_QOSDATA);
+        hdr.SetAddr1(recipient);
+        hdr.SetQosTid(tid);
+        hdr.SetSequenceNumber((startingSeq + i) % SEQNO_SPACE_SIZE);
+        auto mpdu = Create<WifiMpdu>(Create<Packet>(100), hdr);
+        queue->Enqueue(mpdu);
+        mpdu->SetInFlight(linkId);
+        mpdus[hdr.GetSequenceNumber()] = mpdu;
+    }
+
+    for (const uint16_t seq : {4092, 4093, 4094, 4095, 0, 1, 2, 3, 4091, 4090, 0})
+    {
+        baManager->StorePacket(mpdus.at(seq));
+    }
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetNBufferedPackets(recipient, tid),
+                          10,
+                          "Unexpected number of in flight MPDUs");
+
+    CtrlBAckResponseHeader blockAck;
+    blockAck.SetType(BlockAckType::COMPRESSED);
+    blockAck.SetTidInfo(tid);
+    blockAck.SetStartingSequence(startingSeq);
+    for (const auto& [seq, mpdu] : mpdus)
+    {
+        if (seq != 4092 && seq != 1)
+        {
+            blockAck.SetReceivedPacket(seq);
+        }
+    }
+
+    auto [nSuccessful, nFailed] =
+        baManager->NotifyGotBlockAck(linkId, blockAck, recipient, {tid});
+    NS_TEST_EXPECT_MSG_EQ(nSuccessful, 8, "Unexpected number of acknowledged MPDUs");
+    NS_TEST_EXPECT_MSG_EQ(nFailed, 2, "Unexpected number of failed MPDUs");
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetNBufferedPackets(recipient, tid),
+                          0,
+                          "MPDUs to retransmit should not be in flight");
+    NS_TEST_EXPECT_MSG_EQ(queue->GetNPackets(), 2, "Unexpected number of queued MPDUs");
+    for (const auto& [seq, mpdu] : mpdus)
+    {
+        const bool failed = (seq == 4092 || seq == 1);
+        NS_TEST_EXPECT_MSG_EQ(mpdu->IsQueued(), failed, "Unexpected state of MPDU " << seq);
+        NS_TEST_EXPECT_MSG_EQ(mpdu->GetHeader().IsRetry(), failed, "Unexpected Retry flag");
+    }
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetOriginatorStartingSequence(recipient, tid),
+                          4092,
+                          "Unexpected starting sequence number");
+
+    // retransmit the two MPDUs
+    for (const uint16_t seq : {1, 4092})
+    {
+        mpdus.at(seq)->SetInFlight(linkId);
+        baManager->StorePacket(mpdus.at(seq));
+    }
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetNBufferedPackets(recipient, tid),
+                          2,
+                          "Unexpected number of in flight MPDUs");
+
+    baManager->NotifyGotAck(linkId, mpdus.at(4092));
+    NS_TEST_EXPECT_MSG_EQ(mpdus.at(4092)->IsQueued(), false, "Acked MPDU should be dequeued");
+    baManager->NotifyMissedAck(linkId, mpdus.at(1));
+    NS_TEST_EXPECT_MSG_EQ(mpdus.at(1)->IsQueued(), true, "Unacked MPDU should stay queued");
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetNBufferedPackets(recipient, tid),
+                          0,
+                          "No MPDU should be in flight");
+    NS_TEST_EXPECT_MSG_EQ(baManager->GetOriginatorStartingSequence(recipient, tid),
+                          1,
+                          "Unexpected starting sequence number");
+
+    baManager->Dispose();
+    queue->Dispose();
+    scheduler->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2023,12 +2370,17 @@ BlockAckTestSuite::BlockAckTestSuite()
     AddTestCase(new PacketBufferingCaseA, TestCase::QUICK);
     AddTestCase(new PacketBufferingCaseB, TestCase::QUICK);
     AddTestCase(new OriginatorBlockAckWindowTest, TestCase::QUICK);
+    for (uint16_t winSize : {1, 16, 63, 64, 65, 100, 256, 1024})
+    {
+        AddTestCase(new BlockAckWindowTest(winSize), TestCase::QUICK);
+    }
     AddTestCase(new CtrlBAckResponseHeaderTest, TestCase::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(0), TestCase::QUICK);
     AddTestCase(new BlockAckRecipientBufferTest(4090), TestCase::QUICK);
     AddTestCase(new MultiStaCtrlBAckResponseHeaderTest, TestCase::QUICK);
     AddTestCase(new BlockAckAggregationDisabledTest(false), TestCase::QUICK);
     AddTestCase(new BlockAckAggregationDisabledTest(true), TestCase::QUICK);
+    AddTestCase(new BlockAckManagerInFlightTest, TestCase::QUICK);
 }
 
 static BlockAckTestSuite g_blockAckTestSuite; ///< the test suite
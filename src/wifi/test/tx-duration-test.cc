@@ -32,6 +32,7 @@
 
 #include <list>
 #include <numeric>
+#include <vector>
 
 using namespace ns3;
 
@@ -1788,6 +1789,227 @@ PhyHeaderSectionsTest::DoRun()
     CheckPhyHeaderSections(phyEntity->GetPhyHeaderSections(txVector, ppduStart), sections);
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Check that the TX duration cache does not alter the computed durations
+ */
+class TxDurationCacheTest : public TestCase
+{
+  public:
+    TxDurationCacheTest();
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+
+    /**
+     * Check that the durations computed for the given TXVECTOR and band are the
+     * same with and without the TX duration cache.
+     *
+     * \param txVector the TXVECTOR
+     * \param band the frequency band
+     */
+    void CheckTxVector(const WifiTxVector& txVector, WifiPhyBand band);
+
+    /**
+     * \param txVector the TXVECTOR
+     * \param band the frequency band
+     * \return the preamble, TX and payload durations of PSDUs of various sizes,
+     *         followed by the duration of the MPDUs of an A-MPDU
+     */
+    std::vector<Time> ComputeDurations(const WifiTxVector& txVector, WifiPhyBand band) const;
+};
+
+TxDurationCacheTest::TxDurationCacheTest()
+    : TestCase("Check that the TX duration cache does not alter the computed durations")
+{
+}
+
+void
+TxDurationCacheTest::DoTeardown()
+{
+    WifiPhy::SetTxDurationCacheEnabled(true);
+}
+
+std::vector<Time>
+TxDurationCacheTest::ComputeDurations(const WifiTxVector& txVector, WifiPhyBand band) const
+{
+    std::vector<uint32_t> sizes{14, 32, 100, 1500, 1536, 4095};
+    if (txVector.GetModulationClass() >= WIFI_MOD_CLASS_HT)
+    {
+        sizes.push_back(11454);
+        sizes.push_back(65535);
+    }
+
+    std::vector<Time> durations{WifiPhy::CalculatePhyPreambleAndHeaderDuration(txVector)};
+    for (auto size : sizes)
+    {
+        durations.push_back(WifiPhy::CalculateTxDuration(size, txVector, band));
+        durations.push_back(WifiPhy::GetPayloadDuration(size, txVector, band));
+    }
+    if (txVector.GetModulationClass() >= WIFI_MOD_CLASS_HT)
+    {
+        uint32_t totalAmpduSize = 0;
+        double totalAmpduNumSymbols = 0;
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            auto mpduType = (i == 0)                  ? FIRST_MPDU_IN_AGGREGATE
+                            : (i == sizes.size() - 1) ? LAST_MPDU_IN_AGGREGATE
+                                                      : MIDDLE_MPDU_IN_AGGREGATE;
+            durations.push_back(WifiPhy::GetPayloadDuration(sizes[i],
+                                                            txVector,
+                                                            band,
+                                                            mpduType,
+                                                            true,
+                                                            totalAmpduSize,
+                                                            totalAmpduNumSymbols,
+                                                            SU_STA_ID));
+        }
+    }
+    return durations;
+}
+
+void
+TxDurationCacheTest::CheckTxVector(const WifiTxVector& txVector, WifiPhyBand band)
+{
+    if (!txVector.IsValid())
+    {
+        return;
+    }
+    WifiPhy::SetTxDurationCacheEnabled(false);
+    auto expected = ComputeDurations(txVector, band);
+    WifiPhy::SetTxDurationCacheEnabled(true);
+    // the first computation populates the cache (if needed), the second one uses it
+    for (uint8_t i = 0; i < 2; ++i)
+    {
+        auto actual = ComputeDurations(txVector, band);
+        NS_TEST_EXPECT_MSG_EQ((actual == expected),
+                              true,
+                              "Unexpected durations with TX duration cache for " << txVector
+                                                                                 << " band="
+                                                                                 << band);
+    }
+}
+
+void
+TxDurationCacheTest::DoRun()
+{
+    auto check = [this](WifiMode mode,
+                        WifiPreamble preamble,
+                        uint16_t channelWidth,
+                        uint16_t guardInterval,
+                        uint8_t nss,
+                        const std::list<WifiPhyBand>& bands) {
+        WifiTxVector txVector;
+        txVector.SetMode(mode);
+        txVector.SetPreambleType(preamble);
+        txVector.SetChannelWidth(channelWidth);
+        txVector.SetGuardInterval(guardInterval);
+        txVector.SetNss(nss);
+        for (auto stbc : {false, true})
+        {
+            if (stbc && (mode.GetModulationClass() < WIFI_MOD_CLASS_HT || nss > 1))
+            {
+                continue;
+            }
+            txVector.SetStbc(stbc);
+            for (auto band : bands)
+            {
+                CheckTxVector(txVector, band);
+            }
+        }
+    };
+
+    for (uint64_t rate : {1000000, 2000000, 5500000, 11000000})
+    {
+        check(DsssPhy::GetDsssRate(rate), WIFI_PREAMBLE_LONG, 22, 800, 1, {WIFI_PHY_BAND_2_4GHZ});
+        if (rate > 1000000)
+        {
+            check(DsssPhy::GetDsssRate(rate),
+                  WIFI_PREAMBLE_SHORT,
+                  22,
+                  800,
+                  1,
+                  {WIFI_PHY_BAND_2_4GHZ});
+        }
+    }
+    for (uint64_t rate : {6000000, 9000000, 12000000, 18000000, 24000000, 36000000, 48000000,
+                          54000000})
+    {
+        check(OfdmPhy::GetOfdmRate(rate), WIFI_PREAMBLE_LONG, 20, 800, 1, {WIFI_PHY_BAND_5GHZ});
+        check(ErpOfdmPhy::GetErpOfdmRate(rate),
+              WIFI_PREAMBLE_LONG,
+              20,
+              800,
+              1,
+              {WIFI_PHY_BAND_2_4GHZ});
+    }
+    for (uint8_t mcs = 0; mcs < 32; ++mcs)
+    {
+        for (uint16_t width : {20, 40})
+        {
+            for (uint16_t gi : {400, 800})
+            {
+                check(HtPhy::GetHtMcs(mcs),
+                      WIFI_PREAMBLE_HT_MF,
+                      width,
+                      gi,
+                      1 + mcs / 8,
+                      {WIFI_PHY_BAND_2_4GHZ, WIFI_PHY_BAND_5GHZ});
+            }
+        }
+    }
+    for (uint8_t mcs = 0; mcs < 10; ++mcs)
+    {
+        for (uint16_t width : {20, 40, 80, 160})
+        {
+            for (uint16_t gi : {400, 800})
+            {
+                for (uint8_t nss : {1, 2})
+                {
+                    check(VhtPhy::GetVhtMcs(mcs),
+                          WIFI_PREAMBLE_VHT_SU,
+                          width,
+                          gi,
+                          nss,
+                          {WIFI_PHY_BAND_5GHZ});
+                }
+            }
+        }
+    }
+    for (uint8_t mcs = 0; mcs < 14; ++mcs)
+    {
+        for (uint16_t width : {20, 40, 80, 160})
+        {
+            for (uint16_t gi : {800, 1600, 3200})
+            {
+                for (uint8_t nss : {1, 2})
+                {
+                    const std::list<WifiPhyBand> bands{WIFI_PHY_BAND_2_4GHZ,
+                                                       WIFI_PHY_BAND_5GHZ,
+                                                       WIFI_PHY_BAND_6GHZ};
+                    if (mcs < 12)
+                    {
+                        check(HePhy::GetHeMcs(mcs), WIFI_PREAMBLE_HE_SU, width, gi, nss, bands);
+                        if (width == 20 && mcs < 3 && nss == 1)
+                        {
+                            check(HePhy::GetHeMcs(mcs),
+                                  WIFI_PREAMBLE_HE_ER_SU,
+                                  width,
+                                  gi,
+                                  nss,
+                                  bands);
+                        }
+                    }
+                    check(EhtPhy::GetEhtMcs(mcs), WIFI_PREAMBLE_EHT_MU, width, gi, nss, bands);
+                }
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1806,6 +2028,7 @@ TxDurationTestSuite::TxDurationTestSuite()
     AddTestCase(new TxDurationTest, TestCase::QUICK);
 
     AddTestCase(new PhyHeaderSectionsTest, TestCase::QUICK);
+    AddTestCase(new TxDurationCacheTest, TestCase::QUICK);
 
     // 20 MHz band, HeSigBDurationTest::OFDMA, even number of users per HE-SIG-B content channel
     AddTestCase(new HeSigBDurationTest(
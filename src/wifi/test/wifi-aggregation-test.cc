@@ -17,6 +17,7 @@
  * Author: Sébastien Deronne <sebastien.deronne@gmail.com>
  */
 
+#include "ns3/ampdu-subframe-header.h"
 #include "ns3/eht-configuration.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/he-configuration.h"
@@ -42,6 +43,7 @@
 #include "ns3/wifi-default-ack-manager.h"
 #include "ns3/wifi-default-protection-manager.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mac-trailer.h"
 #include "ns3/wifi-net-device.h"
 #include "ns3/wifi-psdu.h"
 #include "ns3/yans-wifi-helper.h"
@@ -1119,6 +1121,139 @@ PreservePacketsInAmpdus::DoRun()
     NS_TEST_EXPECT_MSG_EQ(m_packetList.empty(), true, "Some packets have not been forwarded up");
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Serialization of A-MPDUs of A-MSDUs
+ *
+ * A PSDU containing as many A-MSDUs as the size of the BlockAck window is built
+ * and serialized. The serialized A-MPDU is checked against the one obtained by
+ * aggregating one MPDU at a time by means of MpduAggregator::Aggregate() and is
+ * then parsed back into MPDUs and MSDUs, as done by a receiver that does not share
+ * the PSDU with the transmitter.
+ */
+class AmpduSerializationTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param nMpdus the number of MPDUs in the A-MPDU
+     * \param nMsdus the number of MSDUs in every A-MSDU
+     * \param msduSize the size in bytes of the MSDUs
+     */
+    AmpduSerializationTest(std::size_t nMpdus, std::size_t nMsdus, uint32_t msduSize);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * \return a PSDU containing the configured number of A-MSDUs
+     */
+    Ptr<WifiPsdu> BuildPsdu() const;
+
+    /**
+     * Parse the given A-MPDU into MPDUs and deaggregate the A-MSDUs.
+     *
+     * \param ampdu the A-MPDU
+     * \return the total number of MSDUs
+     */
+    std::size_t Parse(Ptr<const Packet> ampdu) const;
+
+    std::size_t m_nMpdus;        ///< number of MPDUs in the A-MPDU
+    std::size_t m_nMsdus;        ///< number of MSDUs in every A-MSDU
+    std::vector<uint8_t> m_msdu; ///< content of the MSDUs
+};
+
+AmpduSerializationTest::AmpduSerializationTest(std::size_t nMpdus,
+                                               std::size_t nMsdus,
+                                               uint32_t msduSize)
+    : TestCase("Build and parse an A-MPDU of " + std::to_string(nMpdus) + " A-MSDUs of " +
+               std::to_string(nMsdus) + " MSDUs"),
+      m_nMpdus(nMpdus),
+      m_nMsdus(nMsdus),
+      m_msdu(msduSize)
+{
+    for (std::size_t i = 0; i < m_msdu.size(); ++i)
+    {
+        m_msdu[i] = static_cast<uint8_t>(i);
+    }
+}
+
+Ptr<WifiPsdu>
+AmpduSerializationTest::BuildPsdu() const
+{
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    hdr.SetAddr1(Mac48Address("00:00:00:00:00:01"));
+    hdr.SetAddr2(Mac48Address("00:00:00:00:00:02"));
+    hdr.SetAddr3(Mac48Address("00:00:00:00:00:02"));
+    hdr.SetDsFrom();
+    hdr.SetDsNotTo();
+    hdr.SetQosTid(0);
+
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (std::size_t i = 0; i < m_nMpdus; ++i)
+    {
+        hdr.SetSequenceNumber(i);
+        auto amsdu = Create<WifiMpdu>(Create<Packet>(m_msdu.data(), m_msdu.size()), hdr);
+        for (std::size_t j = 1; j < m_nMsdus; ++j)
+        {
+            amsdu->Aggregate(
+                Create<const WifiMpdu>(Create<Packet>(m_msdu.data(), m_msdu.size()), hdr));
+        }
+        mpduList.push_back(amsdu);
+    }
+    return Create<WifiPsdu>(mpduList);
+}
+
+std::size_t
+AmpduSerializationTest::Parse(Ptr<const Packet> ampdu) const
+{
+    Ptr<Packet> packet = ampdu->Copy();
+    std::size_t nMsdus = 0;
+
+    while (packet->GetSize() > 0)
+    {
+        AmpduSubframeHeader subframeHdr;
+        packet->RemoveHeader(subframeHdr);
+        uint16_t length = subframeHdr.GetLength();
+        Ptr<Packet> mpdu = packet->CreateFragment(0, length);
+        uint32_t padding = MpduAggregator::CalculatePadding(length + 4);
+        packet->RemoveAtStart(std::min(length + padding, packet->GetSize()));
+
+        WifiMacHeader hdr;
+        mpdu->RemoveHeader(hdr);
+        WifiMacTrailer fcs;
+        mpdu->RemoveTrailer(fcs);
+        auto item = Create<WifiMpdu>(mpdu, hdr);
+        // the list of aggregated MSDUs is empty if the MPDU includes a non-aggregated MSDU
+        std::size_t dist = std::distance(item->begin(), item->end());
+        nMsdus += (dist > 0 ? dist : 1);
+    }
+    return nMsdus;
+}
+
+void
+AmpduSerializationTest::DoRun()
+{
+    auto psdu = BuildPsdu();
+    Ptr<const Packet> ampdu = psdu->GetPacket();
+    auto reference = Create<Packet>();
+    for (const auto& mpdu : *PeekPointer(psdu))
+    {
+        MpduAggregator::Aggregate(mpdu, reference, false);
+    }
+    NS_TEST_ASSERT_MSG_EQ(ampdu->GetSize(), psdu->GetSize(), "Unexpected A-MPDU size");
+    NS_TEST_ASSERT_MSG_EQ(reference->GetSize(), ampdu->GetSize(), "Unexpected A-MPDU size");
+    std::vector<uint8_t> expected(reference->GetSize());
+    std::vector<uint8_t> actual(ampdu->GetSize());
+    reference->CopyData(expected.data(), expected.size());
+    ampdu->CopyData(actual.data(), actual.size());
+    NS_TEST_EXPECT_MSG_EQ((actual == expected), true, "Unexpected A-MPDU content");
+    NS_TEST_EXPECT_MSG_EQ(Parse(ampdu), m_nMpdus * m_nMsdus, "Unexpected number of MSDUs");
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1141,6 +1276,9 @@ WifiAggregationTestSuite::WifiAggregationTestSuite()
     AddTestCase(new EhtAggregationTest(512), TestCase::QUICK);
     AddTestCase(new EhtAggregationTest(1024), TestCase::QUICK);
     AddTestCase(new PreservePacketsInAmpdus, TestCase::QUICK);
+    // HE BlockAck window of 256 MPDUs
+    AddTestCase(new AmpduSerializationTest(256, 1, 1500), TestCase::QUICK);
+    AddTestCase(new AmpduSerializationTest(256, 4, 1500), TestCase::QUICK);
 }
 
 static WifiAggregationTestSuite g_wifiAggregationTestSuite; ///< the test suite
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/analytical-edca-bss.h"
+#include "ns3/double.h"
+#include "ns3/mobility-helper.h"
+#include "ns3/rng-seed-manager.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+#include "ns3/txop.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-psdu.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <cmath>
+
+using namespace ns3;
+
+/**
+ * Create the given number of wifi devices operating as 802.11a adhoc stations.
+ *
+ * \param nStations the number of devices
+ * \return the created devices
+ */
+static NetDeviceContainer
+CreateDevices(uint32_t nStations)
+{
+    NodeContainer nodes(nStations);
+
+    auto channel = YansWifiChannelHelper::Default();
+    YansWifiPhyHelper phy;
+    phy.SetChannel(channel.Create());
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211a);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager");
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+
+    auto devices = wifi.Install(phy, mac, nodes);
+
+    MobilityHelper mobility;
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    for (uint32_t i = 0; i < nStations; ++i)
+    {
+        positionAlloc->Add(Vector(i, 0.0, 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(nodes);
+
+    return devices;
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the solution of the analytical model of the AnalyticalEdcaBss
+ *
+ * This test verifies that, with saturated stations, the transmission probability and the
+ * collision probability computed by the AnalyticalEdcaBss satisfy the equations of the
+ * Bianchi model.
+ */
+class AnalyticalEdcaBssModelTest : public TestCase
+{
+  public:
+    AnalyticalEdcaBssModelTest();
+
+  private:
+    void DoRun() override;
+};
+
+AnalyticalEdcaBssModelTest::AnalyticalEdcaBssModelTest()
+    : TestCase("Check the solution of the analytical model of the EDCA channel access")
+{
+}
+
+void
+AnalyticalEdcaBssModelTest::DoRun()
+{
+    for (const uint32_t nStations : {1, 2, 5, 10, 20})
+    {
+        auto devices = CreateDevices(nStations);
+        auto txop = DynamicCast<WifiNetDevice>(devices.Get(0))->GetMac()->GetTxop();
+        const auto w = static_cast<double>(txop->GetMinCw() + 1);
+        const auto m = std::log2((txop->GetMaxCw() + 1) / w);
+
+        auto bss = CreateObjectWithAttributes<AnalyticalEdcaBss>("OfferedLoad",
+                                                                 DoubleValue(1e6),
+                                                                 "StopTime",
+                                                                 TimeValue(Seconds(0)));
+        bss->Install(devices);
+
+        const auto tau = bss->GetTransmissionProbability();
+        const auto p = bss->GetCollisionProbability();
+
+        NS_TEST_EXPECT_MSG_EQ_TOL(bss->GetStationUtilization(),
+                                  1.0,
+                                  1e-9,
+                                  "Stations should be saturated (n=" << nStations << ")");
+        NS_TEST_EXPECT_MSG_EQ_TOL(p,
+                                  1 - std::pow(1 - tau, nStations - 1),
+                                  1e-6,
+                                  "Unexpected collision probability (n=" << nStations << ")");
+        const auto bianchiTau = 2 * (1 - 2 * p) /
+                                ((1 - 2 * p) * (w + 1) + p * w * (1 - std::pow(2 * p, m)));
+        NS_TEST_EXPECT_MSG_EQ_TOL(tau,
+                                  bianchiTau,
+                                  1e-6,
+                                  "Unexpected transmission probability (n=" << nStations << ")");
+        NS_TEST_EXPECT_MSG_GT(bss->GetChannelOccupancy(),
+                              0.5,
+                              "Saturated stations should occupy the channel (n=" << nStations
+                                                                                  << ")");
+
+        bss->Dispose();
+        Simulator::Destroy();
+    }
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the channel activity generated by the AnalyticalEdcaBss
+ *
+ * The stations of a background BSS are not saturated. This test verifies that the number
+ * of data frames transmitted by the PHYs of the stations matches the offered load and
+ * that the fraction of time the PHYs are transmitting matches the expected channel
+ * occupancy.
+ */
+class AnalyticalEdcaBssActivityTest : public TestCase
+{
+  public:
+    AnalyticalEdcaBssActivityTest();
+
+  private:
+    void DoRun() override;
+
+    uint32_t m_nDataFrames{0}; //!< number of data frames transmitted
+    Time m_txTime;             //!< time spent transmitting
+};
+
+AnalyticalEdcaBssActivityTest::AnalyticalEdcaBssActivityTest()
+    : TestCase("Check the channel activity generated by the analytical EDCA BSS model")
+{
+}
+
+void
+AnalyticalEdcaBssActivityTest::DoRun()
+{
+    RngSeedManager::SetSeed(1);
+    RngSeedManager::SetRun(1);
+
+    const uint32_t nStations = 4;
+    const double offeredLoad = 100; // packets per second per station
+    const auto duration = Seconds(5);
+
+    auto devices = CreateDevices(nStations);
+    auto bss = CreateObjectWithAttributes<AnalyticalEdcaBss>("OfferedLoad",
+                                                             DoubleValue(offeredLoad),
+                                                             "StopTime",
+                                                             TimeValue(duration));
+    bss->AssignStreams(100);
+    bss->Install(devices);
+
+    NS_TEST_EXPECT_MSG_LT(bss->GetStationUtilization(), 1, "Stations should not be saturated");
+
+    for (uint32_t i = 0; i < nStations; ++i)
+    {
+        auto phy = DynamicCast<WifiNetDevice>(devices.Get(i))->GetPhy();
+        const auto band = phy->GetPhyBand();
+        phy->TraceConnectWithoutContext(
+            "PhyTxPsduBegin",
+            Callback<void, WifiConstPsduMap, WifiTxVector, double>(
+                [this, band](WifiConstPsduMap psduMap, WifiTxVector txVector, double) {
+                    const auto& psdu = psduMap.begin()->second;
+                    if (psdu->GetHeader(0).IsQosData())
+                    {
+                        ++m_nDataFrames;
+                    }
+                    m_txTime += WifiPhy::CalculateTxDuration(psdu, txVector, band);
+                }));
+    }
+
+    Simulator::Stop(duration);
+    Simulator::Run();
+
+    // collisions involve two data frames, but they are rare with this load
+    const auto expected = nStations * offeredLoad * duration.GetSeconds();
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_nDataFrames,
+                              expected,
+                              0.1 * expected,
+                              "Unexpected number of transmitted data frames");
+    NS_TEST_EXPECT_MSG_EQ_TOL(m_txTime.GetSeconds() / duration.GetSeconds(),
+                              bss->GetChannelOccupancy(),
+                              0.1 * bss->GetChannelOccupancy(),
+                              "Unexpected channel occupancy");
+
+    bss->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Analytical EDCA BSS Test Suite
+ */
+class AnalyticalEdcaBssTestSuite : public TestSuite
+{
+  public:
+    AnalyticalEdcaBssTestSuite();
+};
+
+AnalyticalEdcaBssTestSuite::AnalyticalEdcaBssTestSuite()
+    : TestSuite("wifi-analytical-edca-bss", UNIT)
+{
+    AddTestCase(new AnalyticalEdcaBssModelTest, TestCase::QUICK);
+    AddTestCase(new AnalyticalEdcaBssActivityTest, TestCase::QUICK);
+}
+
+static AnalyticalEdcaBssTestSuite g_analyticalEdcaBssTestSuite; ///< the test suite
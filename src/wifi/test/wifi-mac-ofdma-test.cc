@@ -18,6 +18,7 @@
  */
 
 #include "ns3/config.h"
+#include "ns3/ctrl-headers.h"
 #include "ns3/he-configuration.h"
 #include "ns3/he-frame-exchange-manager.h"
 #include "ns3/he-phy.h"
@@ -28,6 +29,7 @@
 #include "ns3/packet-socket-helper.h"
 #include "ns3/packet-socket-server.h"
 #include "ns3/packet.h"
+#include "ns3/qos-txop.h"
 #include "ns3/qos-utils.h"
 #include "ns3/rng-seed-manager.h"
 #include "ns3/spectrum-wifi-helper.h"
@@ -2270,6 +2272,307 @@ OfdmaAckSequenceTest::DoRun()
     Config::SetGlobal("RngRun", UintegerValue(previousRun));
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test UL OFDMA-based random access (UORA)
+ *
+ * This test first checks that Random Access RUs are correctly encoded in a Basic Trigger
+ * Frame and in the corresponding TRIGVECTOR. Then, an AP using the Round Robin Multi-User
+ * Scheduler periodically sends Basic Trigger Frames soliciting one station and allocating
+ * Random Access RUs to the other stations, which have a very large contention window and
+ * hence mostly transmit their UL frames via UORA. This test verifies that stations transmit
+ * TB PPDUs on RA-RUs, that the AP receives some of them, that the OFDMA random access backoff
+ * counter never exceeds the maximum OFDMA contention window and that all the UL packets are
+ * received by the AP. If a single station contends for a single RA-RU and its OFDMA contention
+ * window is null, the AP receives a TB PPDU on every RU allocated by a Basic Trigger Frame
+ * whenever it receives a TB PPDU on the RA-RU; this test verifies that the AP does not wait
+ * for the TB PPDU timeout in such a case.
+ */
+class OfdmaUoraTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param nStations the number of stations
+     * \param nRaRus the number of RA-RUs allocated by every Basic Trigger Frame
+     * \param ocwMin the minimum OFDMA contention window
+     * \param ocwMax the maximum OFDMA contention window
+     */
+    OfdmaUoraTest(uint16_t nStations, uint16_t nRaRus, uint32_t ocwMin, uint32_t ocwMax);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Check the encoding of Random Access RUs in Trigger Frames and TRIGVECTORs.
+     */
+    void CheckTriggerFrame();
+
+    static constexpr uint16_t m_nPktsPerSta = 20; ///< number of UL packets per station
+    uint16_t m_nStations;                         ///< number of stations
+    uint16_t m_nRaRus;                            ///< number of RA-RUs
+    uint32_t m_ocwMin;                            ///< minimum OFDMA contention window
+    uint32_t m_ocwMax;                            ///< maximum OFDMA contention window
+    std::size_t m_nRaRuTx{0};                     ///< number of TB PPDUs sent on RA-RUs
+    std::vector<Time> m_raRuRxTimes;              ///< times TB PPDUs were received on RA-RUs
+    std::vector<Time> m_tbPpduTimeouts;           ///< times the AP's TB PPDU timer expired
+    uint32_t m_maxObo{0};                         ///< max value of the OBO counters
+    uint32_t m_received{0};                       ///< number of UL packets received by the AP
+};
+
+OfdmaUoraTest::OfdmaUoraTest(uint16_t nStations,
+                             uint16_t nRaRus,
+                             uint32_t ocwMin,
+                             uint32_t ocwMax)
+    : TestCase("Check UL OFDMA-based random access (" + std::to_string(nStations) +
+               " stations, " + std::to_string(nRaRus) + " RA-RUs, OCW in [" +
+               std::to_string(ocwMin) + ", " + std::to_string(ocwMax) + "])"),
+      m_nStations(nStations),
+      m_nRaRus(nRaRus),
+      m_ocwMin(ocwMin),
+      m_ocwMax(ocwMax)
+{
+}
+
+void
+OfdmaUoraTest::CheckTriggerFrame()
+{
+    WifiTxVector txVector;
+    txVector.SetPreambleType(WIFI_PREAMBLE_HE_TB);
+    txVector.SetChannelWidth(20);
+    txVector.SetGuardInterval(3200);
+    txVector.SetHeMuUserInfo(1, {HeRu::RuSpec(HeRu::RU_52_TONE, 1, true), 5, 1});
+    txVector.SetHeMuUserInfo(RA_RU_STA_ID_BASE, {HeRu::RuSpec(HeRu::RU_52_TONE, 2, true), 0, 1});
+    txVector.SetHeMuUserInfo(RA_RU_STA_ID_BASE + 1,
+                             {HeRu::RuSpec(HeRu::RU_52_TONE, 3, true), 0, 1});
+
+    CtrlTriggerHeader trigger(TriggerFrameType::BASIC_TRIGGER, txVector);
+    NS_TEST_EXPECT_MSG_EQ(trigger.GetNUserInfoFields(), 3, "Unexpected number of User Info");
+    NS_TEST_EXPECT_MSG_EQ(trigger.GetNRaRusAssociated(), 2, "Unexpected number of RA-RUs");
+    NS_TEST_EXPECT_MSG_EQ(trigger.FindUserInfoWithRaRuAssociated()->GetNRaRus(),
+                          1,
+                          "Expected one RA-RU per User Info field");
+
+    for (std::size_t i = 0; i < 2; ++i)
+    {
+        const uint16_t staId = RA_RU_STA_ID_BASE + i;
+        auto tbTxVector = trigger.GetHeTbTxVector(staId);
+        NS_TEST_EXPECT_MSG_EQ((tbTxVector.GetHeMuUserInfo(staId) ==
+                               txVector.GetHeMuUserInfo(staId)),
+                              true,
+                              "Unexpected user info for RA-RU " << i);
+    }
+
+    // a User Info field can allocate multiple contiguous RA-RUs
+    txVector.GetHeMuUserInfoMap().erase(RA_RU_STA_ID_BASE + 1);
+    CtrlTriggerHeader trigger2(TriggerFrameType::BASIC_TRIGGER, txVector);
+    for (auto& userInfo : trigger2)
+    {
+        if (userInfo.GetAid12() == 0)
+        {
+            userInfo.SetRaRuInformation(2, false);
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(trigger2.GetNRaRusAssociated(), 2, "Unexpected number of RA-RUs");
+    NS_TEST_EXPECT_MSG_EQ(trigger2.GetRaRuAssociated(1).second,
+                          HeRu::RuSpec(HeRu::RU_52_TONE, 3, true),
+                          "Unexpected second RA-RU");
+}
+
+void
+OfdmaUoraTest::DoRun()
+{
+    CheckTriggerFrame();
+
+    uint32_t previousSeed = RngSeedManager::GetSeed();
+    uint64_t previousRun = RngSeedManager::GetRun();
+    Config::SetGlobal("RngSeed", UintegerValue(1));
+    Config::SetGlobal("RngRun", UintegerValue(1));
+    int64_t streamNumber = 100;
+
+    NodeContainer wifiApNode(1);
+    NodeContainer wifiStaNodes(m_nStations);
+
+    auto spectrumChannel = CreateObject<MultiModelSpectrumChannel>();
+    spectrumChannel->AddPropagationLossModel(CreateObject<FriisPropagationLossModel>());
+    spectrumChannel->SetPropagationDelayModel(
+        CreateObject<ConstantSpeedPropagationDelayModel>());
+
+    SpectrumWifiPhyHelper phy;
+    phy.SetErrorRateModel("ns3::NistErrorRateModel");
+    phy.SetChannel(spectrumChannel);
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HeMcs7"));
+
+    WifiMacHelper mac;
+    Ssid ssid = Ssid("ns-3-ssid");
+    mac.SetType("ns3::StaWifiMac",
+                "Ssid",
+                SsidValue(ssid),
+                "BE_BlockAckThreshold",
+                UintegerValue(2),
+                "ActiveProbing",
+                BooleanValue(false));
+    auto staDevices = wifi.Install(phy, mac, wifiStaNodes);
+
+    mac.SetType("ns3::ApWifiMac", "BeaconGeneration", BooleanValue(true));
+    mac.SetMultiUserScheduler("ns3::RrMultiUserScheduler",
+                              "NStations",
+                              UintegerValue(1),
+                              "NRaRus",
+                              UintegerValue(m_nRaRus),
+                              "EnableBsrp",
+                              BooleanValue(false),
+                              "UlPsduSize",
+                              UintegerValue(600),
+                              "AccessReqInterval",
+                              TimeValue(MilliSeconds(2)));
+    auto apDevice = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, wifiApNode).Get(0));
+
+    streamNumber += wifi.AssignStreams(NetDeviceContainer(apDevice), streamNumber);
+    streamNumber += wifi.AssignStreams(staDevices, streamNumber);
+
+    MobilityHelper mobility;
+    auto positionAlloc = CreateObject<ListPositionAllocator>();
+    positionAlloc->Add(Vector(0.0, 0.0, 0.0));
+    for (uint16_t i = 0; i < m_nStations; i++)
+    {
+        positionAlloc->Add(Vector(1.0, i, 0.0));
+    }
+    mobility.SetPositionAllocator(positionAlloc);
+    mobility.SetMobilityModel("ns3::ConstantPositionMobilityModel");
+    mobility.Install(wifiApNode);
+    mobility.Install(wifiStaNodes);
+
+    DynamicCast<HeFrameExchangeManager>(apDevice->GetMac()->GetFrameExchangeManager())
+        ->TraceConnectWithoutContext(
+            "RaRuRx",
+            Callback<void, Mac48Address, HeRu::RuSpec>([this](Mac48Address, HeRu::RuSpec) {
+                m_raRuRxTimes.push_back(Simulator::Now());
+            }));
+    apDevice->GetMac()->TraceConnectWithoutContext(
+        "PsduMapResponseTimeout",
+        Callback<void, uint8_t, WifiPsduMap*, const std::set<Mac48Address>*, std::size_t>(
+            [this](uint8_t reason, WifiPsduMap*, const std::set<Mac48Address>*, std::size_t) {
+                if (reason == WifiTxTimer::WAIT_TB_PPDU_AFTER_BASIC_TF)
+                {
+                    m_tbPpduTimeouts.push_back(Simulator::Now());
+                }
+            }));
+
+    for (uint16_t i = 0; i < m_nStations; i++)
+    {
+        auto dev = DynamicCast<WifiNetDevice>(staDevices.Get(i));
+        // stations have a very large contention window, so that they transmit their
+        // UL frames mostly in TB PPDUs
+        dev->GetMac()->GetQosTxop(AC_BE)->SetMinCw(1023);
+        dev->GetMac()->GetQosTxop(AC_BE)->SetMaxCw(1023);
+
+        auto heFem = DynamicCast<HeFrameExchangeManager>(dev->GetMac()->GetFrameExchangeManager());
+        heFem->SetAttribute("OcwMin", UintegerValue(m_ocwMin));
+        heFem->SetAttribute("OcwMax", UintegerValue(m_ocwMax));
+        streamNumber += heFem->AssignStreams(streamNumber);
+        heFem->TraceConnectWithoutContext("RaRuTx",
+                                          Callback<void, Mac48Address, HeRu::RuSpec>(
+                                              [this](Mac48Address, HeRu::RuSpec) { ++m_nRaRuTx; }));
+        heFem->TraceConnectWithoutContext(
+            "Obo",
+            Callback<void, uint32_t, uint32_t>(
+                [this](uint32_t, uint32_t obo) { m_maxObo = std::max(m_maxObo, obo); }));
+    }
+
+    PacketSocketHelper packetSocket;
+    packetSocket.Install(wifiApNode);
+    packetSocket.Install(wifiStaNodes);
+
+    for (uint16_t i = 0; i < m_nStations; i++)
+    {
+        PacketSocketAddress socket;
+        socket.SetSingleDevice(staDevices.Get(i)->GetIfIndex());
+        socket.SetPhysicalAddress(apDevice->GetAddress());
+        socket.SetProtocol(1);
+
+        // the first client application generates two packets in order
+        // to trigger the establishment of a Block Ack agreement
+        auto client1 = CreateObject<PacketSocketClient>();
+        client1->SetAttribute("PacketSize", UintegerValue(500));
+        client1->SetAttribute("MaxPackets", UintegerValue(2));
+        client1->SetAttribute("Interval", TimeValue(MicroSeconds(0)));
+        client1->SetRemote(socket);
+        wifiStaNodes.Get(i)->AddApplication(client1);
+        client1->SetStartTime(Seconds(0.5) + i * MilliSeconds(10));
+        client1->SetStopTime(Seconds(1.0));
+
+        // the second client application periodically generates packets
+        auto client2 = CreateObject<PacketSocketClient>();
+        client2->SetAttribute("PacketSize", UintegerValue(500));
+        client2->SetAttribute("MaxPackets", UintegerValue(m_nPktsPerSta));
+        client2->SetAttribute("Interval", TimeValue(MilliSeconds(20)));
+        client2->SetRemote(socket);
+        wifiStaNodes.Get(i)->AddApplication(client2);
+        client2->SetStartTime(Seconds(1.0) + i * MilliSeconds(3));
+        client2->SetStopTime(Seconds(2.0));
+    }
+
+    PacketSocketAddress serverSocket;
+    serverSocket.SetSingleDevice(apDevice->GetIfIndex());
+    serverSocket.SetProtocol(1);
+    auto server = CreateObject<PacketSocketServer>();
+    server->SetLocal(serverSocket);
+    wifiApNode.Get(0)->AddApplication(server);
+    server->TraceConnectWithoutContext(
+        "Rx",
+        Callback<void, Ptr<const Packet>, const Address&>(
+            [this](Ptr<const Packet>, const Address&) { ++m_received; }));
+
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_GT(m_nRaRuTx, 0, "Expected TB PPDUs sent on RA-RUs");
+    NS_TEST_EXPECT_MSG_GT(m_raRuRxTimes.size(), 0, "Expected TB PPDUs received on RA-RUs");
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(m_raRuRxTimes.size(),
+                                m_nRaRuTx,
+                                "More TB PPDUs received than sent on RA-RUs");
+
+    if (m_nStations == 2 && m_nRaRus == 1 && m_ocwMax == 0)
+    {
+        // the station that is not solicited transmits on the RA-RU whenever it has frames,
+        // hence the AP has received a TB PPDU on all the RUs when it receives a TB PPDU on
+        // the RA-RU and the Multi-STA BlockAck is sent a SIFS later without waiting for the
+        // TB PPDU timeout
+        for (const auto& rxTime : m_raRuRxTimes)
+        {
+            NS_TEST_EXPECT_MSG_EQ(std::none_of(m_tbPpduTimeouts.cbegin(),
+                                               m_tbPpduTimeouts.cend(),
+                                               [&](const Time& timeout) {
+                                                   return timeout >= rxTime &&
+                                                          timeout <= rxTime + MicroSeconds(16);
+                                               }),
+                                  true,
+                                  "Unexpected TB PPDU timeout after a TB PPDU received at "
+                                      << rxTime.As(Time::US) << " on the RA-RU");
+        }
+    }
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(m_maxObo, m_ocwMax, "OBO counter exceeds the maximum OCW");
+    NS_TEST_EXPECT_MSG_EQ(m_received,
+                          m_nStations * (m_nPktsPerSta + 2),
+                          "Unexpected number of UL packets received by the AP");
+
+    Simulator::Destroy();
+
+    // Restore the seed and run number that were in effect before this test
+    Config::SetGlobal("RngSeed", UintegerValue(previousSeed));
+    Config::SetGlobal("RngRun", UintegerValue(previousRun));
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -2344,6 +2647,8 @@ WifiMacOfdmaTestSuite::WifiMacOfdmaTestSuite()
                         TestCase::QUICK);
         }
     }
+    AddTestCase(new OfdmaUoraTest(6, 4, 7, 31), TestCase::QUICK);
+    AddTestCase(new OfdmaUoraTest(2, 1, 0, 0), TestCase::QUICK);
 }
 
 static WifiMacOfdmaTestSuite g_wifiMacOfdmaTestSuite; ///< the test suite
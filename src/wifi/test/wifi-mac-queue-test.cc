@@ -17,12 +17,20 @@
  * Author: Alexander Krotov <krotov@iitp.ru>
  */
 
+#include "ns3/boolean.h"
 #include "ns3/fcfs-wifi-queue-scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/twt-airtime-wifi-queue-scheduler.h"
+#include "ns3/wifi-mac-helper.h"
 #include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/wifi-remote-station-manager.h"
+#include "ns3/yans-wifi-helper.h"
 
 #include <algorithm>
+#include <optional>
+#include <vector>
 
 using namespace ns3;
 
@@ -171,7 +179,7 @@ WifiExtractExpiredMpdusTest::Enqueue(Mac48Address rxAddr, bool inflight, Time ex
 
     auto queueId = WifiMacQueueContainer::GetQueueId(mpdu);
     auto elemIt = m_container.insert(m_container.GetQueue(queueId).cend(), mpdu);
-    elemIt->expiryTime = expiryTime;
+    m_container.SetExpiryTime(elemIt, expiryTime);
     if (inflight)
     {
         elemIt->inflights.emplace(0, mpdu);
@@ -428,6 +436,568 @@ WifiExtractExpiredMpdusTest::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test removal of expired MPDUs by the expiry timer of the MAC queue
+ *
+ * This test verifies that MPDUs with expired lifetime are removed from a WifiMacQueue
+ * (and the Expired trace source is fired) at their expiry time, even if the queue is
+ * never peeked, and that MPDUs removed from the queue before expiring are not reported.
+ */
+class WifiMacQueueExpiryTimerTest : public TestCase
+{
+  public:
+    WifiMacQueueExpiryTimerTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue the given number of MPDUs addressed to the given receiver.
+     *
+     * \param rxAddr Receiver Address of the MPDUs
+     * \param count the number of MPDUs to enqueue
+     */
+    void Enqueue(Mac48Address rxAddr, std::size_t count);
+
+    /**
+     * Check the number of expired MPDUs and the number of MPDUs left in the queue.
+     *
+     * \param nExpired the expected number of expired MPDUs
+     * \param nQueued the expected number of MPDUs left in the queue
+     */
+    void Check(std::size_t nExpired, std::size_t nQueued);
+
+    Ptr<WifiMacQueue> m_queue;        //!< MAC queue
+    std::vector<Time> m_expiryTimes;  //!< expiry times of the enqueued MPDUs
+    std::vector<Time> m_expiredTimes; //!< times the Expired trace source was fired
+};
+
+WifiMacQueueExpiryTimerTest::WifiMacQueueExpiryTimerTest()
+    : TestCase("Test removal of expired MPDUs by the expiry timer of the MAC queue")
+{
+}
+
+void
+WifiMacQueueExpiryTimerTest::Enqueue(Mac48Address rxAddr, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(rxAddr);
+        header.SetQosTid(0);
+        m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(), header));
+        m_expiryTimes.push_back(Simulator::Now() + m_queue->GetMaxDelay());
+    }
+}
+
+void
+WifiMacQueueExpiryTimerTest::Check(std::size_t nExpired, std::size_t nQueued)
+{
+    NS_TEST_EXPECT_MSG_EQ(m_expiredTimes.size(),
+                          nExpired,
+                          "Unexpected number of expired MPDUs at " << Simulator::Now());
+    NS_TEST_EXPECT_MSG_EQ(m_queue->GetNPackets(),
+                          nQueued,
+                          "Unexpected number of queued MPDUs at " << Simulator::Now());
+}
+
+void
+WifiMacQueueExpiryTimerTest::DoRun()
+{
+    m_queue = CreateObject<WifiMacQueue>(AC_BE);
+    m_queue->SetMaxDelay(MilliSeconds(10));
+    auto wifiMacScheduler = CreateObject<FcfsWifiQueueScheduler>();
+    wifiMacScheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+    m_queue->SetScheduler(wifiMacScheduler);
+    m_queue->TraceConnectWithoutContext("Expired",
+                                        Callback<void, Ptr<const WifiMpdu>>(
+                                            [this](Ptr<const WifiMpdu>) {
+                                                m_expiredTimes.push_back(Simulator::Now());
+                                            }));
+
+    auto rxAddr1 = Mac48Address::Allocate();
+    auto rxAddr2 = Mac48Address::Allocate();
+
+    /**
+     * At time 0, 4 MPDUs are enqueued for each receiver; at time 2ms, an MPDU addressed
+     * to the first receiver is removed from the queue; at time 4ms, 3 MPDUs are enqueued
+     * for the first receiver; at time 6ms, an MPDU is enqueued for the second receiver.
+     */
+    Enqueue(rxAddr1, 4);
+    Enqueue(rxAddr2, 4);
+    Simulator::Schedule(MilliSeconds(2), [&]() {
+        WifiContainerQueueId queueId{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, rxAddr1, 0};
+        auto mpdu = m_queue->PeekByQueueId(queueId);
+        NS_TEST_ASSERT_MSG_NE(mpdu, nullptr, "Expected an MPDU queued for the first receiver");
+        m_queue->Remove(mpdu);
+        m_expiryTimes.erase(m_expiryTimes.begin());
+    });
+    Simulator::Schedule(MilliSeconds(4), [&]() { Enqueue(rxAddr1, 3); });
+    Simulator::Schedule(MilliSeconds(6), [&]() { Enqueue(rxAddr2, 1); });
+
+    // the queue is never peeked after time 2ms, hence MPDUs can only be removed by the timer
+    Simulator::Schedule(MilliSeconds(10) + NanoSeconds(1), [&]() { Check(7, 4); });
+    Simulator::Schedule(MilliSeconds(14) + NanoSeconds(1), [&]() { Check(10, 1); });
+    Simulator::Schedule(MilliSeconds(16) + NanoSeconds(1), [&]() { Check(11, 0); });
+
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_expiredTimes.size(),
+                          m_expiryTimes.size(),
+                          "Unexpected number of expired MPDUs");
+    for (std::size_t i = 0; i < m_expiryTimes.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_expiredTimes[i],
+                              m_expiryTimes[i],
+                              "MPDU #" << i << " not reported at its expiry time");
+    }
+
+    m_queue->Dispose();
+    m_queue = nullptr;
+    wifiMacScheduler->Dispose();
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the Deficit Round Robin scheme of the TwtAirtimeWifiQueueScheduler
+ *
+ * Two stations have 6 MPDUs each queued. The MPDUs of the first station are older,
+ * hence a FCFS scheduler would serve all of them before the MPDUs of the second station.
+ * Given that the quantum is such that a station can transmit at most two MPDUs per round,
+ * this test verifies that the stations are served alternately, two MPDUs at a time.
+ */
+class TwtAirtimeWifiQueueSchedulerTest : public TestCase
+{
+  public:
+    TwtAirtimeWifiQueueSchedulerTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue the given number of MPDUs addressed to the given receiver.
+     *
+     * \param rxAddr Receiver Address of the MPDUs
+     * \param count the number of MPDUs to enqueue
+     */
+    void Enqueue(Mac48Address rxAddr, std::size_t count);
+
+    /// Serve the queues until they are empty, in the order selected by the scheduler
+    void ServeQueues();
+
+    Ptr<WifiMacQueue> m_queue;                        //!< MAC queue
+    Ptr<TwtAirtimeWifiQueueScheduler> m_scheduler;    //!< MAC queue scheduler
+    std::vector<Mac48Address> m_served;              //!< receivers of the dequeued MPDUs
+    static constexpr uint32_t m_payloadSize = 970;    //!< size of the MSDUs
+    static constexpr uint32_t m_mpduAirtimeUs = 1334; //!< MPDU airtime at 6 Mbps (rounded up)
+};
+
+TwtAirtimeWifiQueueSchedulerTest::TwtAirtimeWifiQueueSchedulerTest()
+    : TestCase("Test the DRR scheme of the TWT airtime wifi queue scheduler")
+{
+}
+
+void
+TwtAirtimeWifiQueueSchedulerTest::Enqueue(Mac48Address rxAddr, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(rxAddr);
+        header.SetQosTid(0);
+        m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(m_payloadSize), header));
+    }
+}
+
+void
+TwtAirtimeWifiQueueSchedulerTest::ServeQueues()
+{
+    while (auto queueId = m_scheduler->GetNext(AC_BE, std::nullopt))
+    {
+        auto mpdu = m_queue->PeekByQueueId(*queueId);
+        NS_TEST_ASSERT_MSG_NE(mpdu, nullptr, "Expected an MPDU in the selected queue");
+        m_served.push_back(mpdu->GetHeader().GetAddr1());
+        m_queue->DequeueIfQueued({mpdu});
+    }
+}
+
+void
+TwtAirtimeWifiQueueSchedulerTest::DoRun()
+{
+    m_queue = CreateObject<WifiMacQueue>(AC_BE);
+    m_scheduler = CreateObjectWithAttributes<TwtAirtimeWifiQueueScheduler>(
+        "Quantum",
+        TimeValue(MicroSeconds(2 * m_mpduAirtimeUs - 100)));
+    m_scheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+    m_queue->SetScheduler(m_scheduler);
+
+    auto rxAddr1 = Mac48Address::Allocate();
+    auto rxAddr2 = Mac48Address::Allocate();
+
+    Enqueue(rxAddr1, 6);
+    Simulator::Schedule(MilliSeconds(1), [&]() { Enqueue(rxAddr2, 6); });
+    Simulator::Schedule(MilliSeconds(2), &TwtAirtimeWifiQueueSchedulerTest::ServeQueues, this);
+    Simulator::Run();
+
+    const std::vector<Mac48Address> expected{rxAddr1,
+                                             rxAddr1,
+                                             rxAddr2,
+                                             rxAddr2,
+                                             rxAddr1,
+                                             rxAddr1,
+                                             rxAddr2,
+                                             rxAddr2,
+                                             rxAddr1,
+                                             rxAddr1,
+                                             rxAddr2,
+                                             rxAddr2};
+    NS_TEST_ASSERT_MSG_EQ(m_served.size(), expected.size(), "Unexpected number of served MPDUs");
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_served[i], expected[i], "Unexpected receiver of MPDU #" << i);
+    }
+
+    // after three rounds, the deficit of each station is the quantum minus the airtime
+    // exceeding the quantum in each of the three rounds
+    NS_TEST_EXPECT_MSG_EQ(m_scheduler->GetDeficit(AC_BE, rxAddr1),
+                          m_scheduler->GetDeficit(AC_BE, rxAddr2),
+                          "Stations using the same rate should have the same deficit");
+    NS_TEST_EXPECT_MSG_LT(m_scheduler->GetDeficit(AC_BE, rxAddr1),
+                          MicroSeconds(2 * m_mpduAirtimeUs - 100),
+                          "Deficit should be lower than the quantum");
+
+    m_queue->Dispose();
+    m_queue = nullptr;
+    m_scheduler->Dispose();
+    m_scheduler = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the SP deadline ordering of the TwtAirtimeWifiQueueScheduler
+ *
+ * An AP has established a TWT agreement with two stations, whose TWT SPs start at the
+ * same time and end at different times. While both TWT SPs are ongoing, MPDUs addressed
+ * to the station whose TWT SP ends later, to a station that has no TWT agreement and to
+ * the station whose TWT SP ends earlier are enqueued, in this order. This test verifies
+ * that the station whose TWT SP ends earlier is served first, then the other station
+ * having a TWT agreement and finally the station that has no TWT agreement, regardless
+ * of the airtime consumed by every station.
+ */
+class TwtAirtimeSpDeadlineTest : public TestCase
+{
+  public:
+    TwtAirtimeSpDeadlineTest();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue the given number of MPDUs addressed to the given receiver.
+     *
+     * \param rxAddr Receiver Address of the MPDUs
+     * \param count the number of MPDUs to enqueue
+     */
+    void Enqueue(Mac48Address rxAddr, std::size_t count);
+
+    /// Enqueue MPDUs for all the stations and serve the queues until they are empty
+    void EnqueueAndServe();
+
+    Ptr<WifiMacQueue> m_queue;                     //!< MAC queue
+    Ptr<WifiMacQueueScheduler> m_scheduler;        //!< MAC queue scheduler
+    Mac48Address m_apAddress;                      //!< MAC address of the AP
+    Mac48Address m_lateSpEndSta;                   //!< station whose TWT SP ends later
+    Mac48Address m_earlySpEndSta;                  //!< station whose TWT SP ends earlier
+    Mac48Address m_noTwtSta;                       //!< station with no TWT agreement
+    std::vector<Mac48Address> m_served;            //!< receivers of the dequeued MPDUs
+    static constexpr uint32_t m_payloadSize = 970; //!< size of the MSDUs
+};
+
+TwtAirtimeSpDeadlineTest::TwtAirtimeSpDeadlineTest()
+    : TestCase("Test the SP deadline ordering of the TWT airtime wifi queue scheduler")
+{
+}
+
+void
+TwtAirtimeSpDeadlineTest::Enqueue(Mac48Address rxAddr, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        WifiMacHeader header(WIFI_MAC_QOSDATA);
+        header.SetAddr1(rxAddr);
+        header.SetAddr2(m_apAddress);
+        header.SetQosTid(0);
+        m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(m_payloadSize), header));
+    }
+}
+
+void
+TwtAirtimeSpDeadlineTest::EnqueueAndServe()
+{
+    Enqueue(m_lateSpEndSta, 2);
+    Enqueue(m_noTwtSta, 2);
+    Enqueue(m_earlySpEndSta, 2);
+
+    while (auto queueId = m_scheduler->GetNext(AC_BE, std::nullopt))
+    {
+        auto mpdu = m_queue->PeekByQueueId(*queueId);
+        NS_TEST_ASSERT_MSG_NE(mpdu, nullptr, "Expected an MPDU in the selected queue");
+        m_served.push_back(mpdu->GetHeader().GetAddr1());
+        m_queue->DequeueIfQueued({mpdu});
+    }
+}
+
+void
+TwtAirtimeSpDeadlineTest::DoRun()
+{
+    // the queue scheduler needs an AP MAC to get the TWT agreements
+    NodeContainer node(1);
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211ax);
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::ApWifiMac", "BeaconGeneration", BooleanValue(false));
+    mac.SetMacQueueScheduler("ns3::TwtAirtimeWifiQueueScheduler");
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, node).Get(0));
+
+    m_queue = device->GetMac()->GetTxopQueue(AC_BE);
+    m_scheduler = device->GetMac()->GetMacQueueScheduler();
+    m_apAddress = device->GetMac()->GetAddress();
+    m_lateSpEndSta = Mac48Address::Allocate();
+    m_earlySpEndSta = Mac48Address::Allocate();
+    m_noTwtSta = Mac48Address::Allocate();
+
+    // both TWT SPs start after 1 ms; the TWT SP of the first station lasts 8 ms, the
+    // TWT SP of the second station lasts 4 ms
+    auto manager = device->GetRemoteStationManager();
+    manager->CreateTwtAgreement(0,
+                                m_lateSpEndSta,
+                                false,
+                                true,
+                                true,
+                                false,
+                                true,
+                                0,
+                                MilliSeconds(100),
+                                MilliSeconds(8),
+                                MilliSeconds(1),
+                                Time());
+    manager->CreateTwtAgreement(0,
+                                m_earlySpEndSta,
+                                false,
+                                true,
+                                true,
+                                false,
+                                true,
+                                0,
+                                MilliSeconds(100),
+                                MilliSeconds(4),
+                                MilliSeconds(1),
+                                Time());
+
+    Simulator::Schedule(MilliSeconds(2), &TwtAirtimeSpDeadlineTest::EnqueueAndServe, this);
+    // TWT SPs are periodic, hence stop the simulation
+    Simulator::Stop(MilliSeconds(3));
+    Simulator::Run();
+
+    const std::vector<Mac48Address> expected{m_earlySpEndSta,
+                                             m_earlySpEndSta,
+                                             m_lateSpEndSta,
+                                             m_lateSpEndSta,
+                                             m_noTwtSta,
+                                             m_noTwtSta};
+    NS_TEST_ASSERT_MSG_EQ(m_served.size(), expected.size(), "Unexpected number of served MPDUs");
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_served[i], expected[i], "Unexpected receiver of MPDU #" << i);
+    }
+
+    m_queue = nullptr;
+    m_scheduler = nullptr;
+    Simulator::Destroy();
+}
+
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the CoDel active queue management of the WifiMacQueue
+ *
+ * MPDUs addressed to the first station are enqueued every millisecond and served every
+ * 1.1 milliseconds, hence the container queue of the first station keeps growing, while
+ * MPDUs addressed to the second station are enqueued every 20 milliseconds and served
+ * one millisecond later. This test verifies that, if CoDel is enabled, MPDUs addressed
+ * to the first station are dropped (and reported as expired) so that their sojourn time
+ * is kept low, while no MPDU addressed to the second station is dropped. If CoDel is
+ * disabled, no MPDU is dropped and the sojourn time of the first station keeps growing.
+ * The lifetime of the MPDUs is changed halfway, which must not affect the sojourn time.
+ */
+class WifiMacQueueCoDelTest : public TestCase
+{
+  public:
+    /**
+     * Constructor
+     *
+     * \param enableCoDel whether CoDel is enabled
+     */
+    WifiMacQueueCoDelTest(bool enableCoDel);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Enqueue an MPDU addressed to the given receiver.
+     *
+     * \param rxAddr Receiver Address of the MPDU
+     */
+    void Enqueue(Mac48Address rxAddr);
+
+    /**
+     * Dequeue the MPDU at the head of the container queue of the given receiver, if any.
+     *
+     * \param rxAddr Receiver Address of the MPDU
+     * \return the sojourn time of the dequeued MPDU, if any
+     */
+    std::optional<Time> Serve(Mac48Address rxAddr);
+
+    bool m_enableCoDel;                  //!< whether CoDel is enabled
+    Ptr<WifiMacQueue> m_queue;           //!< MAC queue
+    std::vector<Mac48Address> m_dropped; //!< receivers of the MPDUs dropped by CoDel
+    std::size_t m_nExpired{0};           //!< number of expired MPDUs
+    std::optional<Time> m_sojournTime;   //!< sojourn time of the last dequeued MPDU
+};
+
+WifiMacQueueCoDelTest::WifiMacQueueCoDelTest(bool enableCoDel)
+    : TestCase(std::string("Test CoDel in the MAC queue ") +
+               (enableCoDel ? "enabled" : "disabled")),
+      m_enableCoDel(enableCoDel)
+{
+}
+
+void
+WifiMacQueueCoDelTest::Enqueue(Mac48Address rxAddr)
+{
+    WifiMacHeader header(WIFI_MAC_QOSDATA);
+    header.SetAddr1(rxAddr);
+    header.SetQosTid(0);
+    m_queue->Enqueue(Create<WifiMpdu>(Create<Packet>(1000), header));
+}
+
+std::optional<Time>
+WifiMacQueueCoDelTest::Serve(Mac48Address rxAddr)
+{
+    m_sojournTime.reset();
+    if (auto mpdu = m_queue->PeekByTidAndAddress(0, rxAddr))
+    {
+        m_queue->DequeueIfQueued({mpdu});
+    }
+    return m_sojournTime;
+}
+
+void
+WifiMacQueueCoDelTest::DoRun()
+{
+    m_queue = CreateObject<WifiMacQueue>(AC_BE);
+    m_queue->SetMaxSize(QueueSize("10000p"));
+    m_queue->SetMaxDelay(Seconds(10));
+    m_queue->SetAttribute("EnableCoDel", BooleanValue(m_enableCoDel));
+    auto wifiMacScheduler = CreateObject<FcfsWifiQueueScheduler>();
+    wifiMacScheduler->m_perAcInfo[AC_BE].wifiMacQueue = m_queue;
+    m_queue->SetScheduler(wifiMacScheduler);
+    m_queue->TraceConnectWithoutContext("CoDelDrop",
+                                        Callback<void, Ptr<const WifiMpdu>>(
+                                            [this](Ptr<const WifiMpdu> mpdu) {
+                                                m_dropped.push_back(mpdu->GetHeader().GetAddr1());
+                                            }));
+    m_queue->TraceConnectWithoutContext(
+        "Expired",
+        Callback<void, Ptr<const WifiMpdu>>([this](Ptr<const WifiMpdu>) { ++m_nExpired; }));
+    m_queue->TraceConnectWithoutContext(
+        "SojournTime",
+        Callback<void, Time>([this](Time sojournTime) { m_sojournTime = sojournTime; }));
+
+    auto rxAddr1 = Mac48Address::Allocate();
+    auto rxAddr2 = Mac48Address::Allocate();
+    const auto duration = Seconds(5);
+    Time lastSojournTime1;
+    Time maxSojournTime2;
+
+    for (auto t = Time{0}; t < duration; t += MilliSeconds(1))
+    {
+        Simulator::Schedule(t, [=, this]() { Enqueue(rxAddr1); });
+    }
+    for (auto t = MicroSeconds(500); t < duration; t += MicroSeconds(1100))
+    {
+        Simulator::Schedule(t, [&, this]() {
+            if (auto sojournTime = Serve(rxAddr1))
+            {
+                lastSojournTime1 = *sojournTime;
+            }
+        });
+    }
+    for (auto t = Time{0}; t < duration; t += MilliSeconds(20))
+    {
+        Simulator::Schedule(t, [=, this]() { Enqueue(rxAddr2); });
+        Simulator::Schedule(t + MilliSeconds(1), [&, this]() {
+            auto sojournTime = Serve(rxAddr2);
+            NS_TEST_EXPECT_MSG_EQ(sojournTime.has_value(),
+                                  true,
+                                  "Expected an MPDU for the second station at "
+                                      << Simulator::Now());
+            maxSojournTime2 = Max(maxSojournTime2, sojournTime.value_or(Time{0}));
+        });
+    }
+    // changing the lifetime of the MPDUs does not affect the sojourn time of the MPDUs
+    // that are already queued
+    Simulator::Schedule(duration / 2 + MicroSeconds(500),
+                        &WifiMacQueue::SetMaxDelay,
+                        m_queue,
+                        Seconds(20));
+    // stop before the lifetime of the MPDUs left in the queue expires
+    Simulator::Stop(duration);
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(maxSojournTime2,
+                          MilliSeconds(1),
+                          "Unexpected sojourn time of the second station");
+    NS_TEST_EXPECT_MSG_EQ(std::count(m_dropped.cbegin(), m_dropped.cend(), rxAddr2),
+                          0,
+                          "No MPDU addressed to the second station should be dropped");
+    NS_TEST_EXPECT_MSG_EQ(m_nExpired,
+                          m_dropped.size(),
+                          "MPDUs dropped by CoDel should be reported as expired");
+
+    if (m_enableCoDel)
+    {
+        NS_TEST_EXPECT_MSG_GT(m_dropped.size(), 0, "Expected MPDUs dropped by CoDel");
+        NS_TEST_EXPECT_MSG_LT(lastSojournTime1,
+                              MilliSeconds(100),
+                              "CoDel should keep the sojourn time of the first station low");
+    }
+    else
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_dropped.size(), 0, "No MPDU should be dropped by CoDel");
+        NS_TEST_EXPECT_MSG_GT(lastSojournTime1,
+                              MilliSeconds(400),
+                              "The sojourn time of the first station should keep growing");
+    }
+
+    m_queue->Dispose();
+    m_queue = nullptr;
+    wifiMacScheduler->Dispose();
+    Simulator::Destroy();
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -445,6 +1015,11 @@ WifiMacQueueTestSuite::WifiMacQueueTestSuite()
 {
     AddTestCase(new WifiMacQueueDropOldestTest, TestCase::QUICK);
     AddTestCase(new WifiExtractExpiredMpdusTest, TestCase::QUICK);
+    AddTestCase(new WifiMacQueueExpiryTimerTest, TestCase::QUICK);
+    AddTestCase(new TwtAirtimeWifiQueueSchedulerTest, TestCase::QUICK);
+    AddTestCase(new TwtAirtimeSpDeadlineTest, TestCase::QUICK);
+    AddTestCase(new WifiMacQueueCoDelTest(true), TestCase::QUICK);
+    AddTestCase(new WifiMacQueueCoDelTest(false), TestCase::QUICK);
 }
 
 static WifiMacQueueTestSuite g_wifiMacQueueTestSuite; ///< the test suite
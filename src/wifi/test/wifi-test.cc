@@ -3532,6 +3532,160 @@ IdealRateManagerMimoTest::DoRun()
     Simulator::Destroy();
 }
 
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the cache of the TXVECTORs of the remote station manager
+ *
+ * A ConstantRateWifiManager (which publishes a TXVECTOR generation counter) is used to
+ * obtain the TXVECTOR to send Data frames to a remote station. This test verifies that
+ * the returned TXVECTOR reflects the allowed width, the capabilities of the remote station
+ * and the number of antennas of the PHY, even if they change after the TXVECTOR has been
+ * cached.
+ */
+class WifiTxVectorCacheTest : public TestCase
+{
+  public:
+    WifiTxVectorCacheTest();
+
+  private:
+    void DoRun() override;
+};
+
+WifiTxVectorCacheTest::WifiTxVectorCacheTest()
+    : TestCase("Check the cache of the TXVECTORs of the remote station manager")
+{
+}
+
+void
+WifiTxVectorCacheTest::DoRun()
+{
+    NodeContainer nodes(1);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::ConstantRateWifiManager",
+                                 "DataMode",
+                                 StringValue("HtMcs7"),
+                                 "ControlMode",
+                                 StringValue("HtMcs0"));
+
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    phy.Set("ChannelSettings", StringValue("{38, 40, BAND_5GHZ, 0}"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, nodes).Get(0));
+    auto manager = device->GetRemoteStationManager();
+
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    hdr.SetAddr1(Mac48Address::Allocate());
+
+    auto txVector = manager->GetDataTxVector(hdr, 40);
+    NS_TEST_EXPECT_MSG_EQ(txVector.GetMode(), HtPhy::GetHtMcs7(), "Unexpected mode");
+    NS_TEST_EXPECT_MSG_EQ(txVector.GetChannelWidth(), 40, "Unexpected channel width");
+    NS_TEST_EXPECT_MSG_EQ(+txVector.GetNTx(), 1, "Unexpected number of TX antennas");
+
+    // the TXVECTOR is cached per allowed width
+    NS_TEST_EXPECT_MSG_EQ(manager->GetDataTxVector(hdr, 40).GetChannelWidth(),
+                          40,
+                          "Unexpected channel width of the cached TXVECTOR");
+    NS_TEST_EXPECT_MSG_EQ(manager->GetDataTxVector(hdr, 20).GetChannelWidth(),
+                          20,
+                          "The allowed width should be taken into account");
+
+    // the remote station only supports 20 MHz channels
+    HtCapabilities htCapabilities;
+    htCapabilities.SetSupportedChannelWidth(0);
+    htCapabilities.SetRxMcsBitmask(7);
+    manager->AddStationHtCapabilities(hdr.GetAddr1(), htCapabilities);
+    NS_TEST_EXPECT_MSG_EQ(manager->GetDataTxVector(hdr, 40).GetChannelWidth(),
+                          20,
+                          "The capabilities of the remote station should be taken into account");
+
+    // the PHY uses two antennas
+    device->GetPhy()->SetNumberOfAntennas(2);
+    NS_TEST_EXPECT_MSG_EQ(+manager->GetDataTxVector(hdr, 40).GetNTx(),
+                          2,
+                          "The number of antennas should be taken into account");
+
+    Simulator::Destroy();
+}
+
+//-----------------------------------------------------------------------------
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Test the selection of the MCSs supported by the remote station by the Ideal manager
+ *
+ * The Ideal rate manager looks up the SNR threshold tables built at initialization to select
+ * the MCS with the highest data rate whose SNR threshold is smaller than the last observed SNR.
+ * This test verifies that only the MCSs supported by the remote station are selected.
+ */
+class IdealRateManagerSupportedMcsTest : public TestCase
+{
+  public:
+    IdealRateManagerSupportedMcsTest();
+
+  private:
+    void DoRun() override;
+};
+
+IdealRateManagerSupportedMcsTest::IdealRateManagerSupportedMcsTest()
+    : TestCase("Check the selection of the supported MCSs by the Ideal rate manager")
+{
+}
+
+void
+IdealRateManagerSupportedMcsTest::DoRun()
+{
+    NodeContainer nodes(1);
+
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    wifi.SetRemoteStationManager("ns3::IdealWifiManager");
+
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    phy.Set("ChannelSettings", StringValue("{36, 20, BAND_5GHZ, 0}"));
+
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, nodes).Get(0));
+    auto manager = device->GetRemoteStationManager();
+
+    WifiTxVector dataTxVector;
+    dataTxVector.SetMode(HtPhy::GetHtMcs0());
+    dataTxVector.SetChannelWidth(20);
+    dataTxVector.SetNss(1);
+
+    // a high SNR (50 dB) is observed for two stations, the first of which only supports
+    // MCSs 0 to 3
+    for (const uint8_t maxMcs : {3, 7})
+    {
+        WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+        hdr.SetAddr1(Mac48Address::Allocate());
+        HtCapabilities htCapabilities;
+        for (uint8_t mcs = 0; mcs <= maxMcs; ++mcs)
+        {
+            htCapabilities.SetRxMcsBitmask(mcs);
+        }
+        manager->AddStationHtCapabilities(hdr.GetAddr1(), htCapabilities);
+        manager->ReportAmpduTxStatus(hdr.GetAddr1(), 1, 0, 1e5, 1e5, dataTxVector);
+
+        NS_TEST_EXPECT_MSG_EQ(manager->GetDataTxVector(hdr, 20).GetMode(),
+                              HtPhy::GetHtMcs(maxMcs),
+                              "Unexpected mode selected for a station supporting MCSs up to "
+                                  << +maxMcs);
+    }
+
+    Simulator::Destroy();
+}
+
 //-----------------------------------------------------------------------------
 /**
  * \ingroup wifi-test
@@ -3809,6 +3963,8 @@ WifiTestSuite::WifiTestSuite()
     AddTestCase(new Issue169TestCase, TestCase::QUICK);           // Issue #169
     AddTestCase(new IdealRateManagerChannelWidthTest, TestCase::QUICK);
     AddTestCase(new IdealRateManagerMimoTest, TestCase::QUICK);
+    AddTestCase(new WifiTxVectorCacheTest, TestCase::QUICK);
+    AddTestCase(new IdealRateManagerSupportedMcsTest, TestCase::QUICK);
     AddTestCase(new HeRuMcsDataRateTestCase, TestCase::QUICK);
     AddTestCase(new WifiMgtHeaderTest, TestCase::QUICK);
 }
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Stress benchmark of Simulator::ScheduleWithContext invoked concurrently
+ * by many producer threads, as done by emulation devices and the realtime
+ * simulator, while the main thread keeps executing its own events.
+ */
+class ContextEventsBench
+{
+  public:
+    /**
+     * Constructor
+     * \param [in] threads The number of producer threads.
+     * \param [in] events The number of events scheduled by each producer thread.
+     * \param [in] mainEvents The number of events kept in the main event queue.
+     */
+    ContextEventsBench(uint32_t threads, uint64_t events, uint64_t mainEvents)
+        : m_threads(threads),
+          m_events(events),
+          m_mainEvents(mainEvents),
+          m_received(0),
+          m_mainExecuted(0)
+    {
+    }
+
+    /**
+     * Run the benchmark.
+     * \return the wall-clock time in seconds
+     */
+    double Run();
+
+    /** \return the number of events executed by the main thread */
+    uint64_t GetMainExecuted() const
+    {
+        return m_mainExecuted;
+    }
+
+  private:
+    /** Start the producer threads. */
+    void StartProducers();
+    /**
+     * Body of a producer thread.
+     * \param [in] context The context of the events scheduled by the thread.
+     */
+    void Produce(uint32_t context);
+    /** Event scheduled by the producer threads. */
+    void Received();
+    /** Event of the main thread, which keeps the main event queue busy. */
+    void MainEvent();
+
+    uint32_t m_threads;                   //!< number of producer threads
+    uint64_t m_events;                    //!< number of events per producer thread
+    uint64_t m_mainEvents;                //!< population of the main event queue
+    uint64_t m_received;                  //!< number of events received from the producers
+    uint64_t m_mainExecuted;              //!< number of events executed by the main thread
+    std::vector<std::thread> m_producers; //!< the producer threads
+};
+
+double
+ContextEventsBench::Run()
+{
+    SystemWallClockMs timer;
+    timer.Start();
+    Simulator::ScheduleNow(&ContextEventsBench::StartProducers, this);
+    for (uint64_t i = 0; i < m_mainEvents; ++i)
+    {
+        Simulator::Schedule(NanoSeconds(i), &ContextEventsBench::MainEvent, this);
+    }
+    Simulator::Run();
+    for (auto& producer : m_producers)
+    {
+        producer.join();
+    }
+    double elapsed = timer.End() / 1000.0;
+    Simulator::Destroy();
+    return elapsed;
+}
+
+void
+ContextEventsBench::StartProducers()
+{
+    for (uint32_t i = 0; i < m_threads; ++i)
+    {
+        m_producers.emplace_back(&ContextEventsBench::Produce, this, i);
+    }
+}
+
+void
+ContextEventsBench::Produce(uint32_t context)
+{
+    for (uint64_t i = 0; i < m_events; ++i)
+    {
+        Simulator::ScheduleWithContext(context,
+                                       NanoSeconds(1),
+                                       &ContextEventsBench::Received,
+                                       this);
+    }
+}
+
+void
+ContextEventsBench::Received()
+{
+    if (++m_received == m_threads * m_events)
+    {
+        Simulator::Stop();
+    }
+}
+
+void
+ContextEventsBench::MainEvent()
+{
+    ++m_mainExecuted;
+    Simulator::Schedule(NanoSeconds(m_mainEvents), &ContextEventsBench::MainEvent, this);
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t threads = 8;
+    uint64_t events = 100000;
+    uint64_t mainEvents = 100;
+    uint32_t runs = 1;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Stress benchmark of the insertion of events from different threads.\n"
+              "\n"
+              "Each producer thread schedules events with Simulator::ScheduleWithContext\n"
+              "while the main thread executes a fixed population of its own events.");
+    cmd.AddValue("threads", "number of producer threads", threads);
+    cmd.AddValue("events", "number of events scheduled by each producer thread", events);
+    cmd.AddValue("main", "number of events kept in the main event queue", mainEvents);
+    cmd.AddValue("runs", "number of runs", runs);
+    cmd.Parse(argc, argv);
+
+    LOG("Producer threads:             " << threads);
+    LOG("Events per producer thread:   " << events);
+    LOG("Main event queue population:  " << mainEvents);
+    LOG("");
+    LOG(std::setw(6) << "run" << std::setw(14) << "time (s)" << std::setw(16) << "events/s"
+                     << std::setw(16) << "main events");
+
+    for (uint32_t run = 0; run < runs; ++run)
+    {
+        ContextEventsBench bench(threads, events, mainEvents);
+        double elapsed = bench.Run();
+        LOG(std::setw(6) << run << std::setw(14) << elapsed << std::setw(16)
+                         << (elapsed > 0 ? threads * events / elapsed : 0) << std::setw(16)
+                         << bench.GetMainExecuted());
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Benchmark of the global routing setup with a large LAN.
+ *
+ * The given number of stations share a LAN with a router, which is connected
+ * to a server by a point-to-point link.  The time taken to populate the
+ * routing tables and to update them after a station joins the LAN is measured.
+ *
+ * \param [in] nStations The number of stations.
+ * \param [out] populate The time in seconds taken to populate the routing tables.
+ * \param [out] update The time in seconds taken to update the routing tables.
+ */
+void
+Run(uint32_t nStations, double& populate, double& update)
+{
+    NodeContainer router;
+    router.Create(1);
+    NodeContainer stations;
+    stations.Create(nStations);
+    NodeContainer server;
+    server.Create(1);
+
+    InternetStackHelper internet;
+    Ipv4GlobalRoutingHelper ipv4RoutingHelper;
+    internet.SetRoutingHelper(ipv4RoutingHelper);
+    internet.Install(NodeContainer(router, stations, server));
+
+    SimpleNetDeviceHelper simpleHelper;
+    Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+    NetDeviceContainer devices = simpleHelper.Install(router.Get(0), channel);
+    devices.Add(simpleHelper.Install(stations, channel));
+    simpleHelper.SetNetDevicePointToPointMode(true);
+    NetDeviceContainer devicesServer =
+        simpleHelper.Install(NodeContainer(router.Get(0), server.Get(0)));
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.0.0.0", "255.0.0.0");
+    ipv4.Assign(devices);
+    ipv4.SetBase("11.0.0.0", "255.255.255.252");
+    ipv4.Assign(devicesServer);
+
+    SystemWallClockMs timer;
+    timer.Start();
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+    populate = timer.End() / 1000.0;
+
+    Ptr<Node> newStation = CreateObject<Node>();
+    internet.Install(newStation);
+    ipv4.SetBase("10.0.0.0", "255.0.0.0", Ipv4Address(nStations + 2));
+    simpleHelper.SetNetDevicePointToPointMode(false);
+    ipv4.Assign(simpleHelper.Install(newStation, channel));
+    timer.Start();
+    Ipv4GlobalRoutingHelper::UpdateRoutingTables();
+    update = timer.End() / 1000.0;
+
+    Ptr<Ipv4GlobalRouting> globalRouting =
+        newStation->GetObject<Ipv4>()->GetRoutingProtocol()->GetObject<Ipv4GlobalRouting>();
+    NS_ABORT_MSG_IF(globalRouting->GetNRoutes() == 0, "No route on the new station");
+
+    Simulator::Destroy();
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string stationsList = "1000,10000";
+    uint32_t spfThreads = 1;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark of the global routing setup with a large LAN.\n"
+              "\n"
+              "Reports the time taken to populate the routing tables and to update them\n"
+              "after a station joins the LAN.");
+    cmd.AddValue("stations", "comma separated list of numbers of stations", stationsList);
+    cmd.AddValue("spfThreads", "number of threads running the SPF calculations", spfThreads);
+    cmd.Parse(argc, argv);
+
+    GlobalValue::Bind("GlobalRoutingSpfThreads", UintegerValue(spfThreads));
+
+    LOG("SPF threads: " << spfThreads);
+    LOG("");
+    LOG(std::setw(10) << "stations" << std::setw(16) << "populate (s)" << std::setw(14)
+                      << "update (s)");
+
+    std::istringstream iss(stationsList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        uint32_t nStations = std::stoul(token);
+        double populate = 0;
+        double update = 0;
+        Run(nStations, populate, update);
+        LOG(std::setw(10) << nStations << std::setw(16) << populate << std::setw(14) << update);
+    }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Split a comma separated list.
+ * \param [in] list The comma separated list.
+ * \return the elements of the list
+ */
+std::vector<std::string>
+Split(const std::string& list)
+{
+    std::vector<std::string> elements;
+    std::istringstream iss(list);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        elements.push_back(token);
+    }
+    return elements;
+}
+
+/**
+ * Draw values from a random variable stream.
+ * \param [in] typeId The TypeId of the random variable.
+ * \param [in] batchSize The batch size (zero to disable batching).
+ * \param [in] count The number of values to draw.
+ * \return the number of values drawn per second
+ */
+double
+Draw(const std::string& typeId, uint32_t batchSize, uint64_t count)
+{
+    ObjectFactory factory(typeId);
+    factory.Set("BatchSize", UintegerValue(batchSize));
+    auto rv = factory.Create<RandomVariableStream>();
+
+    double sum = 0;
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint64_t i = 0; i < count; ++i)
+    {
+        sum += rv->GetValue();
+    }
+    double elapsed = timer.End() / 1000.0;
+
+    // use the values, so that drawing them is not optimized away
+    NS_ABORT_MSG_IF(count > 0 && sum == 0, "The values drawn are all zero");
+    return elapsed > 0 ? count / elapsed : 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string typeIds = "ns3::UniformRandomVariable,ns3::WeibullRandomVariable";
+    std::string batchSizes = "0,64,1024";
+    uint64_t count = 50000000;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark of the random variable streams with and without batching of\n"
+              "the uniform randoms (BatchSize attribute).");
+    cmd.AddValue("types", "comma separated list of random variable TypeIds", typeIds);
+    cmd.AddValue("batchSizes", "comma separated list of batch sizes (0: no batching)", batchSizes);
+    cmd.AddValue("count", "number of values drawn for every configuration", count);
+    cmd.Parse(argc, argv);
+
+    LOG("Values per configuration: " << count);
+    LOG("");
+    LOG(std::setw(36) << "type" << std::setw(8) << "batch" << std::setw(14) << "Mdraws/s");
+
+    for (const auto& typeId : Split(typeIds))
+    {
+        for (const auto& batchSize : Split(batchSizes))
+        {
+            auto rate = Draw(typeId, std::stoul(batchSize), count);
+            LOG(std::setw(36) << typeId << std::setw(8) << batchSize << std::setw(14)
+                              << rate / 1e6);
+        }
+    }
+
+    return 0;
+}
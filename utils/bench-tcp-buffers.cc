@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/packet.h"
+#include "ns3/tcp-header.h"
+#include "ns3/tcp-option-sack.h"
+#include "ns3/tcp-rx-buffer.h"
+#include "ns3/tcp-tx-buffer.h"
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/** Size of the segments */
+static const uint32_t SEGMENT_SIZE = 1000;
+
+/**
+ * Process the SACK blocks of a large window.
+ *
+ * A window of segments is sent and one segment every lossInterval is lost. For every
+ * other segment, the receiver sends an ACK carrying the SACK block that contains the
+ * segment and the three most recently reported SACK blocks, as per RFC 2018. The
+ * scoreboard is updated and the first hole is checked for loss at every ACK, as done
+ * by TcpSocketBase.
+ *
+ * \param [in] nSegments The number of segments in the window.
+ * \param [in] lossInterval One segment every lossInterval is lost.
+ * \return the number of ACKs processed per second
+ */
+double
+BenchTxBuffer(uint32_t nSegments, uint32_t lossInterval)
+{
+    const SequenceNumber32 head(1);
+
+    TcpTxBuffer txBuf;
+    txBuf.SetHeadSequence(head);
+    txBuf.SetSegmentSize(SEGMENT_SIZE);
+    txBuf.SetDupAckThresh(3);
+    txBuf.SetMaxBufferSize(nSegments * SEGMENT_SIZE);
+    txBuf.Add(Create<Packet>(nSegments * SEGMENT_SIZE));
+
+    for (uint32_t i = 0; i < nSegments; i++)
+    {
+        txBuf.CopyFromSequence(SEGMENT_SIZE, head + i * SEGMENT_SIZE);
+    }
+
+    TcpOptionSack::SackList blocks; // most recently reported block first
+    uint32_t nAcks = 0;
+
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint32_t i = 1; i < nSegments; i++)
+    {
+        if (i % lossInterval == 0)
+        {
+            continue;
+        }
+
+        const SequenceNumber32 seq = head + i * SEGMENT_SIZE;
+        if (i % lossInterval == 1 || blocks.empty())
+        {
+            blocks.emplace_front(seq, seq + SEGMENT_SIZE);
+            if (blocks.size() > 4)
+            {
+                blocks.pop_back();
+            }
+        }
+        else
+        {
+            blocks.front().second = seq + SEGMENT_SIZE;
+        }
+
+        txBuf.Update(blocks);
+        txBuf.IsLost(head);
+        nAcks++;
+    }
+    double elapsed = timer.End() / 1000.0;
+
+    NS_ABORT_MSG_IF(!txBuf.IsLost(head), "The first segment should be lost");
+    return elapsed > 0 ? nAcks / elapsed : 0;
+}
+
+/**
+ * Reassemble a large window received out of order.
+ *
+ * One segment every lossInterval is lost and retransmitted after the rest of the
+ * window has been received, so that the receive buffer holds many out of order
+ * segments when the segments are added and when the holes are filled.
+ *
+ * \param [in] nSegments The number of segments in the window.
+ * \param [in] lossInterval One segment every lossInterval is lost.
+ * \return the number of segments processed per second
+ */
+double
+BenchRxBuffer(uint32_t nSegments, uint32_t lossInterval)
+{
+    const SequenceNumber32 head(1);
+
+    TcpRxBuffer rxBuf;
+    rxBuf.SetNextRxSequence(head);
+    rxBuf.SetMaxBufferSize(nSegments * SEGMENT_SIZE);
+    auto p = Create<Packet>(SEGMENT_SIZE);
+    TcpHeader h;
+
+    SystemWallClockMs timer;
+    timer.Start();
+    for (const bool retransmission : {false, true})
+    {
+        for (uint32_t i = 0; i < nSegments; i++)
+        {
+            if ((i % lossInterval == 0) == retransmission)
+            {
+                h.SetSequenceNumber(head + i * SEGMENT_SIZE);
+                rxBuf.Add(p, h);
+            }
+        }
+    }
+    double elapsed = timer.End() / 1000.0;
+
+    NS_ABORT_MSG_IF(rxBuf.NextRxSequence() != head + nSegments * SEGMENT_SIZE,
+                    "Unexpected RCV.NXT");
+    return elapsed > 0 ? nSegments / elapsed : 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    std::string segmentsList = "1000,10000,100000";
+    uint32_t lossInterval = 100;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark of the TCP transmit and receive buffers with large windows.\n"
+              "\n"
+              "Reports the number of ACKs carrying SACK blocks processed per second by\n"
+              "TcpTxBuffer and the number of out of order segments reassembled per second\n"
+              "by TcpRxBuffer.");
+    cmd.AddValue("segments", "comma separated list of window sizes in segments", segmentsList);
+    cmd.AddValue("lossInterval", "one segment every lossInterval is lost", lossInterval);
+    cmd.Parse(argc, argv);
+
+    NS_ABORT_MSG_IF(lossInterval < 2, "The loss interval must be at least 2");
+
+    LOG("Segment size (bytes): " << SEGMENT_SIZE);
+    LOG("Loss interval:        " << lossInterval);
+    LOG("");
+    LOG(std::setw(10) << "segments" << std::setw(16) << "tx ACKs/s" << std::setw(16)
+                      << "rx segments/s");
+
+    std::istringstream iss(segmentsList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        uint32_t nSegments = std::stoul(token);
+        LOG(std::setw(10) << nSegments << std::setw(16) << BenchTxBuffer(nSegments, lossInterval)
+                          << std::setw(16) << BenchRxBuffer(nSegments, lossInterval));
+    }
+
+    return 0;
+}
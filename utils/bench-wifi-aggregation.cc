@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/ampdu-subframe-header.h"
+#include "ns3/core-module.h"
+#include "ns3/mpdu-aggregator.h"
+#include "ns3/wifi-mac-header.h"
+#include "ns3/wifi-mac-trailer.h"
+#include "ns3/wifi-mpdu.h"
+#include "ns3/wifi-psdu.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Benchmark of building and parsing A-MPDUs of A-MSDUs.
+ *
+ * PSDUs containing the given number of A-MSDUs are built and serialized; the
+ * serialized A-MPDU is then parsed back into MPDUs and MSDUs, as done by a
+ * receiver that does not share the PSDU with the transmitter.
+ */
+class AggregationBench
+{
+  public:
+    /**
+     * Constructor
+     * \param [in] nMpdus The number of MPDUs in the A-MPDU.
+     * \param [in] nMsdus The number of MSDUs in every A-MSDU.
+     * \param [in] msduSize The size in bytes of the MSDUs.
+     */
+    AggregationBench(std::size_t nMpdus, std::size_t nMsdus, uint32_t msduSize)
+        : m_nMpdus(nMpdus),
+          m_nMsdus(nMsdus),
+          m_msdu(msduSize)
+    {
+        for (std::size_t i = 0; i < m_msdu.size(); ++i)
+        {
+            m_msdu[i] = static_cast<uint8_t>(i);
+        }
+    }
+
+    /**
+     * Build the given number of A-MPDUs and then parse them.
+     * \param [in] iterations The number of A-MPDUs to build and parse.
+     */
+    void Run(uint32_t iterations);
+
+    /** \return the time in seconds spent building the A-MPDUs */
+    double GetBuildTime() const
+    {
+        return m_buildTime;
+    }
+
+    /** \return the time in seconds spent parsing the A-MPDUs */
+    double GetParseTime() const
+    {
+        return m_parseTime;
+    }
+
+    /** \return the total size in bytes of the A-MPDUs */
+    uint64_t GetBytes() const
+    {
+        return m_bytes;
+    }
+
+  private:
+    /** \return a PSDU containing the configured number of A-MSDUs */
+    Ptr<WifiPsdu> BuildPsdu() const;
+
+    /**
+     * Parse the given A-MPDU into MPDUs and deaggregate the A-MSDUs.
+     * \param [in] ampdu The A-MPDU.
+     * \return the total number of MSDUs
+     */
+    std::size_t Parse(Ptr<const Packet> ampdu) const;
+
+    std::size_t m_nMpdus;        //!< number of MPDUs in the A-MPDU
+    std::size_t m_nMsdus;        //!< number of MSDUs in every A-MSDU
+    std::vector<uint8_t> m_msdu; //!< content of the MSDUs
+    double m_buildTime{0};       //!< time spent building the A-MPDUs (s)
+    double m_parseTime{0};       //!< time spent parsing the A-MPDUs (s)
+    uint64_t m_bytes{0};         //!< total size of the A-MPDUs
+};
+
+Ptr<WifiPsdu>
+AggregationBench::BuildPsdu() const
+{
+    WifiMacHeader hdr(WIFI_MAC_QOSDATA);
+    hdr.SetAddr1(Mac48Address("00:00:00:00:00:01"));
+    hdr.SetAddr2(Mac48Address("00:00:00:00:00:02"));
+    hdr.SetAddr3(Mac48Address("00:00:00:00:00:02"));
+    hdr.SetDsFrom();
+    hdr.SetDsNotTo();
+    hdr.SetQosTid(0);
+
+    std::vector<Ptr<WifiMpdu>> mpduList;
+    for (std::size_t i = 0; i < m_nMpdus; ++i)
+    {
+        hdr.SetSequenceNumber(i);
+        auto amsdu = Create<WifiMpdu>(Create<Packet>(m_msdu.data(), m_msdu.size()), hdr);
+        for (std::size_t j = 1; j < m_nMsdus; ++j)
+        {
+            amsdu->Aggregate(
+                Create<const WifiMpdu>(Create<Packet>(m_msdu.data(), m_msdu.size()), hdr));
+        }
+        mpduList.push_back(amsdu);
+    }
+    return Create<WifiPsdu>(mpduList);
+}
+
+std::size_t
+AggregationBench::Parse(Ptr<const Packet> ampdu) const
+{
+    Ptr<Packet> packet = ampdu->Copy();
+    std::size_t nMsdus = 0;
+
+    while (packet->GetSize() > 0)
+    {
+        AmpduSubframeHeader subframeHdr;
+        packet->RemoveHeader(subframeHdr);
+        uint16_t length = subframeHdr.GetLength();
+        Ptr<Packet> mpdu = packet->CreateFragment(0, length);
+        uint32_t padding = MpduAggregator::CalculatePadding(length + 4);
+        packet->RemoveAtStart(std::min(length + padding, packet->GetSize()));
+
+        WifiMacHeader hdr;
+        mpdu->RemoveHeader(hdr);
+        WifiMacTrailer fcs;
+        mpdu->RemoveTrailer(fcs);
+        auto item = Create<WifiMpdu>(mpdu, hdr);
+        // the list of aggregated MSDUs is empty if the MPDU includes a non-aggregated MSDU
+        std::size_t dist = std::distance(item->begin(), item->end());
+        nMsdus += (dist > 0 ? dist : 1);
+    }
+    return nMsdus;
+}
+
+void
+AggregationBench::Run(uint32_t iterations)
+{
+    std::vector<Ptr<const Packet>> ampdus;
+    ampdus.reserve(iterations);
+
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        ampdus.push_back(BuildPsdu()->GetPacket());
+    }
+    m_buildTime = timer.End() / 1000.0;
+
+    std::size_t nMsdus = 0;
+    timer.Start();
+    for (const auto& ampdu : ampdus)
+    {
+        nMsdus += Parse(ampdu);
+    }
+    m_parseTime = timer.End() / 1000.0;
+
+    NS_ABORT_MSG_IF(nMsdus != iterations * m_nMpdus * m_nMsdus, "Unexpected number of MSDUs");
+    for (const auto& ampdu : ampdus)
+    {
+        m_bytes += ampdu->GetSize();
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nMpdus = 256;
+    uint32_t msduSize = 1500;
+    uint32_t iterations = 200;
+    std::string nMsdusList = "1,4";
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark of building and parsing A-MPDUs of A-MSDUs.\n"
+              "\n"
+              "The default number of MPDUs corresponds to the HE BlockAck window.");
+    cmd.AddValue("mpdus", "number of MPDUs in the A-MPDU", nMpdus);
+    cmd.AddValue("msdus", "comma separated list of numbers of MSDUs per A-MSDU", nMsdusList);
+    cmd.AddValue("msduSize", "size in bytes of the MSDUs", msduSize);
+    cmd.AddValue("iterations", "number of A-MPDUs built and parsed", iterations);
+    cmd.Parse(argc, argv);
+
+    LOG("MPDUs per A-MPDU:  " << nMpdus);
+    LOG("MSDU size (bytes): " << msduSize);
+    LOG("Iterations:        " << iterations);
+    LOG("");
+    LOG(std::setw(8) << "MSDUs" << std::setw(16) << "build (MB/s)" << std::setw(16)
+                     << "parse (MB/s)");
+
+    std::istringstream iss(nMsdusList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        std::size_t nMsdus = std::stoul(token);
+        AggregationBench bench(nMpdus, nMsdus, msduSize);
+        bench.Run(iterations);
+        auto throughput = [&bench](double time) {
+            return time > 0 ? bench.GetBytes() / time / 1e6 : 0;
+        };
+        LOG(std::setw(8) << nMsdus << std::setw(16) << throughput(bench.GetBuildTime())
+                         << std::setw(16) << throughput(bench.GetParseTime()));
+    }
+
+    return 0;
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/block-ack-window.h"
+#include "ns3/core-module.h"
+#include "ns3/wifi-utils.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Block ack window implemented as a vector of bool, which is updated element
+ * by element. It is the baseline BlockAckWindow is compared against.
+ */
+class BitByBitWindow
+{
+  public:
+    /**
+     * Constructor
+     * \param [in] winSize The window size.
+     */
+    BitByBitWindow(uint16_t winSize)
+        : m_window(winSize, false),
+          m_head(0)
+    {
+    }
+
+    /**
+     * \param [in] distance The distance from the current winStart.
+     * \return a reference to the element having the given distance from winStart
+     */
+    std::vector<bool>::reference At(std::size_t distance)
+    {
+        return m_window[(m_head + distance) % m_window.size()];
+    }
+
+    /**
+     * \param [in] count The number of positions winStart must be advanced by.
+     */
+    void Advance(std::size_t count)
+    {
+        if (count >= m_window.size())
+        {
+            m_window.assign(m_window.size(), false);
+            m_head = 0;
+            return;
+        }
+        for (std::size_t i = 0; i < count; i++)
+        {
+            m_window[m_head] = false;
+            m_head = (m_head + 1) % m_window.size();
+        }
+    }
+
+    /** Advance the window past the elements that are set at the head of the window */
+    void AdvanceWhileSet()
+    {
+        while (At(0))
+        {
+            Advance(1);
+        }
+    }
+
+    /**
+     * \param [in] bitmap The bitmap to fill with the elements of the window.
+     */
+    void CopyTo(std::vector<uint8_t>& bitmap)
+    {
+        std::fill(bitmap.begin(), bitmap.end(), 0);
+        for (std::size_t i = 0; i < std::min(m_window.size(), bitmap.size() * 8); i++)
+        {
+            if (At(i))
+            {
+                bitmap[i / 8] |= (uint8_t(0x01) << (i % 8));
+            }
+        }
+    }
+
+  private:
+    std::vector<bool> m_window; //!< window
+    std::size_t m_head;         //!< index of winStart in the vector
+};
+
+/**
+ * Microbenchmark of the block ack window.
+ *
+ * Each round emulates the exchange of a BlockAck acknowledging a whole window of
+ * MPDUs but one: the recipient records the received MPDUs in its scoreboard, which
+ * is copied to the BlockAck bitmap; the originator records the acknowledged MPDUs
+ * in its transmit window, which is advanced up to the first unacknowledged MPDU and
+ * then past the whole window once the missing MPDU is acknowledged (as if it were
+ * retransmitted).
+ *
+ * \tparam Window The type of windows.
+ * \param [in] recipient The recipient's scoreboard.
+ * \param [in] originator The originator's transmit window.
+ * \param [in] winSize The window size.
+ * \param [in] rounds The number of rounds.
+ * \return the number of rounds per second
+ */
+template <class Window>
+double
+RunRounds(Window& recipient, Window& originator, uint16_t winSize, uint32_t rounds)
+{
+    std::vector<uint8_t> bitmap(winSize / 8);
+    std::size_t lost = winSize / 2;
+
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint32_t n = 0; n < rounds; n++)
+    {
+        for (std::size_t i = 0; i < winSize; i++)
+        {
+            if (i != lost)
+            {
+                recipient.At(i) = true;
+            }
+        }
+        recipient.CopyTo(bitmap);
+
+        for (std::size_t i = 0; i < winSize; i++)
+        {
+            if ((bitmap[i / 8] >> (i % 8)) & 0x01)
+            {
+                originator.At(i) = true;
+            }
+        }
+        if constexpr (std::is_same_v<Window, BlockAckWindow>)
+        {
+            originator.Advance(originator.FindFirstUnset());
+            originator.At(0) = true;
+            originator.Advance(originator.FindFirstUnset());
+        }
+        else
+        {
+            originator.AdvanceWhileSet();
+            originator.At(0) = true;
+            originator.AdvanceWhileSet();
+        }
+        recipient.Advance(winSize);
+    }
+    double elapsed = timer.End() / 1000.0;
+
+    NS_ABORT_MSG_IF(originator.At(0), "Expected the transmit window to be empty");
+    return elapsed > 0 ? rounds / elapsed : 0;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t mpdus = 12800000;
+    std::string winSizeList = "64,256,1024";
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Microbenchmark of the block ack window.\n"
+              "\n"
+              "Reports the number of BlockAcks per second processed by BlockAckWindow\n"
+              "and by a window updated bit by bit.");
+    cmd.AddValue("winSizes", "comma separated list of window sizes (multiple of 8)", winSizeList);
+    cmd.AddValue("mpdus", "number of MPDUs acknowledged for every window size", mpdus);
+    cmd.Parse(argc, argv);
+
+    LOG("MPDUs per window size: " << mpdus);
+    LOG("");
+    LOG(std::setw(10) << "window" << std::setw(14) << "rounds" << std::setw(20)
+                      << "BlockAckWindow/s" << std::setw(16) << "bit by bit/s");
+
+    std::istringstream iss(winSizeList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        uint16_t winSize = std::stoul(token);
+        NS_ABORT_MSG_IF(winSize == 0 || winSize % 8 != 0 || winSize > 1024,
+                        "Invalid window size: " << winSize);
+        uint32_t rounds = mpdus / winSize;
+
+        BlockAckWindow recipient;
+        recipient.Init(0, winSize);
+        BlockAckWindow originator;
+        originator.Init(0, winSize);
+        auto rate = RunRounds(recipient, originator, winSize, rounds);
+        NS_ABORT_MSG_IF(originator.GetWinStart() != (uint64_t{rounds} * winSize) % SEQNO_SPACE_SIZE,
+                        "Unexpected winStart of the transmit window");
+
+        BitByBitWindow bitRecipient(winSize);
+        BitByBitWindow bitOriginator(winSize);
+        auto bitRate = RunRounds(bitRecipient, bitOriginator, winSize, rounds);
+
+        LOG(std::setw(10) << winSize << std::setw(14) << rounds << std::setw(20) << rate
+                          << std::setw(16) << bitRate);
+    }
+
+    return 0;
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/wifi-mac-queue.h"
+#include "ns3/wifi-mac.h"
+#include "ns3/wifi-net-device.h"
+#include "ns3/yans-wifi-helper.h"
+
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Microbenchmark of the WifiMacQueue operations.
+ *
+ * MPDUs addressed to a number of receivers are enqueued in the BE queue of a
+ * wifi device. Then, the container queue of every receiver is walked through as
+ * done to build an A-MPDU, every other MPDU is removed (as if it were dropped)
+ * and the remaining MPDUs are dequeued (as if they were acknowledged).
+ */
+class MacQueueBench
+{
+  public:
+    /**
+     * Constructor
+     * \param [in] nMpdus The number of MPDUs in the queue.
+     * \param [in] nReceivers The number of receivers of the MPDUs.
+     */
+    MacQueueBench(uint32_t nMpdus, uint32_t nReceivers);
+
+    /**
+     * Fill and empty the queue the given number of times.
+     * \param [in] iterations The number of times the queue is filled and emptied.
+     */
+    void Run(uint32_t iterations);
+
+    /** Operations whose time is measured */
+    enum Phase
+    {
+        ENQUEUE = 0,
+        PEEK,
+        REMOVE,
+        DEQUEUE,
+        N_PHASES
+    };
+
+    /**
+     * \param [in] phase The phase.
+     * \return the number of operations per second of the given phase
+     */
+    double GetRate(Phase phase) const
+    {
+        return m_time[phase] > 0 ? m_ops[phase] / m_time[phase] : 0;
+    }
+
+  private:
+    Ptr<WifiMacQueue> m_queue;             //!< the queue
+    std::vector<Mac48Address> m_receivers; //!< the receivers of the MPDUs
+    uint32_t m_nMpdus;                     //!< number of MPDUs in the queue
+    double m_time[N_PHASES]{};             //!< time spent in every phase (s)
+    uint64_t m_ops[N_PHASES]{};            //!< number of operations of every phase
+};
+
+MacQueueBench::MacQueueBench(uint32_t nMpdus, uint32_t nReceivers)
+    : m_receivers(nReceivers),
+      m_nMpdus(nMpdus)
+{
+    // the queue scheduler is connected to the queues of a MAC
+    NodeContainer node(1);
+    WifiHelper wifi;
+    wifi.SetStandard(WIFI_STANDARD_80211n);
+    YansWifiPhyHelper phy;
+    phy.SetChannel(YansWifiChannelHelper::Default().Create());
+    WifiMacHelper mac;
+    mac.SetType("ns3::AdhocWifiMac");
+    auto device = DynamicCast<WifiNetDevice>(wifi.Install(phy, mac, node).Get(0));
+
+    m_queue = device->GetMac()->GetTxopQueue(AC_BE);
+    m_queue->SetMaxSize(QueueSize(QueueSizeUnit::PACKETS, m_nMpdus));
+
+    for (auto& receiver : m_receivers)
+    {
+        receiver = Mac48Address::Allocate();
+    }
+}
+
+void
+MacQueueBench::Run(uint32_t iterations)
+{
+    auto packet = Create<Packet>(1500);
+    SystemWallClockMs timer;
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        std::vector<Ptr<WifiMpdu>> mpdus;
+        mpdus.reserve(m_nMpdus);
+        for (uint32_t j = 0; j < m_nMpdus; ++j)
+        {
+            WifiMacHeader header(WIFI_MAC_QOSDATA);
+            header.SetAddr1(m_receivers[j % m_receivers.size()]);
+            header.SetQosTid(0);
+            header.SetSequenceNumber(j / m_receivers.size());
+            mpdus.push_back(Create<WifiMpdu>(packet, header));
+        }
+
+        timer.Start();
+        for (const auto& mpdu : mpdus)
+        {
+            m_queue->Enqueue(mpdu);
+        }
+        m_time[ENQUEUE] += timer.End() / 1000.0;
+        m_ops[ENQUEUE] += mpdus.size();
+        NS_ABORT_MSG_IF(m_queue->GetNPackets() != m_nMpdus, "Unexpected queue size");
+
+        std::vector<Ptr<WifiMpdu>> toRemove;
+        std::vector<std::list<Ptr<const WifiMpdu>>> toDequeue(m_receivers.size());
+        toRemove.reserve(m_nMpdus / 2);
+        timer.Start();
+        for (std::size_t r = 0; r < m_receivers.size(); ++r)
+        {
+            WifiContainerQueueId queueId{WIFI_QOSDATA_QUEUE, WIFI_UNICAST, m_receivers[r], 0};
+            bool remove = false;
+            for (auto item = m_queue->PeekByQueueId(queueId); item;
+                 item = m_queue->PeekByQueueId(queueId, item))
+            {
+                ++m_ops[PEEK];
+                if (remove)
+                {
+                    toRemove.push_back(item);
+                }
+                else
+                {
+                    toDequeue[r].push_back(item);
+                }
+                remove = !remove;
+            }
+        }
+        m_time[PEEK] += timer.End() / 1000.0;
+
+        timer.Start();
+        for (const auto& item : toRemove)
+        {
+            m_queue->Remove(item);
+        }
+        m_time[REMOVE] += timer.End() / 1000.0;
+        m_ops[REMOVE] += toRemove.size();
+
+        // the MPDUs addressed to every receiver are dequeued at once, as done when a
+        // BlockAck is received
+        timer.Start();
+        for (const auto& mpduList : toDequeue)
+        {
+            m_queue->DequeueIfQueued(mpduList);
+        }
+        m_time[DEQUEUE] += timer.End() / 1000.0;
+        m_ops[DEQUEUE] += m_nMpdus - toRemove.size();
+        NS_ABORT_MSG_IF(!m_queue->IsEmpty(), "Expected the queue to be empty");
+    }
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nMpdus = 10000;
+    uint32_t iterations = 10;
+    std::string receiversList = "1,100";
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Microbenchmark of the WifiMacQueue operations.\n"
+              "\n"
+              "Reports the number of Enqueue, PeekByQueueId, Remove and DequeueIfQueued\n"
+              "operations per second.");
+    cmd.AddValue("mpdus", "number of MPDUs in the queue", nMpdus);
+    cmd.AddValue("receivers", "comma separated list of numbers of receivers", receiversList);
+    cmd.AddValue("iterations", "number of times the queue is filled and emptied", iterations);
+    cmd.Parse(argc, argv);
+
+    LOG("MPDUs in the queue: " << nMpdus);
+    LOG("Iterations:         " << iterations);
+    LOG("");
+    LOG(std::setw(10) << "receivers" << std::setw(14) << "enqueue/s" << std::setw(14) << "peek/s"
+                      << std::setw(14) << "remove/s" << std::setw(14) << "dequeue/s");
+
+    std::istringstream iss(receiversList);
+    std::string token;
+    while (std::getline(iss, token, ','))
+    {
+        uint32_t nReceivers = std::stoul(token);
+        MacQueueBench bench(nMpdus, nReceivers);
+        bench.Run(iterations);
+        LOG(std::setw(10) << nReceivers << std::setw(14) << bench.GetRate(MacQueueBench::ENQUEUE)
+                          << std::setw(14) << bench.GetRate(MacQueueBench::PEEK)
+                          << std::setw(14) << bench.GetRate(MacQueueBench::REMOVE)
+                          << std::setw(14) << bench.GetRate(MacQueueBench::DEQUEUE));
+        Simulator::Destroy();
+    }
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/core-module.h"
+#include "ns3/eht-phy.h"
+#include "ns3/he-phy.h"
+#include "ns3/mpdu-aggregator.h"
+#include "ns3/wifi-phy.h"
+#include "ns3/wifi-tx-vector.h"
+
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace ns3;
+
+/** Log to std::cout */
+#define LOG(x) std::cout << x << std::endl
+
+/**
+ * Benchmark of the A-MPDU aggregation decisions.
+ *
+ * Every decision checks whether adding an MPDU to an A-MPDU keeps the duration
+ * of the PPDU within the limit, as done by the frame exchange managers, hence
+ * it computes the TX duration of the resulting PSDU.
+ */
+class TxDurationBench
+{
+  public:
+    /** Constructor */
+    TxDurationBench();
+
+    /**
+     * Build the A-MPDUs for all the TXVECTORs the given number of times.
+     * \param [in] iterations The number of times every A-MPDU is built.
+     * \return the number of MPDUs in the A-MPDU built for every TXVECTOR
+     */
+    std::vector<std::size_t> Run(uint32_t iterations);
+
+    /** \return the number of aggregation decisions taken by the last run */
+    uint64_t GetDecisions() const
+    {
+        return m_decisions;
+    }
+
+  private:
+    std::vector<WifiTxVector> m_txVectors; //!< TXVECTORs used to transmit the A-MPDUs
+    uint64_t m_decisions{0};               //!< number of aggregation decisions
+};
+
+TxDurationBench::TxDurationBench()
+{
+    WifiTxVector txVector;
+    txVector.SetNss(2);
+    txVector.SetGuardInterval(800);
+    txVector.SetPreambleType(WIFI_PREAMBLE_HE_SU);
+    txVector.SetChannelWidth(80);
+    for (uint8_t mcs = 0; mcs < 12; ++mcs)
+    {
+        txVector.SetMode(HePhy::GetHeMcs(mcs));
+        m_txVectors.push_back(txVector);
+    }
+    txVector.SetPreambleType(WIFI_PREAMBLE_EHT_MU);
+    txVector.SetChannelWidth(160);
+    for (uint8_t mcs = 0; mcs < 14; ++mcs)
+    {
+        txVector.SetMode(EhtPhy::GetEhtMcs(mcs));
+        m_txVectors.push_back(txVector);
+    }
+}
+
+std::vector<std::size_t>
+TxDurationBench::Run(uint32_t iterations)
+{
+    const uint32_t mpduSize = 1538;        // MPDU carrying a 1500-byte MSDU
+    const uint32_t maxAmpduSize = 6500631; // maximum HE A-MPDU size
+    const std::size_t maxNMpdus = 1024;    // maximum EHT BlockAck window
+    const Time ppduDurationLimit = MicroSeconds(5484);
+
+    m_decisions = 0;
+    std::vector<std::size_t> nMpdus(m_txVectors.size());
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < m_txVectors.size(); ++j)
+        {
+            uint32_t ampduSize = 0;
+            std::size_t n = 0;
+            while (n < maxNMpdus)
+            {
+                auto newSize = MpduAggregator::GetSizeIfAggregated(mpduSize, ampduSize);
+                ++m_decisions;
+                if (newSize > maxAmpduSize ||
+                    WifiPhy::CalculateTxDuration(newSize, m_txVectors[j], WIFI_PHY_BAND_5GHZ) >
+                        ppduDurationLimit)
+                {
+                    break;
+                }
+                ampduSize = newSize;
+                ++n;
+            }
+            nMpdus[j] = n;
+        }
+    }
+    return nMpdus;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t iterations = 500;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Benchmark of the A-MPDU aggregation decisions with and without the\n"
+              "TX duration cache of WifiPhy.\n"
+              "\n"
+              "A-MPDUs of 1500-byte MSDUs are built for HE SU and EHT MU TXVECTORs\n"
+              "until the PPDU duration limit is reached.");
+    cmd.AddValue("iterations", "number of times every A-MPDU is built", iterations);
+    cmd.Parse(argc, argv);
+
+    LOG("Iterations: " << iterations);
+    LOG("");
+    LOG(std::setw(8) << "cache" << std::setw(14) << "time (s)" << std::setw(16) << "decisions/s");
+
+    TxDurationBench bench;
+    std::vector<std::size_t> expected;
+    for (auto enable : {false, true})
+    {
+        WifiPhy::SetTxDurationCacheEnabled(enable);
+        SystemWallClockMs timer;
+        timer.Start();
+        auto nMpdus = bench.Run(iterations);
+        double elapsed = timer.End() / 1000.0;
+
+        NS_ABORT_MSG_IF(enable && nMpdus != expected,
+                        "The TX duration cache altered the aggregation decisions");
+        expected = nMpdus;
+        LOG(std::setw(8) << (enable ? "on" : "off") << std::setw(14) << elapsed << std::setw(16)
+                         << (elapsed > 0 ? bench.GetDecisions() / elapsed : 0));
+    }
+    WifiPhy::SetTxDurationCacheEnabled(true);
+
+    return 0;
+}